@@ -0,0 +1,71 @@
+package chain
+
+import (
+	"sync"
+
+	"github.com/aergoio/aergo/state"
+	"github.com/aergoio/aergo/types"
+)
+
+// pendingDiff keeps the state diff shipped with the block being added, until the block is executed.
+var pendingDiff blockDiffSlot
+
+type blockDiffSlot struct {
+	sync.Mutex
+	id   types.BlockID
+	diff *state.BlockDiff
+}
+
+func (s *blockDiffSlot) set(block *types.Block, diff *state.BlockDiff) {
+	s.Lock()
+	defer s.Unlock()
+	s.id = block.BlockID()
+	s.diff = diff
+}
+
+func (s *blockDiffSlot) take(block *types.Block) *state.BlockDiff {
+	s.Lock()
+	defer s.Unlock()
+	if s.diff == nil || s.id != block.BlockID() {
+		return nil
+	}
+	diff := s.diff
+	s.diff = nil
+	return diff
+}
+
+func (s *blockDiffSlot) clear() {
+	s.Lock()
+	defer s.Unlock()
+	s.diff = nil
+}
+
+// isDiffMismatch reports whether err means that the state diff doesn't reproduce the block, so that the block is
+// executed instead.
+func isDiffMismatch(err error) bool {
+	return err == ErrorBlockVerifyStateRoot || err == ErrorBlockVerifyReceiptRoot
+}
+
+// newBlockExecutorOfDiff returns a block executor which commits the state made by applying diff instead of
+// executing txs of block. The state root and the receipts root of block are verified as executing txs.
+func newBlockExecutorOfDiff(cs *ChainService, block *types.Block, diff *state.BlockDiff) (*blockExecutor, error) {
+	if err := cs.validator.ValidateBlock(block); err != nil {
+		return nil, err
+	}
+
+	bState := state.NewBlockState(cs.sdb.OpenNewStateDB(cs.sdb.GetRoot()),
+		state.SetPrevBlockHash(block.GetHeader().GetPrevBlockHash()))
+	bState.Receipts().SetHardFork(cs.cfg.Hardfork, block.BlockNo())
+	applyErr := bState.ApplyDiff(diff)
+
+	// txs must be valid regardless of the diff
+	if err := cs.validator.WaitVerifyDone(); err != nil {
+		return nil, err
+	}
+	if applyErr != nil {
+		logger.Warn().Err(applyErr).Uint64("no", block.BlockNo()).Msg("failed to apply state diff of block")
+		return nil, ErrorBlockVerifyStateRoot
+	}
+
+	return newBlockExecutor(cs, bState, block, false)
+}
@@ -44,6 +44,8 @@ var (
 var (
 	latestKey      = []byte(chainDBName + ".latest")
 	receiptsPrefix = []byte("r")
+	// receipts written with an offset table. receipts of blocks executed before it are gob encoded under receiptsPrefix
+	indexedReceiptsPrefix = []byte("r_idx.")
 
 	raftIdentityKey              = []byte("r_identity")
 	raftStateKey                 = []byte("r_state")
@@ -53,7 +55,8 @@ var (
 	raftEntryInvertPrefix        = []byte("r_inv.")
 	raftConfChangeProgressPrefix = []byte("r_ccstatus.")
 
-	hardforkKey = []byte("hardfork")
+	hardforkKey       = []byte("hardfork")
+	stateSyncPointKey = []byte("statesyncpoint")
 )
 
 // ErrNoBlock reports there is no such a block with id (hash or block number).
@@ -314,6 +317,8 @@ func (cdb *ChainDB) addGenesisBlock(genesis *types.Genesis) error {
 
 	cdb.connectToChain(tx, block, false)
 	tx.Set([]byte(genesisKey), genesis.Bytes())
+	// all blocks of a new chain are indexed
+	tx.Set(eventIndexFromKey, types.BlockNoToBytes(1))
 	if totalBalance := genesis.TotalBalance(); totalBalance != nil {
 		tx.Set([]byte(genesisBalanceKey), totalBalance.Bytes())
 	}
@@ -647,31 +652,45 @@ func (cdb *ChainDB) getTx(txHash []byte) (*types.Tx, *types.TxIdx, error) {
 
 func (cdb *ChainDB) getReceipt(blockHash []byte, blockNo types.BlockNo, idx int32,
 	hardForkConfig *config.HardforkConfig) (*types.Receipt, error) {
-	storedReceipts, err := cdb.getReceipts(blockHash, blockNo, hardForkConfig)
-	if err != nil {
-		return nil, err
-	}
-	receipts := storedReceipts.Get()
+	var r *types.Receipt
+	if data := cdb.store.Get(indexedReceiptsKey(blockHash, blockNo)); len(data) != 0 {
+		var err error
+		if r, err = types.ReadIndexedReceipt(data, idx, hardForkConfig, blockNo); err != nil {
+			return nil, err
+		}
+	} else {
+		storedReceipts, err := cdb.getReceipts(blockHash, blockNo, hardForkConfig)
+		if err != nil {
+			return nil, err
+		}
+		receipts := storedReceipts.Get()
 
-	if idx < 0 || idx > int32(len(receipts)) {
-		return nil, fmt.Errorf("cannot find a receipt: invalid index (%d)", idx)
+		if idx < 0 || idx >= int32(len(receipts)) {
+			return nil, fmt.Errorf("cannot find a receipt: invalid index (%d)", idx)
+		}
+		r = receipts[idx]
 	}
-	r := receipts[idx]
 	r.SetMemoryInfo(blockHash, blockNo, idx)
-	return receipts[idx], nil
+	return r, nil
 }
 
 func (cdb *ChainDB) getReceipts(blockHash []byte, blockNo types.BlockNo,
 	hardForkConfig *config.HardforkConfig) (*types.Receipts, error) {
+	var receipts types.Receipts
+	receipts.SetHardFork(hardForkConfig, blockNo)
+
+	if data := cdb.store.Get(indexedReceiptsKey(blockHash, blockNo)); len(data) != 0 {
+		err := receipts.UnmarshalIndexedBinary(data)
+		return &receipts, err
+	}
+
 	data := cdb.store.Get(receiptsKey(blockHash, blockNo))
 	if len(data) == 0 {
 		return nil, errors.New("cannot find a receipt")
 	}
 	var b bytes.Buffer
 	b.Write(data)
-	var receipts types.Receipts
 
-	receipts.SetHardFork(hardForkConfig, blockNo)
 	decoder := gob.NewDecoder(&b)
 	err := decoder.Decode(&receipts)
 
@@ -679,6 +698,9 @@ func (cdb *ChainDB) getReceipts(blockHash []byte, blockNo types.BlockNo,
 }
 
 func (cdb *ChainDB) checkExistReceipts(blockHash []byte, blockNo types.BlockNo) bool {
+	if len(cdb.store.Get(indexedReceiptsKey(blockHash, blockNo))) != 0 {
+		return true
+	}
 	data := cdb.store.Get(receiptsKey(blockHash, blockNo))
 	if len(data) == 0 {
 		return false
@@ -716,22 +738,35 @@ func (cdb *ChainDB) writeReceipts(blockHash []byte, blockNo types.BlockNo, recei
 	dbTx := cdb.store.NewTx()
 	defer dbTx.Discard()
 
-	var val bytes.Buffer
-	gobEncoder := gob.NewEncoder(&val)
-	gobEncoder.Encode(receipts)
+	val, err := receipts.MarshalIndexedBinary()
+	if err != nil {
+		logger.Error().Err(err).Uint64("no", blockNo).Msg("failed to serialize receipts")
+		return
+	}
 
-	dbTx.Set(receiptsKey(blockHash, blockNo), val.Bytes())
+	dbTx.Set(indexedReceiptsKey(blockHash, blockNo), val)
+	cdb.writeEventIndex(dbTx, blockHash, blockNo, receipts)
 
 	dbTx.Commit()
 }
 
 func (cdb *ChainDB) deleteReceipts(dbTx *db.Transaction, blockHash []byte, blockNo types.BlockNo) {
 	(*dbTx).Delete(receiptsKey(blockHash, blockNo))
+	(*dbTx).Delete(indexedReceiptsKey(blockHash, blockNo))
+	cdb.deleteEventIndex(dbTx, blockHash)
 }
 
 func receiptsKey(blockHash []byte, blockNo types.BlockNo) []byte {
+	return receiptsKeyWithPrefix(receiptsPrefix, blockHash, blockNo)
+}
+
+func indexedReceiptsKey(blockHash []byte, blockNo types.BlockNo) []byte {
+	return receiptsKeyWithPrefix(indexedReceiptsPrefix, blockHash, blockNo)
+}
+
+func receiptsKeyWithPrefix(prefix []byte, blockHash []byte, blockNo types.BlockNo) []byte {
 	var key bytes.Buffer
-	key.Write(receiptsPrefix)
+	key.Write(prefix)
 	key.Write(blockHash)
 	l := make([]byte, 8)
 	binary.LittleEndian.PutUint64(l[:], blockNo)
@@ -779,6 +814,43 @@ func (cdb *ChainDB) getReorgMarker() (*ReorgMarker, error) {
 	return &marker, err
 }
 
+func (cdb *ChainDB) writeStateSyncPoint(point *stateSyncPoint) error {
+	var val bytes.Buffer
+	if err := gob.NewEncoder(&val).Encode(point); err != nil {
+		logger.Error().Err(err).Msg("failed to serialize state sync point")
+		return err
+	}
+
+	dbTx := cdb.store.NewTx()
+	defer dbTx.Discard()
+
+	dbTx.Set(stateSyncPointKey, val.Bytes())
+
+	dbTx.Commit()
+	return nil
+}
+
+func (cdb *ChainDB) deleteStateSyncPoint() {
+	dbTx := cdb.store.NewTx()
+	defer dbTx.Discard()
+
+	dbTx.Delete(stateSyncPointKey)
+
+	dbTx.Commit()
+}
+
+func (cdb *ChainDB) getStateSyncPoint() (*stateSyncPoint, error) {
+	data := cdb.store.Get(stateSyncPointKey)
+	if len(data) == 0 {
+		return nil, nil
+	}
+
+	var point stateSyncPoint
+	err := gob.NewDecoder(bytes.NewBuffer(data)).Decode(&point)
+
+	return &point, err
+}
+
 // implement ChainWAL interface
 func (cdb *ChainDB) IsNew() bool {
 	//TODO
@@ -121,6 +121,15 @@ func (cdb *ChainDB) WriteHardState(hardstate *raftpb.HardState) error {
 	dbTx := cdb.store.NewTx()
 	defer dbTx.Discard()
 
+	if err := cdb.writeHardState(dbTx, hardstate); err != nil {
+		return err
+	}
+	dbTx.Commit()
+
+	return nil
+}
+
+func (cdb *ChainDB) writeHardState(dbTx db.Transaction, hardstate *raftpb.HardState) error {
 	var data []byte
 	var err error
 
@@ -131,7 +140,6 @@ func (cdb *ChainDB) WriteHardState(hardstate *raftpb.HardState) error {
 		return err
 	}
 	dbTx.Set(raftStateKey, data)
-	dbTx.Commit()
 
 	return nil
 }
@@ -171,6 +179,34 @@ func getRaftEntryInvertKey(blockHash []byte) []byte {
 }
 
 func (cdb *ChainDB) WriteRaftEntry(ents []*consensus.WalEntry, blocks []*types.Block, ccProposes []*raftpb.ConfChange) error {
+	return cdb.WriteRaftReady(ents, blocks, ccProposes, nil)
+}
+
+// WriteRaftReady saves entries and the hard state of a raft Ready batch by one transaction, so that the batch is
+// synced to disk once instead of once per kind of data. Entries are written before the hard state since entries
+// may include committed ones. ents may be empty and hardstate may be nil.
+func (cdb *ChainDB) WriteRaftReady(ents []*consensus.WalEntry, blocks []*types.Block, ccProposes []*raftpb.ConfChange,
+	hardstate *raftpb.HardState) error {
+	dbTx := cdb.store.NewTx()
+	defer dbTx.Discard()
+
+	if len(ents) != 0 {
+		if err := cdb.writeRaftEntry(dbTx, ents, blocks, ccProposes); err != nil {
+			return err
+		}
+	}
+	if hardstate != nil {
+		if err := cdb.writeHardState(dbTx, hardstate); err != nil {
+			return err
+		}
+	}
+
+	dbTx.Commit()
+
+	return nil
+}
+
+func (cdb *ChainDB) writeRaftEntry(dbTx db.Transaction, ents []*consensus.WalEntry, blocks []*types.Block, ccProposes []*raftpb.ConfChange) error {
 	var data []byte
 	var err error
 	var lastIdx uint64
@@ -181,9 +217,6 @@ func (cdb *ChainDB) WriteRaftEntry(ents []*consensus.WalEntry, blocks []*types.B
 		return err
 	}
 
-	dbTx := cdb.store.NewTx()
-	defer dbTx.Discard()
-
 	if ents[0].Index <= last {
 		logger.Debug().Uint64("from", ents[0].Index).Uint64("to", last).Msg("truncate conflicting index")
 
@@ -236,8 +269,6 @@ func (cdb *ChainDB) WriteRaftEntry(ents []*consensus.WalEntry, blocks []*types.B
 	// set lastindex
 	cdb.writeRaftEntryLastIndex(dbTx, lastIdx)
 
-	dbTx.Commit()
-
 	return nil
 }
 
@@ -0,0 +1,68 @@
+package chain
+
+import (
+	"fmt"
+	"io/ioutil"
+	"os"
+	"testing"
+
+	"github.com/aergoio/aergo-lib/db"
+	"github.com/aergoio/aergo/consensus"
+	"github.com/aergoio/aergo/types"
+	"github.com/aergoio/etcd/raft/raftpb"
+)
+
+func newTestRaftBlock(no types.BlockNo, txCount int) *types.Block {
+	txs := make([]*types.Tx, txCount)
+	for i := range txs {
+		tx := &types.Tx{Body: &types.TxBody{Nonce: uint64(i + 1), Payload: make([]byte, 100)}}
+		tx.Hash = tx.CalculateTxHash()
+		txs[i] = tx
+	}
+	return types.NewBlock(&types.BlockHeaderInfo{No: no}, nil, nil, txs, nil, nil)
+}
+
+// benchmarkWriteRaft measures the commit latency (ns/op) and the throughput (MB/s) of writing a raft Ready batch
+// of one block entry with the hard state.
+func benchmarkWriteRaft(b *testing.B, txCount int, write func(cdb *ChainDB, ents []*consensus.WalEntry, blocks []*types.Block, hs *raftpb.HardState) error) {
+	tmpdir, _ := ioutil.TempDir("", "raftwal")
+	defer os.RemoveAll(tmpdir)
+
+	cdb := NewChainDB()
+	if err := cdb.Init(string(db.BadgerImpl), tmpdir); err != nil {
+		b.Fatal(err)
+	}
+	defer cdb.Close()
+
+	blocks := make([]*types.Block, b.N)
+	for i := range blocks {
+		blocks[i] = newTestRaftBlock(types.BlockNo(i+1), txCount)
+	}
+	b.SetBytes(int64(blocks[0].Size()))
+
+	b.ResetTimer()
+	for i, block := range blocks {
+		idx := uint64(i + 1)
+		ents := []*consensus.WalEntry{{Type: consensus.EntryBlock, Term: 1, Index: idx, Data: block.BlockHash()}}
+		if err := write(cdb, ents, []*types.Block{block}, &raftpb.HardState{Term: 1, Commit: idx}); err != nil {
+			b.Fatal(err)
+		}
+	}
+}
+
+func BenchmarkWriteRaftEntry(b *testing.B) {
+	separate := func(cdb *ChainDB, ents []*consensus.WalEntry, blocks []*types.Block, hs *raftpb.HardState) error {
+		if err := cdb.WriteRaftEntry(ents, blocks, make([]*raftpb.ConfChange, len(ents))); err != nil {
+			return err
+		}
+		return cdb.WriteHardState(hs)
+	}
+	ready := func(cdb *ChainDB, ents []*consensus.WalEntry, blocks []*types.Block, hs *raftpb.HardState) error {
+		return cdb.WriteRaftReady(ents, blocks, make([]*raftpb.ConfChange, len(ents)), hs)
+	}
+
+	for _, txCount := range []int{0, 100, 1000, 5000} {
+		b.Run(fmt.Sprintf("separate-%dtx", txCount), func(b *testing.B) { benchmarkWriteRaft(b, txCount, separate) })
+		b.Run(fmt.Sprintf("ready-%dtx", txCount), func(b *testing.B) { benchmarkWriteRaft(b, txCount, ready) })
+	}
+}
@@ -190,6 +190,10 @@ func (cs *ChainService) listEvents(filter *types.FilterInfo) ([]*types.Event, er
 	if err != nil {
 		return nil, err
 	}
+	if cs.cdb.isEventIndexed(from) {
+		return cs.listIndexedEvents(filter, argFilter, from, to)
+	}
+
 	events := []*types.Event{}
 	var totalSize uint64
 	if filter.Desc {
@@ -207,9 +211,103 @@ func (cs *ChainService) listEvents(filter *types.FilterInfo) ([]*types.Event, er
 			}
 		}
 	}
+	return pageEvents(events, filter), nil
+}
+
+// listIndexedEvents lists events by range scan of the event index. Receipts are loaded only for blocks which
+// have events of the contract, and events before the offset are skipped without loading receipts if
+// there is no arg filter.
+func (cs *ChainService) listIndexedEvents(filter *types.FilterInfo, argFilter []types.ArgFilter,
+	from, to types.BlockNo) ([]*types.Event, error) {
+	entries := cs.cdb.getEventIndex(filter.ContractAddress, filter.EventName, from, to)
+	if filter.Desc {
+		entries = reverseEventBlocks(entries)
+	}
+
+	events := []*types.Event{}
+	var (
+		totalSize uint64
+		skipped   int32
+		blkNo     types.BlockNo
+		blkHash   []byte
+		receipts  []*types.Receipt
+	)
+	for _, entry := range entries {
+		if blkHash == nil || blkNo != entry.blockNo {
+			blkNo, blkHash, receipts = entry.blockNo, nil, nil
+			if hash, err := cs.cdb.getHashByNo(blkNo); err == nil && bytes.Equal(hash, entry.blockHash) {
+				blkHash = hash
+			}
+		}
+		if blkHash == nil {
+			// entry of a block on the other branch
+			continue
+		}
+		if argFilter == nil && skipped < filter.Offset {
+			skipped++
+			continue
+		}
+		if receipts == nil {
+			rs, err := cs.cdb.getReceipts(blkHash, blkNo, cs.cfg.Hardfork)
+			if err != nil {
+				return nil, err
+			}
+			receipts = rs.Get()
+		}
+		if int(entry.txIdx) >= len(receipts) || int(entry.eventIdx) >= len(receipts[entry.txIdx].Events) {
+			continue
+		}
+		r := receipts[entry.txIdx]
+		e := r.Events[entry.eventIdx]
+		if !e.Filter(filter, argFilter) {
+			continue
+		}
+		if skipped < filter.Offset {
+			skipped++
+			continue
+		}
+		e.SetMemoryInfo(r, blkHash, blkNo, entry.txIdx)
+		events = append(events, e)
+		totalSize += uint64(proto.Size(e))
+		if totalSize > MaxEventSize {
+			return nil, errors.New(fmt.Sprintf("too large size of event (%v)", totalSize))
+		}
+		if filter.Limit > 0 && int32(len(events)) >= filter.Limit {
+			break
+		}
+	}
 	return events, nil
 }
 
+// reverseEventBlocks returns index entries in descending block order. Entries of a block keep ascending
+// order of tx and event, as the block scan lists them.
+func reverseEventBlocks(entries []eventIndexEntry) []eventIndexEntry {
+	reversed := make([]eventIndexEntry, 0, len(entries))
+	for end := len(entries); end > 0; {
+		start := end - 1
+		for start > 0 && entries[start-1].blockNo == entries[end-1].blockNo {
+			start--
+		}
+		reversed = append(reversed, entries[start:end]...)
+		end = start
+	}
+	return reversed
+}
+
+// pageEvents applies offset and limit of filter to events.
+func pageEvents(events []*types.Event, filter *types.FilterInfo) []*types.Event {
+	if filter.Offset > 0 {
+		if int(filter.Offset) >= len(events) {
+			return []*types.Event{}
+		}
+		events = events[filter.Offset:]
+	}
+	if filter.Limit > 0 && int(filter.Limit) < len(events) {
+		events = events[:filter.Limit]
+	}
+	return events
+}
+
 type chainProcessor struct {
 	*ChainService
 	block       *types.Block // starting block
@@ -452,8 +550,10 @@ func (cs *ChainService) addBlockInternal(newBlock *types.Block, usedBstate *stat
 			bestBlock.GetHeader().GetChainID(), newBlock.GetHeader().GetChainID()), false
 	}
 
-	if err := cs.VerifySign(newBlock); err != nil {
-		return err, true
+	if !preVerifiedHeaders.take(newBlock) {
+		if err := cs.VerifySign(newBlock); err != nil {
+			return err, true
+		}
 	}
 
 	// handle orphan
@@ -585,10 +685,11 @@ func newBlockExecutor(cs *ChainService, bState *state.BlockState, block *types.B
 			return nil, err
 		}
 
-		bState = state.NewBlockState(
-			cs.sdb.OpenNewStateDB(cs.sdb.GetRoot()),
-			state.SetPrevBlockHash(block.GetHeader().GetPrevBlockHash()),
-		)
+		options := []state.BlockStateOptFn{state.SetPrevBlockHash(block.GetHeader().GetPrevBlockHash())}
+		if cs.cfg.Blockchain.AccessStat {
+			options = append(options, state.RecordAccess())
+		}
+		bState = state.NewBlockState(cs.sdb.OpenNewStateDB(cs.sdb.GetRoot()), options...)
 		bi = types.NewBlockHeaderInfo(block)
 		exec = NewTxExecutor(cs.ChainConsensus, cs.cdb, bi, contract.ChainService)
 
@@ -657,11 +758,13 @@ func (e *blockExecutor) execute() error {
 				preLoadTx = e.txs[i+1]
 				contract.PreLoadRequest(e.BlockState, e.bi, preLoadTx, tx, contract.ChainService)
 			}
+			e.BeginTxAccess(i)
 			if err := e.execTx(e.BlockState, types.NewTransaction(tx)); err != nil {
 				//FIXME maybe system error. restart or panic
 				// all txs have executed successfully in BP node
 				return err
 			}
+			e.EndTxAccess()
 			contract.SetPreloadTx(preLoadTx, contract.ChainService)
 		}
 
@@ -724,6 +827,10 @@ func (cs *ChainService) executeBlock(bstate *state.BlockState, block *types.Bloc
 		err       error
 	)
 
+	if point := cs.getStateSyncPoint(); point != nil && block.BlockNo() <= point.No {
+		return cs.connectSyncedBlock(block, point)
+	}
+
 	if bestBlock, err = cs.cdb.GetBestBlock(); err != nil {
 		return err
 	}
@@ -732,16 +839,31 @@ func (cs *ChainService) executeBlock(bstate *state.BlockState, block *types.Bloc
 	if err = cs.IsBlockValid(block, bestBlock); err != nil {
 		return err
 	}
-	bstate = bstate.SetPrevBlockHash(block.GetHeader().GetPrevBlockHash())
-	// TODO refactoring: receive execute function as argument (executeBlock or executeBlockReco)
-	ex, err := newBlockExecutor(cs, bstate, block, false)
-	if err != nil {
-		return err
+	var ex *blockExecutor
+	if diff := pendingDiff.take(block); diff != nil && bstate == nil {
+		if ex, err = newBlockExecutorOfDiff(cs, block, diff); err == nil {
+			err = ex.execute()
+		}
+		if isDiffMismatch(err) {
+			logger.Warn().Str("hash", block.ID()).Uint64("no", block.BlockNo()).
+				Msg("state diff doesn't match block, execute txs of block instead")
+			ex = nil
+		} else if err != nil {
+			return err
+		}
 	}
 
-	// contract & state DB update is done during execution.
-	if err := ex.execute(); err != nil {
-		return err
+	if ex == nil {
+		bstate = bstate.SetPrevBlockHash(block.GetHeader().GetPrevBlockHash())
+		// TODO refactoring: receive execute function as argument (executeBlock or executeBlockReco)
+		if ex, err = newBlockExecutor(cs, bstate, block, false); err != nil {
+			return err
+		}
+
+		// contract & state DB update is done during execution.
+		if err := ex.execute(); err != nil {
+			return err
+		}
 	}
 
 	if len(ex.BlockState.Receipts().Get()) != 0 {
@@ -750,6 +872,10 @@ func (cs *ChainService) executeBlock(bstate *state.BlockState, block *types.Bloc
 
 	cs.notifyEvents(block, ex.BlockState)
 
+	if as := ex.AccessStats(); as != nil {
+		cs.stat.updateEvent(AccessStat, block, as)
+	}
+
 	cs.Update(block)
 
 	logger.Debug().Uint64("no", block.GetHeader().BlockNo).Msg("end to execute")
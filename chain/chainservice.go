@@ -64,6 +64,34 @@ func NewCore(dbType string, dataDir string, testModeOn bool, forceResetHeight ty
 	return core, nil
 }
 
+// rollbackUnflushedBest drops the best block if its states are not written to disk, while the states of the
+// previous block are. It happens when the server stopped while the states of the best block were flushed
+// in commit pipeline, and the block will be received again by sync.
+func (core *Core) rollbackUnflushedBest(best *types.Block) error {
+	no := best.GetHeader().GetBlockNo()
+	root := best.GetHeader().GetBlocksRootHash()
+	stateDB := core.sdb.GetStateDB()
+	if no == 0 || len(root) == 0 || stateDB.HasMarker(root) {
+		return nil
+	}
+
+	prev, err := core.cdb.GetBlockByNo(no - 1)
+	if err != nil {
+		return err
+	}
+	prevRoot := prev.GetHeader().GetBlocksRootHash()
+	if !stateDB.HasMarker(prevRoot) {
+		// not caused by commit pipeline. leave it to recovery
+		return nil
+	}
+
+	logger.Warn().Str("besthash", best.ID()).Uint64("no", no).Msg("states of best block are not written. roll back to previous block")
+	if err := core.cdb.ResetBest(no - 1); err != nil {
+		return err
+	}
+	return core.sdb.SetRoot(prevRoot)
+}
+
 // Init prepares Core (chain & state DB).
 func (core *Core) init(dbType string, dataDir string, testModeOn bool, forceResetHeight types.BlockNo) error {
 	// init chaindb
@@ -90,6 +118,11 @@ func (core *Core) init(dbType string, dataDir string, testModeOn bool, forceRese
 		return err
 	}
 
+	if err := core.rollbackUnflushedBest(bestBlock); err != nil {
+		logger.Fatal().Err(err).Msg("failed to roll back best block")
+		return err
+	}
+
 	contract.LoadDatabase(dataDir)
 
 	return nil
@@ -210,6 +243,11 @@ type ChainService struct {
 
 	recovered  atomic.Value
 	debuggable bool
+
+	// syncPoint is *stateSyncPoint set while blocks are synced to a block whose state is imported
+	syncPoint atomic.Value
+	// sqlSnapshots are sql databases served to peers syncing state
+	sqlSnapshots stateSQLSnapshots
 }
 
 var _ types.ChainAccessor = (*ChainService)(nil)
@@ -224,12 +262,17 @@ func NewChainService(cfg *cfg.Config) *ChainService {
 
 	cs.setRecovered(false)
 
+	state.InitStorageNodeCache(cfg.Blockchain.StorageCacheSize)
+
 	var err error
 	if cs.Core, err = NewCore(cfg.DbType, cfg.DataDir, cfg.EnableTestmode, types.BlockNo(cfg.Blockchain.ForceResetHeight)); err != nil {
 		logger.Fatal().Err(err).Msg("failed to initialize DB")
 		panic(err)
 	}
-
+	if err = cs.restoreStateSyncPoint(); err != nil {
+		logger.Fatal().Err(err).Msg("failed to restore state sync point")
+		panic(err)
+	}
 	if err = Init(cfg.Blockchain.MaxBlockSize,
 		cfg.Blockchain.CoinbaseAccount,
 		cfg.Consensus.EnableBp,
@@ -271,6 +314,15 @@ func NewChainService(cfg *cfg.Config) *ChainService {
 		panic(msg)
 	}
 
+	if cfg.Blockchain.PipelineCommit {
+		// raft can't roll back the best block at restart, since it is behind the applied index of raft then
+		if ConsensusName() == consensus.ConsensusName[consensus.ConsensusRAFT] {
+			logger.Warn().Msg("pipelined commit is ignored for raft consensus")
+		} else {
+			cs.sdb.EnablePipelinedCommit()
+		}
+	}
+
 	if ConsensusName() == consensus.ConsensusName[consensus.ConsensusDPOS] {
 		top, err := cs.getVotes(types.OpvoteBP.ID(), 1)
 		if err != nil {
@@ -464,6 +516,10 @@ func (cs *ChainService) Receive(context actor.Context) {
 			Block: block,
 			Err:   err,
 		})
+	case *message.SetStateSyncPoint:
+		context.Respond(&message.SetStateSyncPointRsp{
+			Err: cs.SetStateSyncPoint(msg.No, msg.Hash, msg.Root),
+		})
 	case *message.MemPoolDelRsp:
 		err := msg.Err
 		if err != nil {
@@ -484,10 +540,12 @@ func (cs *ChainService) Statistics() *map[string]interface{} {
 		return cs.chainVerifier.Statistics()
 	}
 	return &map[string]interface{}{
-		"testmode": cs.cfg.EnableTestmode,
-		"testnet":  cs.cfg.UseTestnet,
-		"orphan":   cs.op.curCnt,
-		"config":   cs.cfg.Blockchain,
+		"testmode":       cs.cfg.EnableTestmode,
+		"testnet":        cs.cfg.UseTestnet,
+		"orphan":         cs.op.curCnt,
+		"config":         cs.cfg.Blockchain,
+		"storage_cache":  state.StorageNodeCacheStats(),
+		"state_snapshot": cs.sdb.SnapshotStats(),
 	}
 }
 
@@ -650,7 +708,11 @@ func (cm *ChainManager) Receive(context actor.Context) {
 				cm.TellTo(message.MemPoolSvc, &message.MemPoolDelTx{Tx: timeoutTx.GetTx()})
 			}
 		}
+		if msg.Diff != nil {
+			pendingDiff.set(block, msg.Diff.(*state.BlockDiff))
+		}
 		err := cm.addBlock(block, bstate, msg.PeerID)
+		pendingDiff.clear()
 		if err != nil {
 			logger.Error().Err(err).Uint64("no", block.GetHeader().BlockNo).Str("hash", block.ID()).Msg("failed to add block")
 		}
@@ -817,6 +879,7 @@ func (cw *ChainWorker) Receive(context actor.Context) {
 		}
 	case *message.GetStateQuery:
 		var varProofs []*types.ContractVarProof
+		var varMultiProof *types.ContractVarMultiProof
 		var contractProof *types.AccountProof
 		var err error
 
@@ -833,6 +896,12 @@ func (cw *ChainWorker) Receive(context actor.Context) {
 		contractProof, err = sdb.GetAccountAndProof(id[:], msg.Root, msg.Compressed)
 		if err != nil {
 			logger.Error().Str("hash", enc.ToString(address)).Err(err).Msg("failed to get state for account")
+		} else if contractProof.Inclusion && msg.MultiProof && len(msg.StorageKeys) > 0 {
+			contractTrieRoot := contractProof.State.StorageRoot
+			varMultiProof, err = sdb.GetVarsAndMultiProof(msg.StorageKeys, contractTrieRoot)
+			if err != nil {
+				logger.Error().Str("hash", enc.ToString(address)).Err(err).Msg("failed to get state variables in contract")
+			}
 		} else if contractProof.Inclusion {
 			contractTrieRoot := contractProof.State.StorageRoot
 			for _, storageKey := range msg.StorageKeys {
@@ -848,6 +917,7 @@ func (cw *ChainWorker) Receive(context actor.Context) {
 		stateQuery := &types.StateQueryProof{
 			ContractProof: contractProof,
 			VarProofs:     varProofs,
+			VarMultiProof: varMultiProof,
 		}
 		context.Respond(message.GetStateQueryRsp{
 			Result: stateQuery,
@@ -0,0 +1,167 @@
+/**
+ *  @file
+ *  @copyright defined in aergo/LICENSE.txt
+ */
+
+package chain
+
+import (
+	"bytes"
+	"encoding/binary"
+
+	"github.com/aergoio/aergo-lib/db"
+	"github.com/aergoio/aergo/internal/common"
+	"github.com/aergoio/aergo/internal/enc"
+	"github.com/aergoio/aergo/types"
+)
+
+// Events are indexed by (contract address, block no, tx index, event index) and by
+// (contract address, event name, block no, tx index, event index), so that events of a contract are
+// listed by a range scan of the index instead of loading receipts of every block in range.
+// The value of an index entry is the hash of the block. Entries of blocks on the other branch
+// may remain until the old receipts are deleted in reorganization, so the hash must be checked
+// against the main chain.
+var (
+	eventIndexPrefix     = []byte("ev.")
+	eventNameIndexPrefix = []byte("evn.")
+	// eventBlockPrefix + block hash -> index keys written by the block
+	eventBlockPrefix = []byte("ev_blk.")
+	// eventIndexFromKey has the first block no which events are indexed. Blocks executed before
+	// the event index was introduced must be scanned. A new chain is indexed from block 1.
+	eventIndexFromKey = []byte("ev_from")
+)
+
+const (
+	eventNameHashLen = 8
+	eventPosLen      = 8 + 4 + 4
+)
+
+type eventIndexEntry struct {
+	blockNo   types.BlockNo
+	blockHash []byte
+	txIdx     int32
+	// eventIdx is the position of the event in the receipt
+	eventIdx int32
+}
+
+func eventIndexAddress(address []byte) []byte {
+	if len(address) < types.AddressLength {
+		return types.AddressPadding(address)
+	}
+	return address
+}
+
+func eventIndexPrefixOf(address []byte, eventName string) []byte {
+	var key bytes.Buffer
+	if len(eventName) == 0 {
+		key.Write(eventIndexPrefix)
+		key.Write(eventIndexAddress(address))
+	} else {
+		key.Write(eventNameIndexPrefix)
+		key.Write(eventIndexAddress(address))
+		key.Write(common.Hasher([]byte(eventName))[:eventNameHashLen])
+	}
+	return key.Bytes()
+}
+
+func eventIndexKey(prefix []byte, blockNo types.BlockNo, txIdx, eventIdx int32) []byte {
+	key := make([]byte, len(prefix)+eventPosLen)
+	n := copy(key, prefix)
+	binary.BigEndian.PutUint64(key[n:], blockNo)
+	binary.BigEndian.PutUint32(key[n+8:], uint32(txIdx))
+	binary.BigEndian.PutUint32(key[n+12:], uint32(eventIdx))
+	return key
+}
+
+func eventBlockKey(blockHash []byte) []byte {
+	return append(append([]byte{}, eventBlockPrefix...), blockHash...)
+}
+
+// writeEventIndex adds index entries of events in receipts to dbTx.
+func (cdb *ChainDB) writeEventIndex(dbTx db.Transaction, blockHash []byte, blockNo types.BlockNo, receipts *types.Receipts) {
+	if len(cdb.store.Get(eventIndexFromKey)) == 0 {
+		dbTx.Set(eventIndexFromKey, types.BlockNoToBytes(blockNo))
+	}
+
+	var written bytes.Buffer
+	for txIdx, r := range receipts.Get() {
+		for evIdx, ev := range r.Events {
+			for _, prefix := range [][]byte{eventIndexPrefixOf(ev.ContractAddress, ""),
+				eventIndexPrefixOf(ev.ContractAddress, ev.EventName)} {
+				key := eventIndexKey(prefix, blockNo, int32(txIdx), int32(evIdx))
+				dbTx.Set(key, blockHash)
+				written.WriteByte(byte(len(key)))
+				written.Write(key)
+			}
+		}
+	}
+	if written.Len() > 0 {
+		dbTx.Set(eventBlockKey(blockHash), written.Bytes())
+	}
+}
+
+// deleteEventIndex removes index entries written by the block. An entry is kept if it was overwritten
+// by a block of the new branch at the same height.
+func (cdb *ChainDB) deleteEventIndex(dbTx *db.Transaction, blockHash []byte) {
+	blockKey := eventBlockKey(blockHash)
+	written := cdb.store.Get(blockKey)
+	for len(written) > 0 {
+		keyLen := int(written[0])
+		if len(written) < 1+keyLen {
+			logger.Error().Str("hash", enc.ToString(blockHash)).Msg("invalid event index of block")
+			break
+		}
+		key := written[1 : 1+keyLen]
+		if bytes.Equal(cdb.store.Get(key), blockHash) {
+			(*dbTx).Delete(key)
+		}
+		written = written[1+keyLen:]
+	}
+	(*dbTx).Delete(blockKey)
+}
+
+// getEventIndexFrom returns the first block no which events are indexed. ok is false if no event is indexed yet.
+func (cdb *ChainDB) getEventIndexFrom() (blockNo types.BlockNo, ok bool) {
+	data := cdb.store.Get(eventIndexFromKey)
+	if len(data) == 0 {
+		return 0, false
+	}
+	return types.BlockNoFromBytes(data), true
+}
+
+// isEventIndexed returns whether events of blocks from block no from are all indexed. The genesis block has
+// no events, so the index which starts at block 1 covers a query from the genesis block.
+func (cdb *ChainDB) isEventIndexed(from types.BlockNo) bool {
+	indexFrom, ok := cdb.getEventIndexFrom()
+	if !ok {
+		return false
+	}
+	if from == 0 {
+		from = 1
+	}
+	return from >= indexFrom
+}
+
+// getEventIndex returns index entries of events of the contract from block no from to block no to, in
+// ascending order. All events of the contract are returned if eventName is empty.
+func (cdb *ChainDB) getEventIndex(address []byte, eventName string, from, to types.BlockNo) []eventIndexEntry {
+	prefix := eventIndexPrefixOf(address, eventName)
+	start := eventIndexKey(prefix, from, 0, 0)
+	end := eventIndexKey(prefix, to+1, 0, 0)
+
+	var entries []eventIndexEntry
+	for iter := cdb.store.Iterator(start, end); iter.Valid(); iter.Next() {
+		key := iter.Key()
+		if len(key) != len(prefix)+eventPosLen || !bytes.HasPrefix(key, prefix) {
+			continue
+		}
+		pos := key[len(prefix):]
+		entries = append(entries, eventIndexEntry{
+			blockNo:   binary.BigEndian.Uint64(pos),
+			blockHash: append([]byte{}, iter.Value()...),
+			txIdx:     int32(binary.BigEndian.Uint32(pos[8:])),
+			eventIdx:  int32(binary.BigEndian.Uint32(pos[12:])),
+		})
+	}
+	return entries
+}
@@ -0,0 +1,135 @@
+/**
+ *  @file
+ *  @copyright defined in aergo/LICENSE.txt
+ */
+package chain
+
+import (
+	"fmt"
+	"io/ioutil"
+	"os"
+	"testing"
+
+	"github.com/aergoio/aergo-lib/db"
+	"github.com/aergoio/aergo/config"
+	"github.com/aergoio/aergo/state"
+	"github.com/aergoio/aergo/types"
+	"github.com/stretchr/testify/assert"
+)
+
+func makeEventTestReceipts(contract []byte, names ...string) *types.Receipts {
+	r := types.NewReceipt(contract, "SUCCESS", "{}")
+	r.TxHash = make([]byte, 32)
+	for _, name := range names {
+		r.Events = append(r.Events, &types.Event{ContractAddress: contract, EventName: name})
+	}
+	receipts := &types.Receipts{}
+	receipts.SetHardFork(config.AllEnabledHardforkConfig, 1)
+	first := types.NewReceipt(contract, "SUCCESS", "{}")
+	first.TxHash = make([]byte, 32)
+	receipts.Set([]*types.Receipt{first, r})
+	return receipts
+}
+
+func TestEventIndex(t *testing.T) {
+	tmpdir, _ := ioutil.TempDir("", "eventindex")
+	defer os.RemoveAll(tmpdir)
+	cdb := NewChainDB()
+	cdb.store = db.NewDB(db.BadgerImpl, tmpdir)
+	defer cdb.store.Close()
+
+	contract := types.AddressPadding([]byte("contract"))
+	other := types.AddressPadding([]byte("other"))
+	_, ok := cdb.getEventIndexFrom()
+	assert.False(t, ok)
+
+	cdb.writeReceipts([]byte("hash1"), 1, makeEventTestReceipts(contract, "transfer", "approve"))
+	cdb.writeReceipts([]byte("hash2"), 2, makeEventTestReceipts(other, "transfer"))
+	cdb.writeReceipts([]byte("hash3"), 3, makeEventTestReceipts(contract, "transfer"))
+	from, ok := cdb.getEventIndexFrom()
+	assert.True(t, ok)
+	assert.Equal(t, types.BlockNo(1), from)
+
+	entries := cdb.getEventIndex(contract, "", 0, 10)
+	assert.Equal(t, []eventIndexEntry{
+		{blockNo: 1, blockHash: []byte("hash1"), txIdx: 1, eventIdx: 0},
+		{blockNo: 1, blockHash: []byte("hash1"), txIdx: 1, eventIdx: 1},
+		{blockNo: 3, blockHash: []byte("hash3"), txIdx: 1, eventIdx: 0},
+	}, entries)
+	assert.Equal(t, 2, len(cdb.getEventIndex(contract, "transfer", 0, 10)))
+	assert.Equal(t, 1, len(cdb.getEventIndex(contract, "approve", 0, 10)))
+	assert.Equal(t, 0, len(cdb.getEventIndex(contract, "unknown", 0, 10)))
+	assert.Equal(t, 1, len(cdb.getEventIndex(contract, "transfer", 2, 3)))
+	assert.Equal(t, 1, len(cdb.getEventIndex(other, "", 0, 10)))
+
+	// block of new branch at the same height is indexed before old receipts are deleted in reorganization
+	cdb.writeReceipts([]byte("hash3'"), 3, makeEventTestReceipts(contract, "transfer"))
+	dbTx := cdb.NewTx()
+	cdb.deleteReceipts(&dbTx, []byte("hash3"), 3)
+	cdb.deleteReceipts(&dbTx, []byte("hash1"), 1)
+	dbTx.Commit()
+	entries = cdb.getEventIndex(contract, "transfer", 0, 10)
+	assert.Equal(t, []eventIndexEntry{{blockNo: 3, blockHash: []byte("hash3'"), txIdx: 1, eventIdx: 0}}, entries)
+	assert.Equal(t, 1, len(cdb.getEventIndex(contract, "", 0, 10)))
+	assert.Equal(t, 0, len(cdb.getEventIndex(contract, "approve", 0, 10)))
+}
+
+func makeBlockEventTestReceipts(contract []byte, blockNo types.BlockNo, txEvents ...[]string) *types.Receipts {
+	bs := state.NewBlockState(&state.StateDB{})
+	for _, names := range txEvents {
+		r := types.NewReceipt(contract, "SUCCESS", "{}")
+		r.TxHash = make([]byte, 32)
+		for _, name := range names {
+			r.Events = append(r.Events, &types.Event{ContractAddress: contract, EventName: name, JsonArgs: "[]"})
+		}
+		bs.AddReceipt(r)
+	}
+	receipts := bs.Receipts()
+	receipts.SetHardFork(config.AllEnabledHardforkConfig, blockNo)
+	return receipts
+}
+
+func TestListEventsDesc(t *testing.T) {
+	tmpdir, _ := ioutil.TempDir("", "eventindex")
+	defer os.RemoveAll(tmpdir)
+	cdb := NewChainDB()
+	cdb.store = db.NewDB(db.BadgerImpl, tmpdir)
+	defer cdb.store.Close()
+	cs := &ChainService{Core: &Core{cdb: cdb}, cfg: &config.Config{Hardfork: config.AllEnabledHardforkConfig}}
+
+	contract := types.AddressPadding([]byte("contract"))
+	other := types.AddressPadding([]byte("other"))
+	blocks := []*types.Receipts{
+		makeBlockEventTestReceipts(contract, 1, []string{"e1", "e2"}, []string{"e3"}),
+		makeBlockEventTestReceipts(other, 2, []string{"o1"}),
+		makeBlockEventTestReceipts(contract, 3, []string{"e4", "e5"}),
+	}
+	for i, receipts := range blocks {
+		no := types.BlockNo(i + 1)
+		hash := []byte(fmt.Sprintf("hash%d", no))
+		cdb.store.Set(types.BlockNoToBytes(no), hash)
+		cdb.writeReceipts(hash, no, receipts)
+	}
+
+	listDesc := func() []string {
+		events, err := cs.listEvents(&types.FilterInfo{ContractAddress: contract, Blockfrom: 0, Blockto: 3, Desc: true})
+		assert.NoError(t, err)
+		var names []string
+		for _, e := range events {
+			names = append(names, fmt.Sprintf("%d/%d/%s", e.BlockNo, e.TxIndex, e.EventName))
+		}
+		return names
+	}
+	expected := []string{"3/0/e4", "3/0/e5", "1/0/e1", "1/0/e2", "1/1/e3"}
+
+	// a query from the genesis block is served by the index of a chain indexed from block 1
+	assert.True(t, cdb.isEventIndexed(0))
+	assert.Equal(t, expected, listDesc())
+
+	// blocks below the first indexed block are scanned, and events are listed in the same order
+	cdb.store.Set(eventIndexFromKey, types.BlockNoToBytes(2))
+	assert.False(t, cdb.isEventIndexed(0))
+	assert.False(t, cdb.isEventIndexed(1))
+	assert.True(t, cdb.isEventIndexed(2))
+	assert.Equal(t, expected, listDesc())
+}
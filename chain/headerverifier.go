@@ -0,0 +1,82 @@
+package chain
+
+import (
+	"errors"
+	"sync"
+
+	"github.com/aergoio/aergo/types"
+)
+
+var (
+	ErrBlockHeaderTimestamp = errors.New("invalid timestamp of block header")
+
+	// preVerifiedHeaders keeps hashes of block headers which are verified by syncer before their blocks are
+	// fetched. Signatures of the blocks are not verified again when they are connected.
+	preVerifiedHeaders = newPreVerifiedBlocks(MaxPreVerifiedHeaders)
+	// MaxPreVerifiedHeaders is the maximum number of pre-verified headers kept until their blocks are connected
+	MaxPreVerifiedHeaders = 20000
+)
+
+// preVerifiedBlocks is a set of block hashes. The hash of a block is calculated again from its header to be looked
+// up, since the hash field of a block received from peers is not trusted.
+type preVerifiedBlocks struct {
+	sync.Mutex
+	hashes map[types.BlockID]struct{}
+	limit  int
+}
+
+func newPreVerifiedBlocks(limit int) *preVerifiedBlocks {
+	return &preVerifiedBlocks{hashes: make(map[types.BlockID]struct{}), limit: limit}
+}
+
+func headerHash(header *types.BlockHeader) types.BlockID {
+	return (&types.Block{Header: header}).BlockID()
+}
+
+func (p *preVerifiedBlocks) add(id types.BlockID) {
+	p.Lock()
+	defer p.Unlock()
+	// headers over limit are just verified again
+	if len(p.hashes) < p.limit {
+		p.hashes[id] = struct{}{}
+	}
+}
+
+func (p *preVerifiedBlocks) take(block *types.Block) bool {
+	p.Lock()
+	defer p.Unlock()
+	if len(p.hashes) == 0 {
+		return false
+	}
+	id := headerHash(block.GetHeader())
+	_, ok := p.hashes[id]
+	if ok {
+		delete(p.hashes, id)
+	}
+	return ok
+}
+
+func (p *preVerifiedBlocks) reset() {
+	p.Lock()
+	defer p.Unlock()
+	p.hashes = make(map[types.BlockID]struct{})
+}
+
+// PreVerifyBlockHeader verifies the timestamp and the signature of a block header by consensus, before the block
+// is fetched. It can be called concurrently. The signature of the block is not verified again when it is connected.
+func (cs *ChainService) PreVerifyBlockHeader(header *types.BlockHeader) error {
+	block := &types.Block{Header: header}
+	if !cs.VerifyTimestamp(block) {
+		return ErrBlockHeaderTimestamp
+	}
+	if err := cs.VerifySign(block); err != nil {
+		return err
+	}
+	preVerifiedHeaders.add(block.BlockID())
+	return nil
+}
+
+// ResetPreVerifiedHeaders drops pre-verified headers whose blocks are not going to be connected.
+func ResetPreVerifiedHeaders() {
+	preVerifiedHeaders.reset()
+}
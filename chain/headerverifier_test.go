@@ -0,0 +1,26 @@
+package chain
+
+import (
+	"testing"
+
+	"github.com/aergoio/aergo/types"
+	"github.com/stretchr/testify/assert"
+)
+
+func TestPreVerifiedBlocks(t *testing.T) {
+	set := newPreVerifiedBlocks(1)
+	header := &types.BlockHeader{BlockNo: 1, Sign: []byte("sign")}
+	set.add(headerHash(header))
+	// over limit
+	set.add(headerHash(&types.BlockHeader{BlockNo: 2}))
+
+	// a block with the same hash but a different header is not pre-verified
+	id := headerHash(header)
+	forged := &types.Block{Hash: id[:], Header: &types.BlockHeader{BlockNo: 1, Sign: []byte("forged")}}
+	assert.False(t, set.take(forged))
+
+	block := &types.Block{Header: &types.BlockHeader{BlockNo: 1, Sign: []byte("sign")}}
+	assert.True(t, set.take(block))
+	assert.False(t, set.take(block))
+	assert.False(t, set.take(&types.Block{Header: &types.BlockHeader{BlockNo: 2}}))
+}
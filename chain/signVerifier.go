@@ -2,6 +2,7 @@ package chain
 
 import (
 	"errors"
+	"sync"
 	"time"
 
 	"github.com/aergoio/aergo-actor/actor"
@@ -50,8 +51,73 @@ var (
 	ErrTxFormatInvalid = errors.New("tx invalid format")
 	dfltUseMempool     = true
 	//logger = log.NewLogger("signverifier")
+
+	// preVerified keeps txs whose signatures are verified before their block is validated, like txs in blocks
+	// fetched by syncer ahead of the block being connected.
+	preVerified = newPreVerifiedTxs(MaxPreVerifiedTxs)
+	// MaxPreVerifiedTxs is the maximum number of pre-verified txs kept until their blocks are validated
+	MaxPreVerifiedTxs = 200000
 )
 
+// preVerifiedTxs is a set of tx objects. It is keyed by pointer, so that a tx is verified again if its block
+// is decoded again from another message.
+type preVerifiedTxs struct {
+	sync.Mutex
+	txs   map[*types.Tx]struct{}
+	limit int
+}
+
+func newPreVerifiedTxs(limit int) *preVerifiedTxs {
+	return &preVerifiedTxs{txs: make(map[*types.Tx]struct{}), limit: limit}
+}
+
+func (p *preVerifiedTxs) add(tx *types.Tx) {
+	p.Lock()
+	defer p.Unlock()
+	// txs over limit are just verified again
+	if len(p.txs) < p.limit {
+		p.txs[tx] = struct{}{}
+	}
+}
+
+func (p *preVerifiedTxs) take(tx *types.Tx) bool {
+	p.Lock()
+	defer p.Unlock()
+	_, ok := p.txs[tx]
+	if ok {
+		delete(p.txs, tx)
+	}
+	return ok
+}
+
+func (p *preVerifiedTxs) reset() {
+	p.Lock()
+	defer p.Unlock()
+	p.txs = make(map[*types.Tx]struct{})
+}
+
+// PreVerifyTx verifies the signature of tx before its block is requested to be connected. The block validator
+// skips verification of tx if it succeeded. Txs of name accounts are not verified, since their owners depend on
+// the state when the block is executed.
+func PreVerifyTx(tx *types.Tx) error {
+	if tx.GetBody().GetAccount() == nil {
+		return ErrTxFormatInvalid
+	}
+	if tx.NeedNameVerify() {
+		return nil
+	}
+	if err := key.VerifyTx(tx); err != nil {
+		return err
+	}
+	preVerified.add(tx)
+	return nil
+}
+
+// ResetPreVerifiedTxs drops pre-verified txs whose blocks are not going to be connected.
+func ResetPreVerifiedTxs() {
+	preVerified.reset()
+}
+
 func NewSignVerifier(comm component.IComponentRequester, sdb *state.ChainStateDB, workerCnt int, useMempool bool) *SignVerifier {
 	sv := &SignVerifier{
 		comm:       comm,
@@ -122,6 +188,10 @@ func (sv *SignVerifier) verifyTx(comm component.IComponentRequester, tx *types.T
 		return false, ErrTxFormatInvalid
 	}
 
+	if preVerified.take(tx) {
+		return true, nil
+	}
+
 	if useMempool {
 		if hit, err = sv.isExistInMempool(comm, tx); err != nil {
 			return false, err
@@ -113,6 +113,32 @@ func TestInvalidTransactions(t *testing.T) {
 	}
 }
 
+func TestPreVerifyTx(t *testing.T) {
+	beforeTest(10)
+	defer ResetPreVerifiedTxs()
+
+	valid := genTx(0, 1, 1, 1)
+	invalid := genTx(0, 1, 2, 1)
+	invalid.Body.Amount = new(big.Int).SetUint64(999999).Bytes()
+
+	assert.NoError(t, PreVerifyTx(valid))
+	assert.Equal(t, types.ErrSignNotMatch, PreVerifyTx(invalid))
+
+	// pre-verified tx is verified only once
+	hit, err := verifier.verifyTx(nil, valid, false)
+	assert.NoError(t, err)
+	assert.True(t, hit)
+	hit, err = verifier.verifyTx(nil, valid, false)
+	assert.NoError(t, err)
+	assert.False(t, hit)
+
+	// the same tx decoded again is verified
+	copied := *valid
+	assert.NoError(t, PreVerifyTx(valid))
+	hit, _ = verifier.verifyTx(nil, &copied, false)
+	assert.False(t, hit)
+}
+
 // gen sequential transactions
 // bench
 func TestVerifyValidTxs(t *testing.T) {
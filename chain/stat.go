@@ -5,6 +5,7 @@ import (
 	"sync"
 	"time"
 
+	"github.com/aergoio/aergo/state"
 	"github.com/aergoio/aergo/types"
 )
 
@@ -18,6 +19,8 @@ const (
 
 	// ReorgStat is a constant representing a stat about reorganization.
 	ReorgStat statIndex = iota
+	// AccessStat is a constant representing a stat about state access of txs in executed blocks.
+	AccessStat
 	// MaxStat is a constant representing a value less than which all the
 	// constants corresponding chain stats must be.
 	MaxStat
@@ -28,7 +31,8 @@ var (
 	// its constructor here. Additionally you need to add a constant
 	// corresponding to its index like statReorg above.
 	statItemCtors = map[statIndex]func() statItem{
-		ReorgStat: newStReorg,
+		ReorgStat:  newStReorg,
+		AccessStat: newStAccess,
 	}
 )
 
@@ -159,3 +163,58 @@ func (sr *stReorg) clone() interface{} {
 
 	return &c
 }
+
+// stAccess accumulates access patterns of txs in blocks executed with access recording.
+type stAccess struct {
+	Blocks int64
+	Total  state.AccessStats
+	Latest *evAccess `json:",omitempty"`
+}
+
+type evAccess struct {
+	Block *blockInfo
+	state.AccessStats
+}
+
+func newStAccess() statItem {
+	return &stAccess{}
+}
+
+func (sa *stAccess) updateEvent(args ...interface{}) {
+	if len(args) != 2 {
+		logger.Info().Int("len", len(args)).Msg("invalid # of arguments for the access stat update")
+		return
+	}
+	block, ok := args[0].(*types.Block)
+	if !ok {
+		logger.Info().Msg("invalid type of argument")
+		return
+	}
+	as, ok := args[1].(*state.AccessStats)
+	if !ok {
+		logger.Info().Msg("invalid type of argument")
+		return
+	}
+
+	sa.Latest = &evAccess{Block: &blockInfo{Hash: block.ID(), Height: block.BlockNo()}, AccessStats: *as}
+	sa.Blocks++
+	sa.Total.Txs += as.Txs
+	sa.Total.Reads += as.Reads
+	sa.Total.Writes += as.Writes
+	sa.Total.Accounts += as.Accounts
+	sa.Total.StorageKeys += as.StorageKeys
+	sa.Total.DependentTxs += as.DependentTxs
+	if as.MaxWriters > sa.Total.MaxWriters {
+		sa.Total.MaxWriters = as.MaxWriters
+	}
+}
+
+func (sa *stAccess) clone() interface{} {
+	c := *sa
+	if sa.Latest != nil {
+		l := *sa.Latest
+		c.Latest = &l
+	}
+
+	return &c
+}
@@ -0,0 +1,282 @@
+/**
+ *  @file
+ *  @copyright defined in aergo/LICENSE.txt
+ */
+
+package chain
+
+import (
+	"bytes"
+	"errors"
+	"io"
+	"os"
+	"sync"
+	"time"
+
+	"github.com/aergoio/aergo/contract"
+	"github.com/aergoio/aergo/internal/enc"
+	"github.com/aergoio/aergo/types"
+	"github.com/golang/protobuf/proto"
+)
+
+var (
+	// MaxStateChunkSize is the maximum number of trie leaves in a response to peers syncing state
+	MaxStateChunkSize = 4096
+	// MaxStateSQLChunkSize is the maximum bytes of a sql database in a response to peers syncing state
+	MaxStateSQLChunkSize = 1 << 20
+	// MaxStateSQLSnapshots is the number of snapshots of sql databases kept to serve peers syncing state
+	MaxStateSQLSnapshots = 16
+
+	errStateSQLSnapshot = errors.New("snapshot of sql database is not found")
+)
+
+var _ types.StateChunkReader = (*ChainService)(nil)
+
+// GetStateChunk reads leaves of a state trie to be sent to a peer which syncs state. Only states of finalized
+// roots are served, and a contract storage only if it belongs to the account in a finalized state. The number of
+// leaves is reduced if the response is larger than a p2p message.
+func (cs *ChainService) GetStateChunk(req *types.GetStateChunkRequest) *types.GetStateChunkResponse {
+	if req.Sql {
+		return cs.getStateSQLChunk(req)
+	}
+	if req.Accounts && !cs.sdb.IsStateImported(req.Root) ||
+		!req.Accounts && !cs.sdb.IsStorageImported(req.StateRoot, req.Account, req.Root) {
+		return &types.GetStateChunkResponse{Status: types.ResultStatus_NOT_FOUND}
+	}
+	limit := int(req.Limit)
+	if limit <= 0 || limit > MaxStateChunkSize {
+		limit = MaxStateChunkSize
+	}
+
+	for ; limit > 0; limit /= 2 {
+		chunk, err := cs.sdb.GetStateChunk(req.Root, req.Start, req.End, limit, req.Accounts)
+		if err != nil {
+			logger.Debug().Err(err).Str("root", enc.ToString(req.Root)).Msg("failed to read state chunk")
+			return &types.GetStateChunkResponse{Status: types.ResultStatus_NOT_FOUND}
+		}
+		resp := &types.GetStateChunkResponse{
+			Status: types.ResultStatus_OK,
+			Keys:   chunk.Keys,
+			Values: chunk.Values,
+			Codes:  chunk.Codes,
+			Next:   chunk.Next,
+			Proof:  chunk.Proof,
+		}
+		if uint32(proto.Size(resp)) <= types.MaxMessageSize() || len(chunk.Keys) <= 1 {
+			return resp
+		}
+	}
+	return &types.GetStateChunkResponse{Status: types.ResultStatus_RESOURCE_EXHAUSTED}
+}
+
+// getStateSQLChunk reads the sql database of a contract in a finalized state from the requested offset. The
+// database is changed by new blocks, so it is read from a snapshot made at the first request.
+func (cs *ChainService) getStateSQLChunk(req *types.GetStateChunkRequest) *types.GetStateChunkResponse {
+	notFound := &types.GetStateChunkResponse{Status: types.ResultStatus_NOT_FOUND}
+	if len(req.Account) != types.HashIDLength || !cs.sdb.IsStateImported(req.StateRoot) {
+		return notFound
+	}
+	id := types.AccountID(types.ToHashID(req.Account))
+	st, err := cs.sdb.OpenNewStateDB(req.StateRoot).GetState(id)
+	if err != nil || st == nil || st.SqlRecoveryPoint <= 1 {
+		return notFound
+	}
+
+	snapshot, err := cs.sqlSnapshots.get(req.StateRoot, id, req.Snapshot)
+	if err == nil {
+		var data []byte
+		if data, err = snapshot.read(req.Offset, MaxStateSQLChunkSize); err == nil {
+			return &types.GetStateChunkResponse{
+				Status:   types.ResultStatus_OK,
+				SqlData:  data,
+				SqlSize:  uint64(snapshot.size),
+				Snapshot: snapshot.id,
+			}
+		}
+	}
+	logger.Debug().Err(err).Str("account", id.String()).Uint64("snapshot", req.Snapshot).
+		Msg("failed to read sql database")
+	return notFound
+}
+
+// stateSQLSnapshot is a copy of a sql database served to peers syncing state
+type stateSQLSnapshot struct {
+	key  string
+	id   uint64
+	path string
+	size int64
+}
+
+func (s *stateSQLSnapshot) read(offset uint64, limit int) ([]byte, error) {
+	if offset > uint64(s.size) {
+		return nil, io.ErrUnexpectedEOF
+	}
+	if remain := uint64(s.size) - offset; remain < uint64(limit) {
+		limit = int(remain)
+	}
+	f, err := os.Open(s.path)
+	if err != nil {
+		return nil, err
+	}
+	defer f.Close()
+
+	data := make([]byte, limit)
+	if _, err = f.ReadAt(data, int64(offset)); err != nil {
+		return nil, err
+	}
+	return data, nil
+}
+
+// stateSQLSnapshots are snapshots of sql databases kept for peers which read them by chunks. The oldest one is
+// removed when more than MaxStateSQLSnapshots are made.
+type stateSQLSnapshots struct {
+	sync.Mutex
+	list []*stateSQLSnapshot
+}
+
+// get returns the snapshot of the database of account for stateRoot. A new snapshot is made if id is 0 and there
+// is none, and id must be the one of the existing snapshot otherwise.
+func (ss *stateSQLSnapshots) get(stateRoot []byte, account types.AccountID, id uint64) (*stateSQLSnapshot, error) {
+	ss.Lock()
+	defer ss.Unlock()
+
+	key := string(stateRoot) + string(account[:])
+	for _, s := range ss.list {
+		if s.key == key && (id == 0 || id == s.id) {
+			return s, nil
+		}
+	}
+	if id != 0 {
+		return nil, errStateSQLSnapshot
+	}
+
+	// the database is written only while a block is executed
+	InAddBlock <- struct{}{}
+	id = uint64(time.Now().UnixNano())
+	path, size, err := contract.SnapshotSQLDatabase(account, id)
+	<-InAddBlock
+	if err != nil {
+		return nil, err
+	}
+
+	s := &stateSQLSnapshot{key: key, id: id, path: path, size: size}
+	ss.list = append(ss.list, s)
+	if len(ss.list) > MaxStateSQLSnapshots {
+		_ = os.Remove(ss.list[0].path)
+		ss.list = ss.list[1:]
+	}
+	return s, nil
+}
+
+// ErrStateSyncPoint is returned if the state sync point is behind the chain, its state is not imported, or the
+// block at the point is not the expected one.
+var ErrStateSyncPoint = errors.New("invalid state sync point")
+
+// stateSyncPoint is a block whose state is imported by state sync. Blocks up to it are connected without
+// execution, since their states aren't needed to continue the chain from the point. It is kept in the chain db
+// until the block at the point is connected, because the states of blocks connected before are not in the state db.
+type stateSyncPoint struct {
+	No   types.BlockNo
+	Hash []byte
+	Root []byte
+}
+
+// SetStateSyncPoint makes blocks up to block no be connected without execution. The state of root must be
+// imported already, and it becomes the state of the chain when block no is connected.
+func (cs *ChainService) SetStateSyncPoint(no types.BlockNo, hash []byte, root []byte) error {
+	if no <= cs.getBestBlockNo() || !cs.sdb.IsStateImported(root) {
+		return ErrStateSyncPoint
+	}
+	point := &stateSyncPoint{No: no, Hash: hash, Root: root}
+	if err := cs.cdb.writeStateSyncPoint(point); err != nil {
+		return err
+	}
+	cs.syncPoint.Store(point)
+
+	logger.Info().Uint64("no", no).Str("hash", enc.ToString(hash)).Str("root", enc.ToString(root)).
+		Msg("set state sync point")
+	return nil
+}
+
+func (cs *ChainService) getStateSyncPoint() *stateSyncPoint {
+	point, _ := cs.syncPoint.Load().(*stateSyncPoint)
+	return point
+}
+
+// restoreStateSyncPoint resumes the state sync stopped before the block at the point was connected. The state
+// of the best block isn't in the state db then, so the state root is moved to the imported state.
+func (cs *ChainService) restoreStateSyncPoint() error {
+	point, err := cs.cdb.getStateSyncPoint()
+	if err != nil || point == nil {
+		return err
+	}
+
+	best, err := cs.cdb.GetBestBlock()
+	if err != nil {
+		return err
+	}
+	if best.BlockNo() >= point.No {
+		cs.cdb.deleteStateSyncPoint()
+		return nil
+	}
+	if !cs.sdb.IsStateImported(point.Root) {
+		return ErrStateSyncPoint
+	}
+	if !cs.sdb.IsStateImported(best.GetHeader().GetBlocksRootHash()) {
+		if err = cs.sdb.SetRoot(point.Root); err != nil {
+			return err
+		}
+	}
+	cs.syncPoint.Store(point)
+
+	logger.Info().Uint64("no", point.No).Str("hash", enc.ToString(point.Hash)).Uint64("best", best.BlockNo()).
+		Msg("restored state sync point")
+	return nil
+}
+
+// connectSyncedBlock replaces executeBlock for blocks up to the state sync point. Receipts and events of the
+// blocks are not made. The state root is moved to the imported state at the point.
+func (cs *ChainService) connectSyncedBlock(block *types.Block, point *stateSyncPoint) error {
+	bestBlock, err := cs.cdb.GetBestBlock()
+	if err != nil {
+		return err
+	}
+	if err = cs.IsBlockValid(block, bestBlock); err != nil {
+		return err
+	}
+
+	atPoint := block.BlockNo() == point.No
+	// the state root of the block at the point exists already, since it is imported
+	if atPoint {
+		err = cs.validator.ValidateBody(block)
+	} else {
+		err = cs.validator.ValidateBlock(block)
+	}
+	if err != nil {
+		return err
+	}
+	if err = cs.validator.WaitVerifyDone(); err != nil {
+		return err
+	}
+
+	if atPoint {
+		if !bytes.Equal(block.BlockHash(), point.Hash) || !bytes.Equal(block.GetHeader().GetBlocksRootHash(), point.Root) {
+			logger.Error().Uint64("no", point.No).Str("expected", enc.ToString(point.Hash)).Str("hash", block.ID()).
+				Msg("block at state sync point is different")
+			return ErrStateSyncPoint
+		}
+		if err = cs.sdb.SetRoot(point.Root); err != nil {
+			return err
+		}
+	}
+
+	cs.Update(block)
+
+	if atPoint {
+		cs.cdb.deleteStateSyncPoint()
+		cs.syncPoint.Store((*stateSyncPoint)(nil))
+		logger.Info().Uint64("no", point.No).Str("hash", block.ID()).Msg("reached state sync point")
+	}
+
+	return nil
+}
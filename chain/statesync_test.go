@@ -0,0 +1,132 @@
+/**
+ *  @file
+ *  @copyright defined in aergo/LICENSE.txt
+ */
+package chain
+
+import (
+	"math/big"
+	"testing"
+	"time"
+
+	"github.com/aergoio/aergo/types"
+	"github.com/stretchr/testify/assert"
+)
+
+// makeImportedTestState commits a state which has an account more than the current state, as state sync imports
+// it, and returns its root.
+func makeImportedTestState(t *testing.T, cs *ChainService, account string) []byte {
+	states := cs.sdb.OpenNewStateDB(cs.sdb.GetRoot())
+	err := states.PutState(types.ToAccountID([]byte(account)), &types.State{Balance: big.NewInt(1).Bytes()})
+	assert.NoError(t, err)
+	assert.NoError(t, states.Update())
+	assert.NoError(t, states.Commit())
+	assert.True(t, cs.sdb.IsStateImported(states.GetRoot()))
+	return states.GetRoot()
+}
+
+func makeSyncedTestBlock(prev *types.Block, root []byte) *types.Block {
+	bi := types.NewBlockHeaderInfoFromPrevBlock(prev, time.Now().UnixNano(), types.DummyBlockVersionner(0))
+	return types.NewBlock(bi, root, nil, nil, nil, nil)
+}
+
+func TestStateSyncPoint(t *testing.T) {
+	cs := makeBlockChain()
+	genesis, _ := cs.getBlockByNo(0)
+	genesisRoot := cs.sdb.GetRoot()
+	root := makeImportedTestState(t, cs, "synced")
+
+	// states of blocks below the point are not in the state db
+	block1 := makeSyncedTestBlock(genesis, []byte("root of block 1"))
+	block2 := makeSyncedTestBlock(block1, root)
+
+	assert.Equal(t, ErrStateSyncPoint, cs.SetStateSyncPoint(0, genesis.BlockHash(), genesisRoot))
+	assert.Equal(t, ErrStateSyncPoint, cs.SetStateSyncPoint(2, block2.BlockHash(), []byte("not imported")))
+	assert.NoError(t, cs.SetStateSyncPoint(2, block2.BlockHash(), root))
+
+	// a block below the point is still validated
+	invalid := makeSyncedTestBlock(genesis, []byte("root of block 1"))
+	invalid.Header.TxsRootHash = []byte("invalid tx root")
+	invalid.Hash = nil
+	assert.Equal(t, ErrorBlockVerifyTxRoot, cs.addBlock(invalid, nil, testPeer))
+	assert.Equal(t, types.BlockNo(0), cs.cdb.getBestBlockNo())
+
+	// and connected without execution, which would fail since its root is not the state of genesis
+	assert.NoError(t, cs.addBlock(block1, nil, testPeer))
+	testBlockIsOnMasterChain(t, cs, block1)
+	assert.Equal(t, genesisRoot, cs.sdb.GetRoot())
+	assert.False(t, cs.cdb.checkExistReceipts(block1.BlockHash(), block1.BlockNo()))
+
+	// the root moves to the imported state at the point, and the point is deleted
+	assert.NoError(t, cs.addBlock(block2, nil, testPeer))
+	testBlockIsOnMasterChain(t, cs, block2)
+	assert.Equal(t, root, cs.sdb.GetRoot())
+	assert.Nil(t, cs.getStateSyncPoint())
+	point, err := cs.cdb.getStateSyncPoint()
+	assert.NoError(t, err)
+	assert.Nil(t, point)
+}
+
+func TestStateSyncPointMismatch(t *testing.T) {
+	cs := makeBlockChain()
+	genesis, _ := cs.getBlockByNo(0)
+	genesisRoot := cs.sdb.GetRoot()
+	root := makeImportedTestState(t, cs, "synced")
+	other := makeImportedTestState(t, cs, "other")
+
+	expected := makeSyncedTestBlock(genesis, root)
+	wrongHash := makeSyncedTestBlock(genesis, root)
+	wrongHash.Header.Timestamp++
+	wrongHash.Hash = nil
+	assert.NoError(t, cs.SetStateSyncPoint(1, expected.BlockHash(), root))
+	assert.Equal(t, ErrStateSyncPoint, cs.addBlock(wrongHash, nil, testPeer))
+
+	wrongRoot := makeSyncedTestBlock(genesis, other)
+	assert.NoError(t, cs.SetStateSyncPoint(1, wrongRoot.BlockHash(), root))
+	assert.Equal(t, ErrStateSyncPoint, cs.addBlock(wrongRoot, nil, testPeer))
+
+	// the chain stays at genesis and waits for the block at the point
+	assert.Equal(t, types.BlockNo(0), cs.cdb.getBestBlockNo())
+	assert.Equal(t, genesisRoot, cs.sdb.GetRoot())
+	assert.NotNil(t, cs.getStateSyncPoint())
+}
+
+func TestRestoreStateSyncPoint(t *testing.T) {
+	cs := makeBlockChain()
+	genesis, _ := cs.getBlockByNo(0)
+	root := makeImportedTestState(t, cs, "synced")
+
+	block1 := makeSyncedTestBlock(genesis, []byte("root of block 1"))
+	block2 := makeSyncedTestBlock(block1, []byte("root of block 2"))
+	block3 := makeSyncedTestBlock(block2, root)
+	assert.NoError(t, cs.SetStateSyncPoint(3, block3.BlockHash(), root))
+	assert.NoError(t, cs.addBlock(block1, nil, testPeer))
+
+	// restart, which loads the state of the best block
+	restart := func() {
+		cs.syncPoint.Store((*stateSyncPoint)(nil))
+		best, err := cs.cdb.GetBestBlock()
+		assert.NoError(t, err)
+		assert.NoError(t, cs.sdb.SetRoot(best.GetHeader().GetBlocksRootHash()))
+		assert.NoError(t, cs.restoreStateSyncPoint())
+	}
+	restart()
+	point := cs.getStateSyncPoint()
+	assert.NotNil(t, point)
+	assert.Equal(t, types.BlockNo(3), point.No)
+	assert.Equal(t, block3.BlockHash(), point.Hash)
+	assert.Equal(t, root, cs.sdb.GetRoot())
+
+	assert.NoError(t, cs.addBlock(block2, nil, testPeer))
+	assert.NoError(t, cs.addBlock(block3, nil, testPeer))
+	assert.Equal(t, root, cs.sdb.GetRoot())
+
+	// a point reached before is removed
+	assert.NoError(t, cs.cdb.writeStateSyncPoint(&stateSyncPoint{No: 3, Hash: block3.BlockHash(), Root: root}))
+	restart()
+	assert.Nil(t, cs.getStateSyncPoint())
+	point, err := cs.cdb.getStateSyncPoint()
+	assert.NoError(t, err)
+	assert.Nil(t, point)
+	assert.Equal(t, root, cs.sdb.GetRoot())
+}
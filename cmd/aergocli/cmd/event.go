@@ -21,6 +21,8 @@ var start uint64
 var end uint64
 var desc bool
 var recentBlockCnt int32
+var eventOffset int32
+var eventLimit int32
 
 func init() {
 	eventCmd := &cobra.Command{
@@ -41,6 +43,8 @@ func init() {
 	listCmd.Flags().BoolVar(&desc, "desc", false, "descending order")
 	listCmd.Flags().StringVarP(&argFilter, "argfilter", "", "", "argument filter")
 	listCmd.Flags().Int32Var(&recentBlockCnt, "recent", 0, "recent block count")
+	listCmd.Flags().Int32Var(&eventOffset, "offset", 0, "number of events to skip")
+	listCmd.Flags().Int32Var(&eventLimit, "limit", 0, "maximum number of events (0 means no limit)")
 	listCmd.MarkFlagRequired("address")
 
 	streamCmd := &cobra.Command{
@@ -74,6 +78,8 @@ func execListEvent(cmd *cobra.Command, args []string) {
 		Desc:            desc,
 		ArgFilter:       []byte(argFilter),
 		RecentBlockCnt:  recentBlockCnt,
+		Offset:          eventOffset,
+		Limit:           eventLimit,
 	}
 
 	events, err := client.ListEvents(context.Background(), filter)
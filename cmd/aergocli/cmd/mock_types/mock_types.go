@@ -116,6 +116,26 @@ func (mr *MockAergoRPCServiceClientMockRecorder) CommitTX(arg0, arg1 interface{}
 	return mr.mock.ctrl.RecordCallWithMethodType(mr.mock, "CommitTX", reflect.TypeOf((*MockAergoRPCServiceClient)(nil).CommitTX), varargs...)
 }
 
+// CommitTXStream mocks base method
+func (m *MockAergoRPCServiceClient) CommitTXStream(arg0 context.Context, arg1 ...grpc.CallOption) (types.AergoRPCService_CommitTXStreamClient, error) {
+	m.ctrl.T.Helper()
+	varargs := []interface{}{arg0}
+	for _, a := range arg1 {
+		varargs = append(varargs, a)
+	}
+	ret := m.ctrl.Call(m, "CommitTXStream", varargs...)
+	ret0, _ := ret[0].(types.AergoRPCService_CommitTXStreamClient)
+	ret1, _ := ret[1].(error)
+	return ret0, ret1
+}
+
+// CommitTXStream indicates an expected call of CommitTXStream
+func (mr *MockAergoRPCServiceClientMockRecorder) CommitTXStream(arg0 interface{}, arg1 ...interface{}) *gomock.Call {
+	mr.mock.ctrl.T.Helper()
+	varargs := append([]interface{}{arg0}, arg1...)
+	return mr.mock.ctrl.RecordCallWithMethodType(mr.mock, "CommitTXStream", reflect.TypeOf((*MockAergoRPCServiceClient)(nil).CommitTXStream), varargs...)
+}
+
 // CreateAccount mocks base method
 func (m *MockAergoRPCServiceClient) CreateAccount(arg0 context.Context, arg1 *types.Personal, arg2 ...grpc.CallOption) (*types.Account, error) {
 	m.ctrl.T.Helper()
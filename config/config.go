@@ -75,6 +75,8 @@ func (ctx *ServerContext) GetDefaultRPCConfig() *RPCConfig {
 		NetServicePort:  7845,
 		NetServiceTrace: false,
 		NSKey:           "",
+		StreamQueueSize: 128,
+		StreamMaxDrops:  32,
 	}
 }
 
@@ -138,6 +140,9 @@ func (ctx *ServerContext) GetDefaultBlockchainConfig() *BlockchainConfig {
 		NumWorkers:       runtime.NumCPU(),
 		NumLStateClosers: GetDefaultNumLStateClosers(),
 		CloseLimit:       GetDefaultCloseLimit(),
+		StorageCacheSize: 64,
+		AccessStat:       false,
+		PipelineCommit:   false,
 	}
 }
 
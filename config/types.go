@@ -54,6 +54,9 @@ type RPCConfig struct {
 	NSKey       string `mapstructure:"nskey" description:"Private Key file for RPC or REST API"`
 	NSCACert    string `mapstructure:"nscacert" description:"CA Certificate file for RPC or REST API"`
 	NSAllowCORS bool   `mapstructure:"nsallowcors" description:"Allow CORS to RPC or REST API"`
+	// streams of blocks and events
+	StreamQueueSize int `mapstructure:"streamqueuesize" description:"Number of messages queued for a client of block or event stream"`
+	StreamMaxDrops  int `mapstructure:"streammaxdrops" description:"Number of messages dropped in a row before a slow stream is closed"`
 }
 
 // P2PConfig defines configurations for p2p service
@@ -110,6 +113,9 @@ type BlockchainConfig struct {
 	NumWorkers       int    `mapstructure:"numworkers" description:"maximum worker count for chainservice"`
 	NumLStateClosers int    `mapstructure:"numclosers" description:"maximum LuaVM state closer count for chainservice"`
 	CloseLimit       int    `mapstructure:"closelimit" description:"number of LuaVM states which a LuaVM state closer closes at one time"`
+	StorageCacheSize int    `mapstructure:"storagecachesize" description:"size in megabytes of the node cache shared by storage tries of contracts. 0 disables the cache"`
+	AccessStat       bool   `mapstructure:"accessstat" description:"record read and write sets of txs in executed blocks, and collect their access statistics"`
+	PipelineCommit   bool   `mapstructure:"pipelinecommit" description:"write states of a block to disk while the next block is executed. the best block is rolled back at restart if its states were not written. not for raft consensus"`
 }
 
 // MempoolConfig defines configurations for mempool service
@@ -127,6 +133,7 @@ type ConsensusConfig struct {
 	BlockInterval       int64       `mapstructure:"blockinterval" description:"block production interval (sec)"`
 	Raft                *RaftConfig `mapstructure:"raft"`
 	NoTimeoutTxEviction bool        `mapstructure:"notte" description:"disable timeout tx eviction"`
+	Speculation         bool        `mapstructure:"speculation" description:"enable pre-execution of the block for the next slot of BP"`
 }
 
 type RaftConfig struct {
@@ -142,6 +149,7 @@ type RaftConfig struct {
 	SlowNodeGap        uint          `mapstructure:"slownodegap" description:"frequency which raft make snapshot with log"`
 	RecoverBP          *RaftBPConfig `mapstructure:"recoverbp" description:"bp info for creating a new cluster from backup"`
 	StopDupCommit      bool          `mapstructure:"stopdupcommit" description:"stop server when commit of duplicate height block occurs. use this only for debugging'"`
+	ShipStateDiff      bool          `mapstructure:"shipstatediff" description:"ship state changes of block with it to apply instead of executing txs. use this only in a cluster of trusted members"`
 }
 
 type RaftBPConfig struct {
@@ -198,6 +206,8 @@ nscert = "{{.RPC.NSCert}}"
 nskey = "{{.RPC.NSKey}}"
 nscacert = "{{.RPC.NSCACert}}"
 nsallowcors = {{.RPC.NSAllowCORS}}
+streamqueuesize = {{.RPC.StreamQueueSize}}
+streammaxdrops = {{.RPC.StreamMaxDrops}}
 
 [p2p]
 # Set address and port to which the inbound peers connect, and don't set loopback address or private network unless used in local network 
@@ -238,6 +248,9 @@ forceresetheight = "{{.Blockchain.ForceResetHeight}}"
 numworkers = "{{.Blockchain.NumWorkers}}"
 numclosers = "{{.Blockchain.NumLStateClosers}}"
 closelimit = "{{.Blockchain.CloseLimit}}"
+storagecachesize = "{{.Blockchain.StorageCacheSize}}"
+accessstat = {{.Blockchain.AccessStat}}
+pipelinecommit = {{.Blockchain.PipelineCommit}}
 
 [mempool]
 showmetrics = {{.Mempool.ShowMetrics}}
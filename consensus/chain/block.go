@@ -180,8 +180,18 @@ func (g *BlockGenerator) tteEnabled() bool {
 func ConnectBlock(hs component.ICompSyncRequester, block *types.Block, blockState *state.BlockState, timeout time.Duration) error {
 	// blockState does not include a valid BlockHash since it is constructed
 	// from an incomplete block. So set it here.
-	r, err := hs.RequestFuture(message.ChainSvc, &message.AddBlock{PeerID: "", Block: block, Bstate: blockState},
-		timeout, "consensus/chain/info.ConnectBlock").Result()
+	return connectBlock(hs, &message.AddBlock{PeerID: "", Block: block, Bstate: blockState}, timeout)
+}
+
+// ConnectBlockWithDiff send an AddBlock request with the state diff shipped by the producer of block. The chain
+// service applies the diff instead of executing txs of block, and executes them if the diff doesn't match block.
+func ConnectBlockWithDiff(hs component.ICompSyncRequester, block *types.Block, diff *state.BlockDiff, timeout time.Duration) error {
+	return connectBlock(hs, &message.AddBlock{PeerID: "", Block: block, Diff: diff}, timeout)
+}
+
+func connectBlock(hs component.ICompSyncRequester, msg *message.AddBlock, timeout time.Duration) error {
+	block := msg.Block
+	r, err := hs.RequestFuture(message.ChainSvc, msg, timeout, "consensus/chain/info.ConnectBlock").Result()
 	if err != nil {
 		logger.Error().Err(err).Uint64("no", block.Header.BlockNo).
 			Str("hash", block.ID()).
@@ -228,3 +238,30 @@ func SyncChain(hs *component.ComponentHub, targetHash []byte, targetNo types.Blo
 	// TODO check best block is equal to target Hash/no
 	return nil
 }
+
+// SyncState requests syncer to download the state of root from peers in parallel, and waits until it is imported.
+func SyncState(hs *component.ComponentHub, root []byte, peerIDs []types.PeerID) error {
+	logger.Info().Int("peers", len(peerIDs)).Str("root", enc.ToString(root)).Msg("request to sync state for consensus")
+
+	notiC := make(chan error, 1)
+	hs.Tell(message.SyncerSvc, &message.StateSyncStart{Root: root, PeerIDs: peerIDs, NotifyC: notiC})
+
+	if err := <-notiC; err != nil {
+		logger.Error().Err(err).Str("root", enc.ToString(root)).Msg("failed to sync state")
+		return err
+	}
+
+	logger.Info().Str("root", enc.ToString(root)).Msg("succeeded to sync state for consensus")
+	return nil
+}
+
+// SetStateSyncPoint tells chainservice that the state of block (no, hash) is imported, so that the blocks up to it
+// are connected without execution.
+func SetStateSyncPoint(hs component.ICompSyncRequester, no types.BlockNo, hash []byte, root []byte) error {
+	result, err := hs.RequestFuture(message.ChainSvc, &message.SetStateSyncPoint{No: no, Hash: hash, Root: root},
+		time.Second, "consensus/chain.SetStateSyncPoint").Result()
+	if err != nil {
+		return err
+	}
+	return result.(*message.SetStateSyncPointRsp).Err
+}
@@ -64,6 +64,11 @@ type BlockFactory struct {
 
 	recentRejectedTx *chain.RejTxInfo
 	noTTE            bool
+
+	// specQueue and candidate are for the speculative execution of the block of the next slot
+	specQueue   chan *bpInfo
+	candidate   *candidateBlock
+	speculation bool
 }
 
 // NewBlockFactory returns a new BlockFactory
@@ -73,6 +78,7 @@ func NewBlockFactory(
 	quitC <-chan interface{},
 	bv types.BlockVersionner,
 	noTTE bool,
+	speculation bool,
 ) *BlockFactory {
 	bf := &BlockFactory{
 		ComponentHub:     hub,
@@ -86,6 +92,8 @@ func NewBlockFactory(
 		sdb:              sdb,
 		bv:               bv,
 		noTTE:            noTTE,
+		specQueue:        make(chan *bpInfo, 1),
+		speculation:      speculation,
 	}
 	bf.txOp = chain.NewCompTxOp(
 		// timeout check
@@ -212,6 +220,9 @@ func (bf *BlockFactory) worker() {
 				logger.Error().Msg(err.Error())
 			}
 
+		case spi := <-bf.specQueue:
+			bf.executeSpeculatively(spi)
+
 		case <-bf.quit:
 			return
 		}
@@ -228,27 +239,19 @@ func (bf *BlockFactory) generateBlock(bpi *bpInfo, lpbNo types.BlockNo) (block *
 		}
 	}()
 
-	bi := types.NewBlockHeaderInfoFromPrevBlock(bpi.bestBlock, bpi.slot.UnixNano(), bf.bv)
-	bs = bf.sdb.NewBlockState(
-		bpi.bestBlock.GetHeader().GetBlocksRootHash(),
-		state.SetPrevBlockHash(bpi.bestBlock.BlockHash()),
+	var (
+		bGen    *chain.BlockGenerator
+		elapsed time.Duration
 	)
-	bs.SetGasPrice(system.GetGasPriceFromState(bs))
-	bs.Receipts().SetHardFork(bf.bv, bi.No)
-
-	bGen := chain.NewBlockGenerator(
-		bf, bi, bs, chain.NewCompTxOp(bf.txOp, newTxExec(bpi.ChainDB, bi)), false).
-		WithDeco(bf.deco()).
-		SetNoTTE(bf.noTTE)
-
-	begT := time.Now()
-
-	block, err = bGen.GenerateBlock()
-	if err != nil {
+	if cand := bf.takeCandidate(bpi); cand != nil {
+		block, bs, bGen, elapsed = cand.block, cand.bState, cand.bGen, cand.elapsed
+		logger.Debug().Uint64("no", block.BlockNo()).Int("txs", len(block.GetBody().GetTxs())).
+			Msg("use the block executed speculatively")
+	} else if block, bs, bGen, elapsed, err = bf.executeBlock(bpi); err != nil {
 		return nil, nil, err
 	}
 
-	bf.handleRejected(bGen, block, time.Since(begT))
+	bf.handleRejected(bGen, block, elapsed)
 
 	block.SetConfirms(block.BlockNo() - lpbNo)
 
@@ -266,6 +269,31 @@ func (bf *BlockFactory) generateBlock(bpi *bpInfo, lpbNo types.BlockNo) (block *
 	return
 }
 
+// executeBlock executes txs from mempool on the best block of bpi, and returns the unsigned block.
+func (bf *BlockFactory) executeBlock(bpi *bpInfo) (*types.Block, *state.BlockState, *chain.BlockGenerator, time.Duration, error) {
+	bi := types.NewBlockHeaderInfoFromPrevBlock(bpi.bestBlock, bpi.slot.UnixNano(), bf.bv)
+	bs := bf.sdb.NewBlockState(
+		bpi.bestBlock.GetHeader().GetBlocksRootHash(),
+		state.SetPrevBlockHash(bpi.bestBlock.BlockHash()),
+	)
+	bs.SetGasPrice(system.GetGasPriceFromState(bs))
+	bs.Receipts().SetHardFork(bf.bv, bi.No)
+
+	bGen := chain.NewBlockGenerator(
+		bf, bi, bs, chain.NewCompTxOp(bf.txOp, newTxExec(bpi.ChainDB, bi)), false).
+		WithDeco(bf.deco()).
+		SetNoTTE(bf.noTTE)
+
+	begT := time.Now()
+
+	block, err := bGen.GenerateBlock()
+	if err != nil {
+		return nil, nil, nil, 0, err
+	}
+
+	return block, bs, bGen, time.Since(begT), nil
+}
+
 func (bf *BlockFactory) rejected() *chain.RejTxInfo {
 	return bf.recentRejectedTx
 }
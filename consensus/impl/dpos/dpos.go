@@ -140,7 +140,7 @@ func New(cfg *config.Config, hub *component.ComponentHub, cdb consensus.ChainDB,
 		ComponentHub: hub,
 		ChainDB:      cdb,
 		bpc:          bpc,
-		bf:           NewBlockFactory(hub, sdb, quitC, cfg.Hardfork, cfg.Consensus.NoTimeoutTxEviction),
+		bf:           NewBlockFactory(hub, sdb, quitC, cfg.Hardfork, cfg.Consensus.NoTimeoutTxEviction, cfg.Consensus.Speculation),
 		quit:         quitC,
 	}, nil
 }
@@ -242,6 +242,11 @@ func (dpos *DPoS) QueueJob(now time.Time, jq chan<- interface{}) {
 	if bpi != nil {
 		jq <- bpi
 		lastJob.set(bpi.slot)
+		return
+	}
+
+	if spi := dpos.getSpeculationInfo(now); spi != nil {
+		dpos.bf.speculate(spi)
 	}
 }
 
@@ -354,6 +359,35 @@ func (dpos *DPoS) getBpInfo(now time.Time) *bpInfo {
 	}
 }
 
+// getSpeculationInfo returns the block triggering information of the next slot if it's for this BP. The block of
+// the current slot must be connected already unless the current slot is almost over, since the block of the next
+// slot is built on the best block.
+func (dpos *DPoS) getSpeculationInfo(now time.Time) *bpInfo {
+	return newSpeculationInfo(dpos.ChainDB, slot.Time(now), dpos.bpIdx(), dpos.bpc.Size())
+}
+
+func newSpeculationInfo(cdb consensus.ChainDB, cur *slot.Slot, bpIdx bp.Index, bpCount uint16) *bpInfo {
+	next := cur.Next()
+	if !next.IsFor(bpIdx, bpCount) || slot.Equal(next, lastJob.get()) {
+		return nil
+	}
+
+	block, _ := cdb.GetBestBlock()
+	if block == nil {
+		return nil
+	}
+
+	if !slot.Equal(cur, slot.NewFromUnixNano(block.Header.Timestamp)) && !cur.TimesUp() {
+		return nil
+	}
+
+	return &bpInfo{
+		ChainDB:   cdb,
+		bestBlock: block,
+		slot:      next,
+	}
+}
+
 // ConsensusInfo returns the basic DPoS-related info.
 func (dpos *DPoS) ConsensusInfo() *types.ConsensusInfo {
 	withLock := func(fn func()) {
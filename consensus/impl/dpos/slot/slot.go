@@ -40,6 +40,11 @@ func NewFromUnixNano(ns int64) *Slot {
 	return fromUnixNs(ns)
 }
 
+// Next returns a Slot corresponding to the beginning of the block generation time next to s.
+func (s *Slot) Next() *Slot {
+	return fromUnixNs((s.nextIndex*blockIntervalMs + 1) * 1000000)
+}
+
 // UnixNano returns UNIX time in ns.
 func (s *Slot) UnixNano() int64 {
 	return s.timeNs
@@ -59,3 +59,19 @@ func TestSlotFuture(t *testing.T) {
 	assert.True(t, Time(time.Now().Add(2*time.Second)).IsFuture(), "must be a future slot")
 	assert.True(t, Time(time.Now().Add(3*time.Second)).IsFuture(), "must be a future slot")
 }
+
+func TestSlotNext(t *testing.T) {
+	Init(bpInterval)
+
+	s := Now()
+	next := s.Next()
+	assert.True(t, IsNextTo(next, s), "must be the slot next to s")
+	assert.Equal(t, s.nextIndex+1, next.nextIndex)
+	// the next slot begins right after the block generation time of s
+	assert.Equal(t, s.nextIndex*blockIntervalMs+1, next.timeMs)
+
+	// the next slot of a slot at the beginning of the block generation time
+	assert.True(t, IsNextTo(next.Next(), next), "must be the slot next to next")
+	assert.Equal(t, next.nextIndex+1, next.Next().nextIndex)
+	assert.False(t, Equal(s, next))
+}
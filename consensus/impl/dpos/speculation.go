@@ -0,0 +1,122 @@
+/**
+ *  @file
+ *  @copyright defined in aergo/LICENSE.txt
+ */
+
+package dpos
+
+import (
+	"bytes"
+	"runtime/debug"
+	"time"
+
+	"github.com/aergoio/aergo/consensus"
+	"github.com/aergoio/aergo/consensus/chain"
+	"github.com/aergoio/aergo/consensus/impl/dpos/slot"
+	"github.com/aergoio/aergo/state"
+	"github.com/aergoio/aergo/types"
+)
+
+// candidateBlock is a block executed before the slot of this BP begins. It is published at the slot if the best
+// block is not changed until then, so that the block is produced without waiting for tx execution, and txs are
+// executed for longer than the block production time limit of the slot.
+type candidateBlock struct {
+	slot      *slot.Slot
+	bestBlock *types.Block
+
+	block   *types.Block
+	bState  *state.BlockState
+	bGen    *chain.BlockGenerator
+	elapsed time.Duration
+}
+
+func (c *candidateBlock) isFor(bpi *bpInfo) bool {
+	return c != nil && slot.Equal(c.slot, bpi.slot) && bytes.Equal(c.bestBlock.BlockHash(), bpi.bestBlock.BlockHash())
+}
+
+// speculate requests the worker to execute the block of bpi before its slot. It doesn't block the consensus loop.
+func (bf *BlockFactory) speculate(bpi *bpInfo) {
+	if !bf.speculation {
+		return
+	}
+
+	select {
+	case bf.specQueue <- bpi:
+	default:
+	}
+}
+
+// takeCandidate returns the block executed speculatively for bpi, and drops it. It returns nil if there is no
+// candidate for bpi, which is the case the best block is changed after the execution.
+func (bf *BlockFactory) takeCandidate(bpi *bpInfo) *candidateBlock {
+	cand := bf.candidate
+	bf.candidate = nil
+	if !cand.isFor(bpi) {
+		return nil
+	}
+	return cand
+}
+
+// executeSpeculatively executes the block of bpi before its slot. The execution is rebased whenever the best block
+// is changed. It must finish before the slot begins, since the worker must be free to take the job of the slot.
+func (bf *BlockFactory) executeSpeculatively(bpi *bpInfo) {
+	defer func() {
+		if panicMsg := recover(); panicMsg != nil {
+			bf.candidate = nil
+			logger.Debug().Str("callstack", string(debug.Stack())).Msgf("panic ocurred during speculative execution - %v", panicMsg)
+		}
+	}()
+
+	if bf.candidate.isFor(bpi) {
+		return
+	}
+	bf.candidate = nil
+
+	// leave a margin since tx execution and the state update are not stopped right at the timeout
+	margin := consensus.BlockInterval / 10
+	budget := time.Until(time.Unix(0, bpi.slot.UnixNano())) - margin
+	if limit := time.Duration(bpi.slot.GetBpTimeout()) * time.Millisecond; budget > limit {
+		budget = limit
+	}
+	if budget <= margin {
+		return
+	}
+
+	// drain the timeout which is not consumed by the previous block
+	if err := bf.checkBpTimeout(); err == chain.ErrQuit {
+		return
+	}
+
+	fired := make(chan struct{})
+	timer := time.AfterFunc(budget, func() {
+		select {
+		case bf.bpTimeoutC <- struct{}{}:
+		default:
+		}
+		close(fired)
+	})
+
+	block, bs, bGen, elapsed, err := bf.executeBlock(bpi)
+
+	if !timer.Stop() {
+		<-fired
+		_ = bf.checkBpTimeout()
+	}
+
+	if err != nil {
+		logger.Debug().Err(err).Msg("failed to execute block speculatively")
+		return
+	}
+
+	bf.candidate = &candidateBlock{
+		slot:      bpi.slot,
+		bestBlock: bpi.bestBlock,
+		block:     block,
+		bState:    bs,
+		bGen:      bGen,
+		elapsed:   elapsed,
+	}
+
+	logger.Debug().Uint64("no", block.BlockNo()).Int("txs", len(block.GetBody().GetTxs())).
+		Dur("elapsed", elapsed).Str("best", bpi.bestBlock.ID()).Msg("block executed speculatively")
+}
@@ -0,0 +1,97 @@
+package dpos
+
+import (
+	"testing"
+	"time"
+
+	"github.com/aergoio/aergo/consensus"
+	"github.com/aergoio/aergo/consensus/impl/dpos/bp"
+	"github.com/aergoio/aergo/consensus/impl/dpos/slot"
+	"github.com/aergoio/aergo/types"
+	"github.com/stretchr/testify/assert"
+)
+
+type bestBlockDB struct {
+	consensus.ChainDB
+	best *types.Block
+}
+
+func (db *bestBlockDB) GetBestBlock() (*types.Block, error) {
+	return db.best, nil
+}
+
+func TestTakeCandidate(t *testing.T) {
+	slot.Init(bpInterval)
+
+	bv := types.DummyBlockVersionner(0)
+	s := slot.Now()
+	best := newBlock(time.Now().UnixNano())
+	bpi := &bpInfo{bestBlock: best, slot: s}
+	bf := &BlockFactory{}
+
+	var none *candidateBlock
+	assert.False(t, none.isFor(bpi))
+	assert.Nil(t, bf.takeCandidate(bpi))
+
+	cand := &candidateBlock{slot: s, bestBlock: best}
+	assert.True(t, cand.isFor(bpi))
+	bf.candidate = cand
+	assert.Equal(t, cand, bf.takeCandidate(bpi))
+	assert.Nil(t, bf.candidate, "candidate is taken only once")
+	assert.Nil(t, bf.takeCandidate(bpi))
+
+	// the best block is changed after the speculative execution
+	bf.candidate = cand
+	assert.Nil(t, bf.takeCandidate(&bpInfo{bestBlock: newBlockFromPrev(best, time.Now().UnixNano(), bv), slot: s}))
+	assert.Nil(t, bf.candidate, "stale candidate is dropped")
+
+	// the slot is changed, e.g. the slot was missed while executing
+	bf.candidate = cand
+	assert.Nil(t, bf.takeCandidate(&bpInfo{bestBlock: best, slot: s.Next()}))
+	assert.Nil(t, bf.candidate, "stale candidate is dropped")
+}
+
+func TestSpeculationInfo(t *testing.T) {
+	slot.Init(bpInterval)
+	defer lastJob.set(nil)
+
+	const bpCount = 3
+	bpIdxOf := func(s *slot.Slot) bp.Index {
+		return bp.Index(s.NextBpIndex(bpCount))
+	}
+	check := func(cur *slot.Slot, best *types.Block, bpIdx bp.Index) *bpInfo {
+		return newSpeculationInfo(&bestBlockDB{best: best}, cur, bpIdx, bpCount)
+	}
+
+	// the current slot has enough time left
+	cur := slot.Time(time.Now().Add(2 * time.Second))
+	next := cur.Next()
+	mine := bpIdxOf(next)
+	other := (mine + 1) % bpCount
+	connected := newBlock(cur.UnixNano())
+	notConnected := newBlock(cur.UnixNano() - int64(time.Second))
+
+	lastJob.set(nil)
+	bpi := check(cur, connected, mine)
+	if assert.NotNil(t, bpi, "block of the current slot is connected") {
+		assert.True(t, slot.Equal(next, bpi.slot))
+		assert.Equal(t, connected, bpi.bestBlock)
+	}
+	assert.Nil(t, check(cur, connected, other), "next slot is not for this BP")
+	assert.Nil(t, check(cur, notConnected, mine), "block of the current slot may still come")
+	assert.Nil(t, check(cur, nil, mine))
+
+	lastJob.set(next)
+	assert.Nil(t, check(cur, connected, mine), "job of the next slot is queued already")
+
+	// the time of the current slot is up, so its block is not waited for any more
+	lastJob.set(nil)
+	cur = slot.Time(time.Now().Add(-2 * time.Second))
+	assert.True(t, cur.TimesUp())
+	notConnected = newBlock(cur.UnixNano() - int64(time.Second))
+	bpi = check(cur, notConnected, bpIdxOf(cur.Next()))
+	if assert.NotNil(t, bpi) {
+		assert.True(t, slot.Equal(cur.Next(), bpi.slot))
+		assert.Equal(t, notConnected, bpi.bestBlock)
+	}
+}
@@ -449,7 +449,7 @@ func (bf *BlockFactory) worker() {
 			}
 
 			// add block that has produced by remote BP
-			if err := bf.connect(cEntry.block); err != nil {
+			if err := bf.connect(cEntry.block, cEntry.diff); err != nil {
 				logger.Error().Err(err).Msg("failed to connect block")
 				return
 			}
@@ -561,7 +561,7 @@ func (bf *BlockFactory) reset() {
 }
 
 // save block/block state to connect after commit
-func (bf *BlockFactory) connect(block *types.Block) error {
+func (bf *BlockFactory) connect(block *types.Block, diff []byte) error {
 	proposed := bf.raftOp.proposed
 	var blockState *state.BlockState
 
@@ -582,7 +582,13 @@ func (bf *BlockFactory) connect(block *types.Block) error {
 
 	// if bestblock is changed, connecting block failed. new block is generated in next tick
 	// On a slow server, chain service takes too long to add block in blockchain. In this case, raft server waits to send new block to commit channel.
-	if err := chain.ConnectBlock(bf, block, blockState, time.Second*300); err != nil {
+	var err error
+	if blockDiff := importDiff(block, blockState, diff); blockDiff != nil {
+		err = chain.ConnectBlockWithDiff(bf, block, blockDiff, time.Second*300)
+	} else {
+		err = chain.ConnectBlock(bf, block, blockState, time.Second*300)
+	}
+	if err != nil {
 		logger.Fatal().Msg(err.Error())
 		return err
 	}
@@ -856,7 +862,7 @@ func (rop *RaftOperator) propose(block *types.Block, blockState *state.BlockStat
 
 	rop.proposed = &Proposed{block: block, blockState: blockState}
 
-	if err := rop.rs.Propose(block); err != nil {
+	if err := rop.rs.Propose(block, exportDiff(block, blockState)); err != nil {
 		return err
 	}
 
@@ -872,6 +878,40 @@ func (rop *RaftOperator) propose(block *types.Block, blockState *state.BlockStat
 	return nil
 }
 
+// exportDiff returns the encoded state diff of the block to ship with it, if RaftShipStateDiff is set. The block is
+// shipped without diff if the diff can't be exported.
+func exportDiff(block *types.Block, blockState *state.BlockState) []byte {
+	if !RaftShipStateDiff {
+		return nil
+	}
+
+	diff, err := blockState.ExportDiff()
+	if err == nil {
+		var data []byte
+		if data, err = diff.Encode(); err == nil {
+			return data
+		}
+	}
+
+	logger.Debug().Err(err).Uint64("no", block.BlockNo()).Msg("propose block without state diff")
+	return nil
+}
+
+// importDiff returns the state diff shipped by the leader, which is applied instead of executing the block. It
+// returns nil if the block is proposed by this node, or the diff is not used.
+func importDiff(block *types.Block, blockState *state.BlockState, data []byte) *state.BlockDiff {
+	if !RaftShipStateDiff || blockState != nil || data == nil {
+		return nil
+	}
+
+	diff, err := state.DecodeBlockDiff(data)
+	if err != nil {
+		logger.Warn().Err(err).Uint64("no", block.BlockNo()).Msg("failed to decode state diff of block, execute block instead")
+		return nil
+	}
+	return diff
+}
+
 func (rop *RaftOperator) ProposeConfChange(proposal *consensus.ConfChangePropose) error {
 	var err error
 
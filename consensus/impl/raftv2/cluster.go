@@ -395,6 +395,21 @@ func (cl *Cluster) getAnyPeerAddressToSync() (types.PeerID, error) {
 	return "", ErrNoEnableSyncPeer
 }
 
+// getPeerAddressesToSync returns peer ids of all members except this node
+func (cl *Cluster) getPeerAddressesToSync() []types.PeerID {
+	cl.Lock()
+	defer cl.Unlock()
+
+	var peerIDs []types.PeerID
+	for _, member := range cl.Members().MapByID {
+		if member.Name != cl.NodeName() {
+			peerIDs = append(peerIDs, member.GetPeerID())
+		}
+	}
+
+	return peerIDs
+}
+
 func (cl *Cluster) isValidMember(member *consensus.Member) error {
 	cl.Lock()
 	defer cl.Unlock()
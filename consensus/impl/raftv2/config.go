@@ -48,6 +48,9 @@ var (
 	ElectionTickCount        = DefaultElectionTickCount
 	MaxSlowNodeGap    uint64 = DefaultSlowNodeGap // Criteria for determining whether the server is in a slow state
 	StopDupCommit            = false
+	// RaftShipStateDiff makes the leader ship the state diff of a block with it, and the others apply the diff
+	// instead of executing the block
+	RaftShipStateDiff = false
 )
 
 func Init(raftCfg *config.RaftConfig) {
@@ -92,6 +95,8 @@ func Init(raftCfg *config.RaftConfig) {
 	if raftCfg.StopDupCommit {
 		StopDupCommit = true
 	}
+
+	RaftShipStateDiff = raftCfg.ShipStateDiff
 	logger.Info().Int64("factory tick(ms)", BlockFactoryTickMs.Nanoseconds()/int64(time.Millisecond)).
 		Int64("interval(ms)", BlockIntervalMs.Nanoseconds()/int64(time.Millisecond)).Msg("set block factory tick/interval")
 }
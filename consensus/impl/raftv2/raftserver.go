@@ -131,6 +131,9 @@ type LeaderStatus struct {
 
 type commitEntry struct {
 	block *types.Block
+	// diff is the encoded state diff shipped by the leader with the block. It is nil if the leader doesn't ship it,
+	// or the entry is read from the WAL.
+	diff  []byte
 	index uint64
 	term  uint64
 }
@@ -607,13 +610,13 @@ func (rs *raftServer) writeError(err error) {
 }
 
 // TODO timeout handling with context
-func (rs *raftServer) Propose(block *types.Block) error {
+func (rs *raftServer) Propose(block *types.Block, diff []byte) error {
 	if block == nil {
 		return ErrProposeNilBlock
 	}
 	logger.Debug().Msg("propose block")
 
-	if data, err := marshalEntryData(block); err == nil {
+	if data, err := marshalEntryDataWithDiff(block, diff); err == nil {
 		// blocks until accepted by raft state machine
 		if err := rs.node.Propose(context.TODO(), data); err != nil {
 			return err
@@ -1203,9 +1206,10 @@ func (rs *raftServer) publishEntries(ents []raftpb.Entry) bool {
 		switch ents[i].Type {
 		case raftpb.EntryNormal:
 			var block *types.Block
+			var diff []byte
 			var err error
 			if len(ents[i].Data) != 0 {
-				if block, err = unmarshalEntryData(ents[i].Data); err != nil {
+				if block, diff, err = unmarshalEntryDataWithDiff(ents[i].Data); err != nil {
 					logger.Fatal().Err(err).Uint64("idx", ents[i].Index).Uint64("term", ents[i].Term).Msg("commit entry is corrupted")
 					continue
 				}
@@ -1221,7 +1225,7 @@ func (rs *raftServer) publishEntries(ents []raftpb.Entry) bool {
 			}
 
 			select {
-			case rs.commitC <- &commitEntry{block: block, index: ents[i].Index, term: ents[i].Term}:
+			case rs.commitC <- &commitEntry{block: block, diff: diff, index: ents[i].Index, term: ents[i].Term}:
 			case <-rs.stopc:
 				return false
 			}
@@ -1536,13 +1540,49 @@ var (
 	ErrUnmarshal = errors.New("failed to unmarshalEntryData log entry")
 )
 
+// entryDiffMarker is the first byte of entry data which has the state diff after the block. It doesn't start the
+// data of a block only, since it is not a valid protobuf field tag.
+const entryDiffMarker = 0x00
+
+// marshalEntryDataWithDiff returns entry data of block followed by the encoded state diff, if diff is not nil.
+func marshalEntryDataWithDiff(block *types.Block, diff []byte) ([]byte, error) {
+	data, err := marshalEntryData(block)
+	if err != nil || diff == nil {
+		return data, err
+	}
+
+	buf := make([]byte, 1+binary.MaxVarintLen64, 1+binary.MaxVarintLen64+len(data)+len(diff))
+	buf[0] = entryDiffMarker
+	n := binary.PutUvarint(buf[1:], uint64(len(data)))
+	buf = append(buf[:1+n], data...)
+
+	return append(buf, diff...), nil
+}
+
 func unmarshalEntryData(data []byte) (*types.Block, error) {
+	block, _, err := unmarshalEntryDataWithDiff(data)
+	return block, err
+}
+
+// unmarshalEntryDataWithDiff returns the block of entry data, and the encoded state diff if the data has it.
+func unmarshalEntryDataWithDiff(data []byte) (*types.Block, []byte, error) {
+	var diff []byte
 	block := &types.Block{}
+
+	if len(data) > 0 && data[0] == entryDiffMarker {
+		size, n := binary.Uvarint(data[1:])
+		if n <= 0 || size > uint64(len(data)-1-n) {
+			return block, nil, ErrUnmarshal
+		}
+		start := 1 + n
+		data, diff = data[start:start+int(size)], data[start+int(size):]
+	}
+
 	if err := proto.Unmarshal(data, block); err != nil {
-		return block, ErrUnmarshal
+		return block, nil, ErrUnmarshal
 	}
 
-	return block, nil
+	return block, diff, nil
 }
 
 type raftHttpWrapper struct {
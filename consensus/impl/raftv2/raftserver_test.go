@@ -0,0 +1,41 @@
+package raftv2
+
+import (
+	"testing"
+
+	"github.com/aergoio/aergo/types"
+	"github.com/stretchr/testify/assert"
+)
+
+func TestEntryDataWithDiff(t *testing.T) {
+	block := types.NewBlock(&types.BlockHeaderInfo{No: 10}, nil, nil, nil, nil, nil)
+
+	// entry without diff is the same as before
+	data, err := marshalEntryDataWithDiff(block, nil)
+	assert.NoError(t, err)
+	plain, err := marshalEntryData(block)
+	assert.NoError(t, err)
+	assert.Equal(t, plain, data)
+
+	decoded, diff, err := unmarshalEntryDataWithDiff(data)
+	assert.NoError(t, err)
+	assert.Equal(t, block.BlockHash(), decoded.BlockHash())
+	assert.Nil(t, diff)
+
+	// entry with diff
+	data, err = marshalEntryDataWithDiff(block, []byte("diff"))
+	assert.NoError(t, err)
+	decoded, diff, err = unmarshalEntryDataWithDiff(data)
+	assert.NoError(t, err)
+	assert.Equal(t, block.BlockHash(), decoded.BlockHash())
+	assert.Equal(t, []byte("diff"), diff)
+
+	// the wal keeps the block only
+	decoded, err = unmarshalEntryData(data)
+	assert.NoError(t, err)
+	assert.Equal(t, block.BlockHash(), decoded.BlockHash())
+
+	// truncated entry
+	_, _, err = unmarshalEntryDataWithDiff(data[:3])
+	assert.Equal(t, ErrUnmarshal, err)
+}
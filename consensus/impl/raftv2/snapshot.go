@@ -131,6 +131,11 @@ func (chainsnap *ChainSnapshotter) syncSnap(snap *raftpb.Snapshot) error {
 
 	// write snapshot log in WAL for crash recovery
 	logger.Info().Str("snap", consensus.SnapToString(snap, snapdata)).Msg("start to sync snapshot")
+
+	if err := chainsnap.requestStateSync(&snapdata.Chain); err != nil {
+		// blocks are executed from the current best block instead
+		logger.Warn().Err(err).Msg("failed to sync state of snapshot")
+	}
 	// TODO	request sync for chain with snapshot.data
 	// wait to finish sync of chain
 	if err := chainsnap.requestSync(&snapdata.Chain); err != nil {
@@ -152,6 +157,35 @@ func (chainsnap *ChainSnapshotter) checkPeerLive(peerID types.PeerID) bool {
 	return ok
 }
 
+// requestStateSync imports the state of the snapshot block by chunks which are fetched from live members in
+// parallel and checked against their hashes. Then blocks up to the snapshot are connected without execution by
+// the following block sync. If it's interrupted, imported state is kept and the snapshot is synced again when
+// raft sends it again. It is skipped if the snapshot has no state root or the chain already reached it.
+func (chainsnap *ChainSnapshotter) requestStateSync(snap *consensus.ChainSnapshot) error {
+	if len(snap.Root) == 0 {
+		return nil
+	}
+	if best := chain.GetBestBlock(chainsnap.ComponentHub); best == nil || best.BlockNo() >= snap.No {
+		return nil
+	}
+
+	var peerIDs []types.PeerID
+	for _, peerID := range chainsnap.cluster.getPeerAddressesToSync() {
+		if chainsnap.checkPeerLive(peerID) {
+			peerIDs = append(peerIDs, peerID)
+		}
+	}
+	if len(peerIDs) == 0 {
+		return ErrNoEnableSyncPeer
+	}
+
+	if err := chain.SyncState(chainsnap.ComponentHub, snap.Root, peerIDs); err != nil {
+		return err
+	}
+
+	return chain.SetStateSyncPoint(chainsnap.ComponentHub, snap.No, snap.Hash, snap.Root)
+}
+
 // TODO handle error case that leader stops while synchronizing
 func (chainsnap *ChainSnapshotter) requestSync(snap *consensus.ChainSnapshot) error {
 
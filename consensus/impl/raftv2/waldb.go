@@ -21,24 +21,21 @@ func NewWalDB(chainWal consensus.ChainWAL) *WalDB {
 	return &WalDB{chainWal}
 }
 
+// SaveEntry saves entries and hard state of a raft Ready batch by one db transaction
 func (wal *WalDB) SaveEntry(state raftpb.HardState, entries []raftpb.Entry) error {
-	if len(entries) != 0 {
-		walEnts, blocks, confChanges := wal.convertFromRaft(entries)
+	walEnts, blocks, confChanges := wal.convertFromRaft(entries)
 
-		if err := wal.WriteRaftEntry(walEnts, blocks, confChanges); err != nil {
-			return err
-		}
+	// hardstate is saved after entries since entries may include commited one
+	var hardState *raftpb.HardState
+	if !raft.IsEmptyHardState(state) {
+		hardState = &state
 	}
 
-	// hardstate must save after entries since entries may include commited one
-	if !raft.IsEmptyHardState(state) {
-		// save hardstate
-		if err := wal.WriteHardState(&state); err != nil {
-			return err
-		}
+	if len(walEnts) == 0 && hardState == nil {
+		return nil
 	}
 
-	return nil
+	return wal.WriteRaftReady(walEnts, blocks, confChanges, hardState)
 }
 
 func (wal *WalDB) convertFromRaft(entries []raftpb.Entry) ([]*consensus.WalEntry, []*types.Block, []*raftpb.ConfChange) {
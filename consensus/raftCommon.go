@@ -102,6 +102,7 @@ type ChainWAL interface {
 	GetRaftEntryIndexOfBlock(hash []byte) (uint64, error)
 	GetHardState() (*raftpb.HardState, error)
 	WriteHardState(hardstate *raftpb.HardState) error
+	WriteRaftReady(ents []*WalEntry, blocks []*types.Block, ccProposes []*raftpb.ConfChange, hardstate *raftpb.HardState) error
 	WriteSnapshot(snap *raftpb.Snapshot) error
 	GetSnapshot() (*raftpb.Snapshot, error)
 	WriteIdentity(id *RaftIdentity) error
@@ -185,6 +186,8 @@ func (snapd *SnapshotData) ToString() string {
 type ChainSnapshot struct {
 	No   types.BlockNo `json:"no"`
 	Hash []byte        `json:"hash"`
+	// Root is the state root of the block. It is empty in snapshots made by older nodes.
+	Root []byte `json:"root,omitempty"`
 }
 
 func NewChainSnapshot(block *types.Block) *ChainSnapshot {
@@ -192,7 +195,7 @@ func NewChainSnapshot(block *types.Block) *ChainSnapshot {
 		return nil
 	}
 
-	return &ChainSnapshot{No: block.BlockNo(), Hash: block.BlockHash()}
+	return &ChainSnapshot{No: block.BlockNo(), Hash: block.BlockHash(), Root: block.GetHeader().GetBlocksRootHash()}
 }
 
 func (csnap *ChainSnapshot) Equal(other *ChainSnapshot) bool {
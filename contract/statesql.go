@@ -10,6 +10,7 @@ import (
 	"encoding/json"
 	"errors"
 	"fmt"
+	"io"
 	"os"
 	"path/filepath"
 	"sync"
@@ -38,6 +39,11 @@ var (
 const (
 	statesqlDriver = "statesql"
 	queryDriver    = "query"
+
+	// sqlSnapshotDir has copies of databases served to peers syncing state, and sqlImportDir has databases
+	// downloaded from peers syncing state
+	sqlSnapshotDir = "snapshot"
+	sqlImportDir   = "import"
 )
 
 type sqlDatabase struct {
@@ -93,6 +99,9 @@ func LoadDatabase(dataDir string) error {
 		if err = checkPath(path); err == nil {
 			database.DBs = make(map[string]*litetree)
 			database.DataDir = path
+			// snapshots and downloads of a previous run are not used any more
+			_ = os.RemoveAll(filepath.Join(path, sqlSnapshotDir))
+			_ = os.RemoveAll(filepath.Join(path, sqlImportDir))
 		}
 	})
 	return err
@@ -211,18 +220,29 @@ func conn(dbName string) (*litetree, error) {
 }
 
 func dataSrc(dbName string) string {
+	return fileDataSrc(dbPath(dbName))
+}
+
+func dbPath(dbName string) string {
+	return fmt.Sprintf("%s/%s.db", database.DataDir, dbName)
+}
+
+func fileDataSrc(path string) string {
 	return fmt.Sprintf(
-		"file:%s/%s.db?branches=on&max_db_size=%d",
-		database.DataDir,
-		dbName,
+		"file:%s?branches=on&max_db_size=%d",
+		path,
 		int64(maxSQLDBSize*1024*1024))
 }
 
 func readOnlyConn(dbName string) (*litetree, error) {
+	return queryConnOf(dataSrc(dbName)+"&_query_only=true", dbName)
+}
+
+func queryConnOf(src, dbName string) (*litetree, error) {
 	queryConnLock.Lock()
 	defer queryConnLock.Unlock()
 
-	db, err := sql.Open(queryDriver, dataSrc(dbName)+"&_query_only=true")
+	db, err := sql.Open(queryDriver, src)
 	if err != nil {
 		sqlLgr.Fatal().Err(err)
 		return nil, ErrDBOpen
@@ -271,6 +291,71 @@ func openDB(dbName string) (*litetree, error) {
 	return database.DBs[dbName], nil
 }
 
+// SnapshotSQLDatabase copies the database of the contract at account to be served to peers syncing state. It
+// must be called while no block is executed, so the database isn't changed during the copy.
+func SnapshotSQLDatabase(account types.AccountID, id uint64) (path string, size int64, err error) {
+	dir := filepath.Join(database.DataDir, sqlSnapshotDir)
+	if err = checkPath(dir); err != nil {
+		return "", 0, err
+	}
+	src, err := os.Open(dbPath(account.String()))
+	if err != nil {
+		return "", 0, err
+	}
+	defer src.Close()
+
+	path = filepath.Join(dir, fmt.Sprintf("%s-%d.db", account.String(), id))
+	dst, err := os.Create(path)
+	if err != nil {
+		return "", 0, err
+	}
+	size, err = io.Copy(dst, src)
+	if closeErr := dst.Close(); err == nil {
+		err = closeErr
+	}
+	if err != nil {
+		_ = os.Remove(path)
+		return "", 0, err
+	}
+	return path, size, nil
+}
+
+// SQLImportPath returns the path to download the database of the contract at account from peers syncing state
+func SQLImportPath(account types.AccountID) (string, error) {
+	dir := filepath.Join(database.DataDir, sqlImportDir)
+	if err := checkPath(dir); err != nil {
+		return "", err
+	}
+	return filepath.Join(dir, account.String()+".db"), nil
+}
+
+// ImportSQLDatabase puts the database of the contract at account downloaded to SQLImportPath in place. The
+// database is not a part of the state trie, so it can't be verified against the state root. Only the recovery
+// point rp of the contract state is checked to be in it, and the database is rolled back to the point.
+func ImportSQLDatabase(account types.AccountID, rp uint64) error {
+	path, err := SQLImportPath(account)
+	if err != nil {
+		return err
+	}
+	db, err := queryConnOf(fileDataSrc(path), account.String())
+	if err != nil {
+		return err
+	}
+	err = db.restoreRecoveryPoint(rp)
+	if err == nil && db.recoveryPoint() != rp {
+		err = ErrFindRp
+	}
+	if closeErr := db.close(); err == nil {
+		err = closeErr
+	}
+	_ = os.Remove(path + "-lock")
+	if err != nil {
+		_ = os.Remove(path)
+		return err
+	}
+	return os.Rename(path, dbPath(account.String()))
+}
+
 type litetree struct {
 	*sql.Conn
 	db        *sql.DB
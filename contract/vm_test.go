@@ -860,6 +860,87 @@ abi.register(createAndInsert, insertRollbackData, query, count, all)`
 	}
 }
 
+func TestSqlVmSnapshot(t *testing.T) {
+	bc, err := LoadDummyChain()
+	if err != nil {
+		t.Errorf("failed to create test database: %v", err)
+	}
+	defer bc.Release()
+
+	definition := `
+function insert()
+    db.exec("create table if not exists dual(dummy char(1))")
+	db.exec("insert into dual values ('X')")
+end
+
+function count()
+	local rs = db.query("select count(*) from dual")
+	if rs:next() then
+		return rs:get()
+	end
+	return "error in count()"
+end
+
+abi.register(insert, count)`
+
+	_ = bc.ConnectBlock(
+		NewLuaTxAccount("ktlee", 100000000000000000),
+		NewLuaTxDef("ktlee", "snapshot", 0, definition),
+		NewLuaTxCall("ktlee", "snapshot", 0, `{"Name": "insert", "Args":[]}`),
+	)
+	st, err := bc.GetAccountState("snapshot")
+	if err != nil {
+		t.Fatal(err)
+	}
+	rp := st.SqlRecoveryPoint
+	_ = bc.ConnectBlock(
+		NewLuaTxCall("ktlee", "snapshot", 0, `{"Name": "insert", "Args":[]}`),
+	)
+
+	// the snapshot made after the state has newer commits, as a peer serves a finalized state
+	id := types.ToAccountID(strHash("snapshot"))
+	snapshot, _, err := SnapshotSQLDatabase(id, 1)
+	if err != nil {
+		t.Fatal(err)
+	}
+	_ = bc.DisConnectBlock()
+
+	download := func() {
+		path, err := SQLImportPath(id)
+		if err != nil {
+			t.Fatal(err)
+		}
+		data, err := ioutil.ReadFile(snapshot)
+		if err != nil {
+			t.Fatal(err)
+		}
+		if err = ioutil.WriteFile(path, data, 0644); err != nil {
+			t.Fatal(err)
+		}
+	}
+	download()
+	if err = ImportSQLDatabase(id, rp+2); err == nil {
+		t.Error("imported a database without the recovery point")
+	}
+	download()
+	if err = ImportSQLDatabase(id, rp); err != nil {
+		t.Fatal(err)
+	}
+	err = bc.Query("snapshot", `{"Name": "count", "Args":[]}`, "", `1`)
+	if err != nil {
+		t.Error(err)
+	}
+
+	// the imported database is continued by blocks
+	_ = bc.ConnectBlock(
+		NewLuaTxCall("ktlee", "snapshot", 0, `{"Name": "insert", "Args":[]}`),
+	)
+	err = bc.Query("snapshot", `{"Name": "count", "Args":[]}`, "", `2`)
+	if err != nil {
+		t.Error(err)
+	}
+}
+
 func TestSqlVmFail(t *testing.T) {
 	bc, err := LoadDummyChain()
 	if err != nil {
@@ -1,8 +1,11 @@
 package merkle
 
 import (
-	"github.com/minio/sha256-simd"
 	"hash"
+	"runtime"
+	"sync"
+
+	"github.com/minio/sha256-simd"
 )
 
 type MerkleEntry interface {
@@ -13,15 +16,26 @@ var (
 	HashSize = 32
 	nilHash  = make([]byte, HashSize)
 	//logger = log.NewLogger("merkle")
+
+	hasherPool = sync.Pool{New: func() interface{} { return sha256.New() }}
 )
 
+// parallelMinNodes is the minimum number of leaves or branch nodes in a level to hash them by several workers.
+// Smaller levels are hashed in the calling goroutine, since spawning workers costs more than hashing them.
+const parallelMinNodes = 1024
+
 func CalculateMerkleRoot(entries []MerkleEntry) []byte {
 	merkles := CalculateMerkleTree(entries)
 
-	return merkles[len(merkles)-1]
+	// root is copied not to keep the buffer of all branch hashes
+	return append([]byte(nil), merkles[len(merkles)-1]...)
 }
 
 func CalculateMerkleTree(entries []MerkleEntry) [][]byte {
+	return calculateMerkleTree(entries, runtime.NumCPU())
+}
+
+func calculateMerkleTree(entries []MerkleEntry, workers int) [][]byte {
 	var merkles [][]byte
 	entriesLen := len(entries)
 
@@ -42,49 +56,86 @@ func CalculateMerkleTree(entries []MerkleEntry) [][]byte {
 		return x
 	}
 
-	calcMerkle := func(hasher hash.Hash, lc []byte, rc []byte) []byte {
-		hasher.Reset()
-		hasher.Write(lc)
-		hasher.Write(rc)
-		return hasher.Sum(nil)
-	}
-
-	hasher := sha256.New()
-
 	leafCount := getLeafCount(len(entries))
 	totalCount := leafCount*2 - 1
 
 	//logger.Debug().Int("leafcount", leafCount).Int("totCount", totalCount).Msg("start merkling")
 
 	merkles = make([][]byte, totalCount)
+	// hashes of branch nodes are written in one buffer instead of allocating each of them
+	branches := make([]byte, (totalCount-leafCount)*HashSize)
 
-	// init leaf hash (0 <= node# < entry len)
-	for i, entry := range entries {
-		merkles[i] = entry.GetHash()
+	// init leaf hash (0 <= node# < entry len). getting hash of entry like receipt is usually the most expensive part.
+	forEachRange(entriesLen, workers, func(from, to int) {
+		for i := from; i < to; i++ {
+			merkles[i] = entries[i].GetHash()
+		}
+	})
+
+	// start from branch height 1 (merkles[leafcount] ~ merkles[totalCount -1]), level by level.
+	// nodes in a level depend only on the level below, so a level is split to several workers.
+	childStart := 0
+	for levelStart, levelLen := leafCount, leafCount/2; levelLen > 0; levelStart, levelLen = levelStart+levelLen, levelLen/2 {
+		start, children := levelStart, childStart
+		forEachRange(levelLen, workers, func(from, to int) {
+			hasher := hasherPool.Get().(hash.Hash)
+			defer hasherPool.Put(hasher)
+			for n := from; n < to; n++ {
+				i := start + n
+				lc := children + 2*n
+				rc := lc + 1
+
+				// If all child is nil, merkle is nil
+				if merkles[lc] == nil {
+					merkles[i] = nil
+					continue
+				}
+				// If only exist left child, copy left child hash to right child
+				if merkles[rc] == nil {
+					merkles[rc] = merkles[lc]
+				}
+
+				offset := (i - leafCount) * HashSize
+				merkles[i] = calcMerkle(hasher, merkles[lc], merkles[rc], branches[offset:offset:offset+HashSize])
+				//logger.Debug().Int("i", i).Str("m", EncodeB64(merkles[i])).Msg("merkling")
+			}
+		})
+		childStart = levelStart
 	}
 
-	// start from branch height 1 (merkles[leafcount] ~ merkles[totalCount -1])
-	var childIdx = 0
-	var lc, rc int
-	for i := leafCount; i < totalCount; i++ {
-		// hash of branch node is zero if all child not exist
-		lc = childIdx
-		rc = childIdx + 1
-		childIdx += 2
-
-		// If all child is nil, merkle is nil
-		if merkles[lc] == nil {
-			merkles[i] = nil
-			continue
-		}
-		// If only exist left child, copy left child hash to right child
-		if merkles[rc] == nil {
-			merkles[rc] = merkles[lc]
-		}
+	return merkles
+}
+
+func calcMerkle(hasher hash.Hash, lc []byte, rc []byte, buf []byte) []byte {
+	hasher.Reset()
+	hasher.Write(lc)
+	hasher.Write(rc)
+	return hasher.Sum(buf)
+}
 
-		merkles[i] = calcMerkle(hasher, merkles[lc], merkles[rc])
-		//logger.Debug().Int("i", i).Str("m", EncodeB64(merkles[i])).Msg("merkling")
+// forEachRange calls fn for consecutive ranges of [0, n). Ranges are processed by up to workers goroutines
+// if n is large enough, and it returns after all of them are done.
+func forEachRange(n int, workers int, fn func(from, to int)) {
+	if workers <= 1 || n < parallelMinNodes {
+		fn(0, n)
+		return
+	}
+	if maxWorkers := n / (parallelMinNodes / 2); workers > maxWorkers {
+		workers = maxWorkers
 	}
+	chunk := (n + workers - 1) / workers
 
-	return merkles
+	var wg sync.WaitGroup
+	for from := 0; from < n; from += chunk {
+		to := from + chunk
+		if to > n {
+			to = n
+		}
+		wg.Add(1)
+		go func(from, to int) {
+			defer wg.Done()
+			fn(from, to)
+		}(from, to)
+	}
+	wg.Wait()
 }
@@ -9,6 +9,7 @@ import (
 
 	"encoding/base64"
 	"encoding/binary"
+	"fmt"
 	"hash"
 	"testing"
 )
@@ -178,3 +179,34 @@ func BenchmarkMerkle10000Tx(b *testing.B) {
 		CalculateMerkleTree(tms)
 	}
 }
+
+func TestParallelMerkleTree(t *testing.T) {
+	for _, count := range []int{1, 3, parallelMinNodes - 1, parallelMinNodes, parallelMinNodes + 1, 5000, 10000} {
+		beforeTest(count)
+
+		expected := calculateMerkleTree(tms, 1)
+		merkles := calculateMerkleTree(tms, 8)
+		assert.Equal(t, len(expected), len(merkles))
+		for i := range expected {
+			assert.True(t, bytes.Equal(expected[i], merkles[i]), "count=%d, node=%d", count, i)
+		}
+	}
+}
+
+func BenchmarkMerkleTree(b *testing.B) {
+	for _, count := range []int{1000, 10000, 100000} {
+		beforeTest(count)
+		b.Run(fmt.Sprintf("serial-%d", count), func(b *testing.B) {
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				calculateMerkleTree(tms, 1)
+			}
+		})
+		b.Run(fmt.Sprintf("parallel-%d", count), func(b *testing.B) {
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				CalculateMerkleTree(tms)
+			}
+		})
+	}
+}
@@ -61,6 +61,9 @@ type MemPool struct {
 	bestBlockInfo *types.BlockHeaderInfo
 	stateDB       *state.StateDB
 	verifier      *actor.PID
+	// batchVerifier puts batches of txs one at a time, so that they don't occupy the verifiers of single txs
+	// from rpc and peers
+	batchVerifier *actor.PID
 	orphan        int
 	//cache       map[types.TxID]types.Transaction
 	cache             sync.Map
@@ -131,6 +134,7 @@ func (mp *MemPool) AfterStart() {
 
 	mp.verifier = actor.Spawn(router.NewRoundRobinPool(mp.cfg.Mempool.VerifierNumber).
 		WithInstance(NewTxVerifier(mp)))
+	mp.batchVerifier = actor.Spawn(actor.FromInstance(NewTxVerifier(mp)))
 
 	rsp, err := mp.RequestToFuture(message.ChainSvc, &message.GetBestBlock{}, time.Second*2).Result()
 	if err != nil {
@@ -149,6 +153,9 @@ func (mp *MemPool) BeforeStop() {
 	if mp.verifier != nil {
 		mp.verifier.GracefulStop()
 	}
+	if mp.batchVerifier != nil {
+		mp.batchVerifier.GracefulStop()
+	}
 	mp.dumpTxsToFile()
 	mp.quit <- true
 	mp.wg.Wait()
@@ -234,6 +241,8 @@ func (mp *MemPool) Receive(context actor.Context) {
 	switch msg := context.Message().(type) {
 	case *message.MemPoolPut:
 		mp.verifier.Request(msg.Tx, context.Sender())
+	case *message.MemPoolPutTxs:
+		mp.batchVerifier.Request(msg, context.Sender())
 	case *message.MemPoolGet:
 		txs, err := mp.get(msg.MaxBlockBodySize)
 		context.Respond(&message.MemPoolGetRsp{
@@ -338,6 +347,18 @@ Gather:
 // validate
 // add pool if possible, else pendings
 func (mp *MemPool) put(tx types.Transaction) error {
+	acc, err := mp.validateNewTx(tx)
+	if err != nil {
+		return err
+	}
+	mp.Lock()
+	defer mp.Unlock()
+
+	return mp.addTx(tx, acc)
+}
+
+// validateNewTx validates tx against the pool and the state, and returns the account of tx.
+func (mp *MemPool) validateNewTx(tx types.Transaction) (types.Address, error) {
 	id := types.ToTxID(tx.GetHash())
 	acc := tx.GetBody().GetAccount()
 	if tx.HasVerifedAccount() {
@@ -345,7 +366,7 @@ func (mp *MemPool) put(tx types.Transaction) error {
 	}
 
 	if _, ok := mp.cache.Load(id); ok {
-		return types.ErrTxAlreadyInMempool
+		return nil, types.ErrTxAlreadyInMempool
 	}
 	/*
 		err := mp.verifyTx(tx)
@@ -355,11 +376,14 @@ func (mp *MemPool) put(tx types.Transaction) error {
 	*/
 	err := mp.validateTx(tx, acc)
 	if err != nil && err != types.ErrTxNonceToohigh {
-		return err
+		return nil, err
 	}
-	mp.Lock()
-	defer mp.Unlock()
+	return acc, nil
+}
 
+// addTx adds validated tx into the list of acc. mp must be locked by the caller.
+func (mp *MemPool) addTx(tx types.Transaction, acc types.Address) error {
+	id := types.ToTxID(tx.GetHash())
 	list, err := mp.acquireMemPoolList(acc)
 	if err != nil {
 		return err
@@ -390,6 +414,63 @@ func (mp *MemPool) puts(txs ...types.Transaction) []error {
 	return errs
 }
 
+// putTxs puts a batch of txs and returns the error of each tx. The signatures and the states of txs are verified
+// in parallel by the verifier number of goroutines, and then the valid txs are added to the pool under a single lock.
+// It is run by the batch verifier only, so the goroutines of a single batch run at a time.
+func (mp *MemPool) putTxs(txs []*types.Tx) []error {
+	errs := make([]error, len(txs))
+	verified := make([]types.Transaction, len(txs))
+	accs := make([]types.Address, len(txs))
+
+	workers := mp.cfg.Mempool.VerifierNumber
+	if workers > len(txs) {
+		workers = len(txs)
+	}
+	if workers < 1 {
+		workers = 1
+	}
+	var next int32 = -1
+	var wg sync.WaitGroup
+	wg.Add(workers)
+	for w := 0; w < workers; w++ {
+		go func() {
+			defer wg.Done()
+			for i := int(atomic.AddInt32(&next, 1)); i < len(txs); i = int(atomic.AddInt32(&next, 1)) {
+				if _, ok := mp.cache.Load(types.ToTxID(txs[i].GetHash())); ok {
+					errs[i] = types.ErrTxAlreadyInMempool
+					continue
+				}
+				tx := types.NewTransaction(txs[i])
+				// txs of tests are not signed
+				if !mp.testConfig {
+					if errs[i] = mp.verifyTx(tx); errs[i] != nil {
+						continue
+					}
+				}
+				if accs[i], errs[i] = mp.validateNewTx(tx); errs[i] == nil {
+					verified[i] = tx
+				}
+			}
+		}()
+	}
+	wg.Wait()
+
+	mp.Lock()
+	defer mp.Unlock()
+	for i, tx := range verified {
+		if tx == nil {
+			continue
+		}
+		// the same tx may be put by another request while verifying
+		if _, ok := mp.cache.Load(types.ToTxID(tx.GetHash())); ok {
+			errs[i] = types.ErrTxAlreadyInMempool
+			continue
+		}
+		errs[i] = mp.addTx(tx, accs[i])
+	}
+	return errs
+}
+
 func (mp *MemPool) listHash(maxTxSize int) ([]types.TxID, bool) {
 	start := time.Now()
 	mp.RLock()
@@ -6,6 +6,7 @@ package mempool
 
 import (
 	"encoding/binary"
+	"io/ioutil"
 	"math/big"
 	"math/rand"
 	"os"
@@ -15,8 +16,15 @@ import (
 
 	"github.com/aergoio/aergo/cmd/aergocli/util/encoding/json"
 
+	"github.com/aergoio/aergo-actor/actor"
+	"github.com/aergoio/aergo-lib/db"
+	"github.com/aergoio/aergo-lib/log"
+	"github.com/aergoio/aergo/account/key"
 	crypto "github.com/aergoio/aergo/account/key/crypto"
 	"github.com/aergoio/aergo/config"
+	"github.com/aergoio/aergo/message"
+	"github.com/aergoio/aergo/pkg/component"
+	"github.com/aergoio/aergo/state"
 	"github.com/aergoio/aergo/types"
 	"github.com/btcsuite/btcd/btcec"
 	"github.com/stretchr/testify/assert"
@@ -72,7 +80,7 @@ func simulateBlockGen(txs ...types.Transaction) error {
 	//bestBlockNo++
 	return nil
 }
-func initTest(t *testing.T) {
+func initTest(t testing.TB) {
 	pool = newTestPool()
 
 	for i := 0; i < maxAccount; i++ {
@@ -320,6 +328,150 @@ func TestBasics(t *testing.T) {
 	assert.Equal(t, len(txsMempool), len(txs))
 }
 
+func TestPutTxs(t *testing.T) {
+	initTest(t)
+	defer deinitTest()
+	txs := make([]*types.Tx, 0)
+
+	accCount := 10
+	txCount := 10
+	nonce := make([]uint64, txCount)
+	for i := 0; i < txCount; i++ {
+		nonce[i] = uint64(i + 1)
+	}
+	for i := 0; i < accCount; i++ {
+		rand.Shuffle(txCount, func(i, j int) {
+			nonce[i], nonce[j] = nonce[j], nonce[i]
+		})
+		for j := 0; j < txCount; j++ {
+			txs = append(txs, genTx(i, 0, nonce[j], uint64(i+1)).GetTx())
+		}
+	}
+	// duplicated in the batch, and invalid
+	txs = append(txs, txs[0], genTx(accCount, 0, 1, defaultBalance*2).GetTx())
+
+	errs := pool.putTxs(txs)
+	assert.Equal(t, len(txs), len(errs), "error length is different")
+	for i := 0; i < accCount*txCount; i++ {
+		assert.NoError(t, errs[i], "%dth tx failed", i)
+	}
+	assert.Equal(t, types.ErrTxAlreadyInMempool, errs[accCount*txCount])
+	assert.Equal(t, types.ErrInsufficientBalance, errs[accCount*txCount+1])
+
+	total, orphan := pool.Size()
+	assert.EqualValuesf(t, []int{total, orphan}, []int{accCount * txCount, 0}, "wrong mempool stat")
+
+	// already put
+	errs = pool.putTxs(txs[:1])
+	assert.Equal(t, types.ErrTxAlreadyInMempool, errs[0])
+}
+
+// nopComponent drops all messages, e.g. notices of new txs to p2p
+type nopComponent struct {
+	*component.BaseComponent
+}
+
+func (c *nopComponent) Receive(context actor.Context)       {}
+func (c *nopComponent) BeforeStart()                        {}
+func (c *nopComponent) AfterStart()                         {}
+func (c *nopComponent) BeforeStop()                         {}
+func (c *nopComponent) Statistics() *map[string]interface{} { return nil }
+
+// newVerifyingPool returns a pool which verifies txs as a node does, on the state of a genesis block which gives
+// the test accounts enough balance. Notices of new txs are dropped by p2p stub of the returned hub.
+func newVerifyingPool(b *testing.B, dir string) (*MemPool, *component.ComponentHub) {
+	sdb := state.NewChainStateDB()
+	if err := sdb.Init(string(db.BadgerImpl), dir, nil, false); err != nil {
+		b.Fatalf("failed to init state db (%s)", err)
+	}
+	genesis := types.GetTestGenesis()
+	genesis.Balance = make(map[string]string)
+	for i := range accs {
+		genesis.Balance[types.EncodeAddress(accs[i])] = "1000000000000000000000000000"
+	}
+	if err := sdb.SetGenesis(genesis, nil); err != nil {
+		b.Fatalf("failed to set genesis (%s)", err)
+	}
+
+	p2p := &nopComponent{}
+	p2p.BaseComponent = component.NewBaseComponent(message.P2PSvc, p2p, log.NewLogger("p2p"))
+	hub := component.NewComponentHub()
+	hub.Register(p2p)
+	hub.Start()
+
+	serverCtx := config.NewServerContext("", "")
+	mp := NewMemPoolService(serverCtx.GetDefaultConfig().(*config.Config), nil)
+	mp.sdb = sdb
+	mp.SetHub(hub)
+	mp.setStateDB(genesis.Block())
+	return mp, hub
+}
+
+// genSignedTx returns a transfer from acc to rec signed for the chain of chainIdHash
+func genSignedTx(acc int, rec int, nonce uint64, amount uint64, chainIdHash []byte) *types.Tx {
+	tx := &types.Tx{
+		Body: &types.TxBody{
+			Nonce:       nonce,
+			Account:     accs[acc],
+			Recipient:   accs[rec],
+			Amount:      new(big.Int).SetUint64(amount).Bytes(),
+			Type:        types.TxType_TRANSFER,
+			ChainIdHash: chainIdHash,
+		},
+	}
+	_ = key.SignTx(tx, sign[acc])
+	return tx
+}
+
+// BenchmarkPutTxs compares putting signed txs one by one as the tx verifier does with putting them in a batch. The
+// signatures and the states of txs are verified by the pool. The rate of txs per second is
+// accCount * txCount / (ns/op) * 1e9.
+func BenchmarkPutTxs(b *testing.B) {
+	initTest(b)
+	dir, _ := ioutil.TempDir("", "mempool")
+	defer os.RemoveAll(dir)
+	pool, hub := newVerifyingPool(b, dir)
+	defer hub.Stop()
+
+	const (
+		accCount = 100
+		txCount  = 100
+	)
+	txs := make([]*types.Tx, 0, accCount*txCount)
+	for i := 0; i < accCount; i++ {
+		for j := 0; j < txCount; j++ {
+			txs = append(txs, genSignedTx(i, accCount+i, uint64(j+1), 1, pool.acceptChainIdHash))
+		}
+	}
+	for i, err := range pool.putTxs(txs[:txCount]) {
+		if err != nil {
+			b.Fatalf("%dth tx failed (%s)", i, err)
+		}
+	}
+
+	b.Run("Put", func(b *testing.B) {
+		for n := 0; n < b.N; n++ {
+			b.StopTimer()
+			pool.resetAll()
+			b.StartTimer()
+			for _, tx := range txs {
+				tx := types.NewTransaction(tx)
+				if err := pool.verifyTx(tx); err == nil {
+					_ = pool.put(tx)
+				}
+			}
+		}
+	})
+	b.Run("PutTxs", func(b *testing.B) {
+		for n := 0; n < b.N; n++ {
+			b.StopTimer()
+			pool.resetAll()
+			b.StartTimer()
+			_ = pool.putTxs(txs)
+		}
+	})
+}
+
 func TestDeleteOTxs(t *testing.T) {
 	initTest(t)
 	defer deinitTest()
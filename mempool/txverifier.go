@@ -35,5 +35,9 @@ func (s *TxVerifier) Receive(context actor.Context) {
 			}
 		}
 		context.Respond(&message.MemPoolPutRsp{Err: err})
+	case *message.MemPoolPutTxs:
+		errs := s.mp.putTxs(msg.Txs)
+		s.mp.Logger.Debug().Int("txs", len(msg.Txs)).Msg("tx batch put")
+		context.Respond(&message.MemPoolPutTxsRsp{Errs: errs})
 	}
 }
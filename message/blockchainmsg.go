@@ -39,6 +39,8 @@ type AddBlock struct {
 	Block  *types.Block
 	Bstate interface{}
 	IsSync bool
+	// Diff is the state diff shipped with the block by its producer, which is applied instead of executing txs
+	Diff interface{}
 	// Bstate *types.BlockState
 }
 type AddBlockRsp struct {
@@ -46,6 +48,17 @@ type AddBlockRsp struct {
 	BlockHash []byte
 	Err       error
 }
+
+// SetStateSyncPoint tells chain that the state of block No is imported by state sync, so blocks up to it are
+// connected without execution.
+type SetStateSyncPoint struct {
+	No   types.BlockNo
+	Hash []byte
+	Root []byte
+}
+type SetStateSyncPointRsp struct {
+	Err error
+}
 type GetState struct {
 	Account []byte
 }
@@ -101,6 +114,8 @@ type GetStateQuery struct {
 	StorageKeys     [][]byte
 	Root            []byte
 	Compressed      bool
+	// MultiProof requests a proof of all storage keys which shares the audit path
+	MultiProof bool
 }
 type GetStateQueryRsp struct {
 	Result *types.StateQueryProof
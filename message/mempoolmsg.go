@@ -22,6 +22,16 @@ type MemPoolPutRsp struct {
 	Err error
 }
 
+// MemPoolPutTxs is interface of MemPool service for inserting a batch of transactions at once
+type MemPoolPutTxs struct {
+	Txs []*types.Tx
+}
+
+// MemPoolPutTxsRsp defines struct of result for MemPoolPutTxs. Errs has the error of each transaction in order
+type MemPoolPutTxsRsp struct {
+	Errs []error
+}
+
 // MemPoolGet is interface of MemPool service for retrieving transactions
 type MemPoolGet struct {
 	MaxBlockBodySize uint32
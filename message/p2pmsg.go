@@ -82,6 +82,24 @@ type GetBlockHeaders struct {
 	MaxSize uint32
 }
 
+// GetSyncHeaders requests Count headers of blocks which end at the block of Hash to dest peer, for syncer.
+// The response is sent to syncer as GetSyncHeadersRsp.
+type GetSyncHeaders struct {
+	Seq    uint64
+	ToWhom types.PeerID
+	Hash   BlockHash
+	Count  uint32
+}
+
+// GetSyncHeadersRsp has headers in descending order of block number
+type GetSyncHeadersRsp struct {
+	Seq     uint64
+	ToWhom  types.PeerID
+	Hash    BlockHash
+	Headers []*types.BlockHeader
+	Err     error
+}
+
 // BlockHeadersResponse is data from other peer, as a response of types.GetBlockRequest
 // p2p module will send this to chainservice actor.
 type BlockHeadersResponse struct {
@@ -184,6 +202,31 @@ type GetHashByNoRsp struct {
 	Err       error
 }
 
+// GetStateChunk requests leaves of a state trie in [Start, End) to a peer. A contract storage is requested with
+// StateRoot and Account, where the peer finds Root. If Sql is true, the sql database of the contract is requested
+// from Offset of Snapshot instead.
+type GetStateChunk struct {
+	Seq       uint64
+	ToWhom    types.PeerID
+	Root      []byte
+	Start     []byte
+	End       []byte
+	Limit     uint32
+	Accounts  bool
+	StateRoot []byte
+	Account   []byte
+	Sql       bool
+	Offset    uint64
+	Snapshot  uint64
+}
+
+type GetStateChunkRsp struct {
+	Seq    uint64
+	ToWhom types.PeerID
+	Chunk  *types.GetStateChunkResponse
+	Err    error
+}
+
 type GetSelf struct {
 }
 
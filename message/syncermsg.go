@@ -13,6 +13,17 @@ type SyncStart struct {
 	NotifyC  chan error
 }
 
+// StateSyncStart requests syncer to download the state of Root from peers, instead of executing blocks to it.
+// The result is sent to NotifyC if it is not nil. If Hash of block No having Root is set, syncer continues by block
+// sync to the block after the state is imported, or by executing blocks if the state can't be imported.
+type StateSyncStart struct {
+	Root    []byte
+	No      types.BlockNo
+	Hash    []byte
+	PeerIDs []types.PeerID
+	NotifyC chan error
+}
+
 type FinderResult struct {
 	Seq      uint64
 	Ancestor *types.BlockInfo
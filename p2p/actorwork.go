@@ -56,6 +56,18 @@ func (p2ps *P2P) GetBlockHeaders(msg *message.GetBlockHeaders) bool {
 	return true
 }
 
+// GetSyncHeaders send request message to peer and make response message of block headers for syncer
+func (p2ps *P2P) GetSyncHeaders(msg *message.GetSyncHeaders) {
+	remotePeer, exists := p2ps.pm.GetPeer(msg.ToWhom)
+	if !exists {
+		p2ps.Warn().Str(p2putil.LogPeerID, p2putil.ShortForm(msg.ToWhom)).Str(p2putil.LogProtoID, p2pcommon.GetBlockHeadersRequest.String()).Msg("Invalid peerID")
+		p2ps.TellRequest(message.SyncerSvc, &message.GetSyncHeadersRsp{Seq: msg.Seq, ToWhom: msg.ToWhom, Hash: msg.Hash, Err: message.PeerNotFoundError})
+		return
+	}
+	receiver := NewBlockHeadersReceiver(p2ps, remotePeer, msg, fetchTimeOut)
+	receiver.StartGet()
+}
+
 // GetBlocks send request message to peer and
 func (p2ps *P2P) GetBlocks(peerID types.PeerID, blockHashes []message.BlockHash) bool {
 	remotePeer, exists := p2ps.pm.GetPeer(peerID)
@@ -122,6 +134,20 @@ func (p2ps *P2P) GetBlockHashByNo(context actor.Context, msg *message.GetHashByN
 	receiver.StartGet()
 }
 
+// GetStateChunk send request message to peer and make response message for leaves of state trie
+func (p2ps *P2P) GetStateChunk(context actor.Context, msg *message.GetStateChunk) {
+	peerID := msg.ToWhom
+
+	remotePeer, exists := p2ps.pm.GetPeer(peerID)
+	if !exists {
+		p2ps.Warn().Str(p2putil.LogPeerID, p2putil.ShortForm(peerID)).Str(p2putil.LogProtoID, p2pcommon.GetStateChunkRequest.String()).Msg("Invalid peerID")
+		p2ps.TellRequest(message.SyncerSvc, &message.GetStateChunkRsp{Seq: msg.Seq, ToWhom: peerID, Err: message.PeerNotFoundError})
+		return
+	}
+	receiver := NewStateChunkReceiver(p2ps, remotePeer, msg, fetchTimeOut)
+	receiver.StartGet()
+}
+
 // NotifyNewBlock send notice message of new block to a peer
 func (p2ps *P2P) NotifyNewBlock(blockNotice message.NotifyNewBlock) bool {
 	req := &types.NewBlockNotice{
@@ -152,20 +178,32 @@ func (p2ps *P2P) NotifyBlockProduced(blockNotice message.NotifyNewBlock) bool {
 	mo := p2ps.mf.NewMsgBPBroadcastOrder(req)
 
 	peers := p2ps.pm.GetPeers()
-	sent, skipped := 0,0
+	sent, compact, skipped := 0, 0, 0
 	for _, neighbor := range peers {
 		if neighbor.State() == types.RUNNING {
 			sent++
-			neighbor.SendMessage(mo)
+			if p2ps.useCompactBlock(neighbor) {
+				compact++
+				neighbor.SendMessage(p2ps.mf.NewMsgCompactBlockOrder(newCompactBlockNotice(blockNotice.BlockNo, blockNotice.Block, neighbor)))
+			} else {
+				neighbor.SendMessage(mo)
+			}
 		} else {
 			skipped++
 		}
 	}
 
-	p2ps.Debug().Int("skipped_cnt", skipped).Int("sent_cnt", sent).Str("hash", enc.ToString(blockNotice.Block.BlockHash())).Uint64("block_no", req.BlockNo).Msg("Notifying block produced")
+	p2ps.Debug().Int("skipped_cnt", skipped).Int("sent_cnt", sent).Int("compact_cnt", compact).Str("hash", enc.ToString(blockNotice.Block.BlockHash())).Uint64("block_no", req.BlockNo).Msg("Notifying block produced")
 	return true
 }
 
+// useCompactBlock returns whether produced block is sent to the peer in compact form. Agents get full block
+// since they toss the notice to other peers as it is, and raft uses its own block propagation.
+func (p2ps *P2P) useCompactBlock(peer p2pcommon.RemotePeer) bool {
+	return !p2ps.useRaft && peer.AcceptedRole() != types.PeerRole_Agent &&
+		peer.RemoteInfo().Capabilities.Has(p2pcommon.CapCompactBlock)
+}
+
 // GetTXs send request message to peer and
 func (p2ps *P2P) GetTXs(peerID types.PeerID, txHashes []message.TXHash) bool {
 	remotePeer, ok := p2ps.pm.GetPeer(peerID)
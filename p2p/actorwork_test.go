@@ -235,6 +235,7 @@ func TestP2P_NotifyBlockProduced(t *testing.T) {
 				mPeer.EXPECT().ID().Return(types.RandomPeerID()).AnyTimes()
 				mPeer.EXPECT().AcceptedRole().Return(ap.r).AnyTimes()
 				mPeer.EXPECT().State().Return(ap.s).AnyTimes()
+				mPeer.EXPECT().RemoteInfo().Return(p2pcommon.RemoteInfo{}).AnyTimes()
 				mPeer.EXPECT().SendMessage(gomock.Any()).Do(func(_ interface{}) {
 					sentCnt++
 				}).MaxTimes(1)
@@ -250,4 +251,55 @@ func TestP2P_NotifyBlockProduced(t *testing.T) {
 			}
 		})
 	}
-}
\ No newline at end of file
+}
+
+func TestP2P_NotifyBlockProducedCompact(t *testing.T) {
+	tests := []struct {
+		name    string
+		useRaft bool
+		role    types.PeerRole
+		caps    p2pcommon.PeerCapability
+
+		wantCompact bool
+	}{
+		{"TCompact", false, types.PeerRole_Producer, p2pcommon.CapCompactBlock, true},
+		{"TOldPeer", false, types.PeerRole_Producer, 0, false},
+		{"TAgent", false, types.PeerRole_Agent, p2pcommon.CapCompactBlock, false},
+		{"TRaft", true, types.PeerRole_Producer, p2pcommon.CapCompactBlock, false},
+	}
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			ctrl := gomock.NewController(t)
+			defer ctrl.Finish()
+
+			mockPM := p2pmock.NewMockPeerManager(ctrl)
+			mockMF := p2pmock.NewMockMoFactory(ctrl)
+			p2ps := &P2P{pm: mockPM, mf: mockMF, useRaft: tt.useRaft}
+			p2ps.BaseComponent = component.NewBaseComponent(message.P2PSvc, p2ps, log.NewLogger("p2p.test"))
+
+			tx := &types.Tx{Body: &types.TxBody{Nonce: 1}}
+			tx.Hash = tx.CalculateTxHash()
+			dummyNotice := message.NotifyNewBlock{Block: &types.Block{Hash: []byte(types.RandomPeerID()), Header: &types.BlockHeader{}, Body: &types.BlockBody{Txs: []*types.Tx{tx}}}}
+
+			mPeer := p2pmock.NewMockRemotePeer(ctrl)
+			mPeer.EXPECT().State().Return(types.RUNNING).AnyTimes()
+			mPeer.EXPECT().AcceptedRole().Return(tt.role).AnyTimes()
+			mPeer.EXPECT().RemoteInfo().Return(p2pcommon.RemoteInfo{Capabilities: tt.caps}).AnyTimes()
+			mPeer.EXPECT().KnownTx(gomock.Any()).Return(true).AnyTimes()
+			mPeer.EXPECT().SendMessage(gomock.Any()).Times(1)
+			mockPM.EXPECT().GetPeers().Return([]p2pcommon.RemotePeer{mPeer})
+			mockMF.EXPECT().NewMsgBPBroadcastOrder(gomock.Any())
+			compactCnt := 0
+			if tt.wantCompact {
+				compactCnt = 1
+			}
+			mockMF.EXPECT().NewMsgCompactBlockOrder(gomock.Any()).Do(func(notice *types.CompactBlockNotice) {
+				if len(notice.Prefilled) != 0 || len(notice.TxHashes) != 1 {
+					t.Errorf("unexpected compact notice %v", notice)
+				}
+			}).Times(compactCnt)
+
+			_ = p2ps.NotifyBlockProduced(dummyNotice)
+		})
+	}
+}
@@ -0,0 +1,203 @@
+/*
+ * @file
+ * @copyright defined in aergo/LICENSE.txt
+ */
+
+package p2p
+
+import (
+	"bytes"
+	"sync"
+	"time"
+
+	"github.com/aergoio/aergo-lib/log"
+	"github.com/aergoio/aergo/chain"
+	"github.com/aergoio/aergo/internal/enc"
+	"github.com/aergoio/aergo/message"
+	"github.com/aergoio/aergo/p2p/p2pcommon"
+	"github.com/aergoio/aergo/p2p/p2putil"
+	"github.com/aergoio/aergo/types"
+	lru "github.com/hashicorp/golang-lru"
+)
+
+// newCompactBlockNotice makes compact form of produced block for a remote peer. Txs which the remote peer
+// is not known to have are prefilled in notice, and the others are sent in hashes only.
+func newCompactBlockNotice(blockNo types.BlockNo, block *types.Block, peer p2pcommon.RemotePeer) *types.CompactBlockNotice {
+	txs := block.GetBody().GetTxs()
+	notice := &types.CompactBlockNotice{BlockNo: blockNo, Block: &types.Block{Hash: block.Hash, Header: block.Header},
+		TxHashes: make([][]byte, len(txs))}
+	for i, tx := range txs {
+		notice.TxHashes[i] = tx.Hash
+		if !peer.KnownTx(types.ToTxID(tx.Hash)) {
+			notice.Prefilled = append(notice.Prefilled, tx)
+		}
+	}
+	return notice
+}
+
+// compactBlockReceiver reconstructs block from compact block notice. It fills txs from prefilled txs in notice,
+// local tx cache and mempool, and then requests the missing txs to the remote peer. Full block is requested instead
+// if remote peer failed to send missing txs in time or the reconstructed block is wrong.
+type compactBlockReceiver struct {
+	actor     p2pcommon.ActorService
+	peer      p2pcommon.RemotePeer
+	logger    *log.Logger
+	msgHelper message.Helper
+	txCache   *lru.Cache
+
+	block     *types.Block
+	txHashes  [][]byte
+	prefilled []*types.Tx
+	ttl       time.Duration
+
+	// fields below are guarded by mutex, since response and timeout are handled in different goroutines.
+	mutex     sync.Mutex
+	status    receiverStatus
+	requestID p2pcommon.MsgID
+	txs       []*types.Tx
+	missing   []uint32
+}
+
+func newCompactBlockReceiver(actor p2pcommon.ActorService, peer p2pcommon.RemotePeer, logger *log.Logger, txCache *lru.Cache, data *types.CompactBlockNotice, ttl time.Duration) *compactBlockReceiver {
+	block := &types.Block{Hash: data.Block.Hash, Header: data.Block.Header, Body: &types.BlockBody{}}
+	return &compactBlockReceiver{actor: actor, peer: peer, logger: logger, msgHelper: message.GetHelper(), txCache: txCache,
+		block: block, txHashes: data.TxHashes, prefilled: data.Prefilled, ttl: ttl, txs: make([]*types.Tx, len(data.TxHashes))}
+}
+
+// StartGet fills txs which local node already have, and requests missing txs to remote peer.
+// It must be called in a separate goroutine, since it waits responses of mempool.
+func (r *compactBlockReceiver) StartGet() {
+	r.mutex.Lock()
+	defer r.mutex.Unlock()
+	if !r.fillLocalTxs() {
+		r.fallback()
+		return
+	}
+	if len(r.missing) == 0 {
+		r.finish()
+		return
+	}
+
+	req := &types.GetBlockTxsRequest{BlockHash: r.block.Hash, Indexes: r.missing}
+	mo := r.peer.MF().NewMsgRequestOrderWithReceiver(r.ReceiveResp, p2pcommon.GetBlockTxsRequest, req)
+	r.requestID = mo.GetMsgID()
+	r.peer.SendMessage(mo)
+	time.AfterFunc(r.ttl, r.checkTimeout)
+}
+
+// fillLocalTxs returns false if remote peer sent invalid prefilled txs.
+func (r *compactBlockReceiver) fillLocalTxs() bool {
+	prefilled := make(map[types.TxID]*types.Tx, len(r.prefilled))
+	for _, tx := range r.prefilled {
+		if !isValidTxHash(tx) {
+			r.logger.Info().Str(p2putil.LogPeerName, r.peer.Name()).Str(p2putil.LogBlkHash, enc.ToString(r.block.Hash)).Msg("invalid prefilled tx in compact block")
+			return false
+		}
+		prefilled[types.ToTxID(tx.Hash)] = tx
+	}
+
+	var mpHashes [][]byte
+	var mpIndexes []int
+	for i, hash := range r.txHashes {
+		txID := types.ToTxID(hash)
+		if tx, found := prefilled[txID]; found {
+			r.txs[i] = tx
+		} else if tx, found := r.txCache.Get(txID); found {
+			r.txs[i] = tx.(*types.Tx)
+		} else {
+			mpHashes = append(mpHashes, hash)
+			mpIndexes = append(mpIndexes, i)
+		}
+	}
+
+	for offset := 0; offset < len(mpHashes); offset += message.MaxReqestHashes {
+		end := offset + message.MaxReqestHashes
+		if end > len(mpHashes) {
+			end = len(mpHashes)
+		}
+		txs, err := r.msgHelper.ExtractTxsFromResponseAndError(r.actor.CallRequestDefaultTimeout(message.MemPoolSvc,
+			&message.MemPoolExistEx{Hashes: mpHashes[offset:end]}))
+		if err != nil {
+			// txs not found in mempool will be requested to remote peer
+			r.logger.Debug().Err(err).Msg("failed to get txs of compact block from mempool")
+			continue
+		}
+		for j, idx := range mpIndexes[offset:end] {
+			if j < len(txs) && txs[j] != nil {
+				r.txs[idx] = txs[j]
+			}
+		}
+	}
+
+	for i, tx := range r.txs {
+		if tx == nil {
+			r.missing = append(r.missing, uint32(i))
+		}
+	}
+	return true
+}
+
+// ReceiveResp must be called just in read go routine
+func (r *compactBlockReceiver) ReceiveResp(msg p2pcommon.Message, msgBody p2pcommon.MessageBody) bool {
+	r.mutex.Lock()
+	defer r.mutex.Unlock()
+	if r.status != receiverStatusWaiting {
+		return true
+	}
+	r.peer.ConsumeRequest(r.requestID)
+
+	body, ok := msgBody.(*types.GetBlockTxsResponse)
+	if !ok || body.Status != types.ResultStatus_OK || len(body.Txs) != len(r.missing) {
+		r.fallback()
+		return true
+	}
+	for i, idx := range r.missing {
+		tx := body.Txs[i]
+		if !bytes.Equal(tx.GetHash(), r.txHashes[idx]) || !isValidTxHash(tx) {
+			r.fallback()
+			return true
+		}
+		r.txs[idx] = tx
+	}
+	r.finish()
+	return true
+}
+
+func (r *compactBlockReceiver) checkTimeout() {
+	r.mutex.Lock()
+	defer r.mutex.Unlock()
+	if r.status != receiverStatusWaiting {
+		return
+	}
+	r.logger.Debug().Str(p2putil.LogPeerName, r.peer.Name()).Str(p2putil.LogBlkHash, enc.ToString(r.block.Hash)).Msg("timeout to get missing txs of compact block")
+	r.peer.ConsumeRequest(r.requestID)
+	r.fallback()
+}
+
+// finish sends reconstructed block to chainservice. it must be called in mutex.
+func (r *compactBlockReceiver) finish() {
+	r.status = receiverStatusFinished
+	r.block.Body.Txs = r.txs
+	if !bytes.Equal(types.CalculateTxsRootHash(r.txs), r.block.GetHeader().GetTxsRootHash()) {
+		r.logger.Info().Str(p2putil.LogPeerName, r.peer.Name()).Str(p2putil.LogBlkHash, enc.ToString(r.block.Hash)).Msg("txs root of reconstructed compact block mismatched")
+		r.fallback()
+		return
+	}
+	if r.block.Size() > int(chain.MaxBlockSize()) {
+		r.logger.Info().Str(p2putil.LogPeerName, r.peer.Name()).Str(p2putil.LogBlkHash, enc.ToString(r.block.Hash)).Int("size", r.block.Size()).Msg("invalid compact block. block size exceed limit")
+		return
+	}
+	r.actor.SendRequest(message.ChainSvc, &message.AddBlock{PeerID: r.peer.ID(), Block: r.block, Bstate: nil})
+}
+
+// fallback requests full block to remote peer. it must be called in mutex.
+func (r *compactBlockReceiver) fallback() {
+	r.status = receiverStatusCanceled
+	r.actor.SendRequest(message.P2PSvc, &message.GetBlockInfos{ToWhom: r.peer.ID(),
+		Hashes: []message.BlockHash{message.BlockHash(r.block.Hash)}})
+}
+
+// isValidTxHash checks if the tx from remote peer has hash of its body.
+func isValidTxHash(tx *types.Tx) bool {
+	return tx != nil && tx.Body != nil && bytes.Equal(tx.Hash, tx.CalculateTxHash())
+}
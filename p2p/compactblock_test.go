@@ -0,0 +1,148 @@
+/*
+ * @file
+ * @copyright defined in aergo/LICENSE.txt
+ */
+
+package p2p
+
+import (
+	"testing"
+	"time"
+
+	"github.com/aergoio/aergo/chain"
+	"github.com/aergoio/aergo/message"
+	"github.com/aergoio/aergo/p2p/p2pcommon"
+	"github.com/aergoio/aergo/p2p/p2pmock"
+	"github.com/aergoio/aergo/types"
+	"github.com/golang/mock/gomock"
+	lru "github.com/hashicorp/golang-lru"
+	"github.com/stretchr/testify/assert"
+)
+
+func makeCompactTestBlock(txCnt int) *types.Block {
+	txs := make([]*types.Tx, txCnt)
+	for i := range txs {
+		tx := &types.Tx{Body: &types.TxBody{Nonce: uint64(i + 1), Account: []byte("account")}}
+		tx.Hash = tx.CalculateTxHash()
+		txs[i] = tx
+	}
+	header := &types.BlockHeader{BlockNo: 100, TxsRootHash: types.CalculateTxsRootHash(txs)}
+	return &types.Block{Hash: dummyBlockHash, Header: header, Body: &types.BlockBody{Txs: txs}}
+}
+
+func TestNewCompactBlockNotice(t *testing.T) {
+	ctrl := gomock.NewController(t)
+	defer ctrl.Finish()
+
+	block := makeCompactTestBlock(10)
+	tests := []struct {
+		name  string
+		known func(types.TxID) bool
+
+		wantPrefilled int
+	}{
+		{"TAllKnown", func(types.TxID) bool { return true }, 0},
+		{"TNoneKnown", func(types.TxID) bool { return false }, 10},
+		{"TPartial", func(id types.TxID) bool { return id != types.ToTxID(block.Body.Txs[3].Hash) }, 1},
+	}
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			mockPeer := p2pmock.NewMockRemotePeer(ctrl)
+			mockPeer.EXPECT().KnownTx(gomock.Any()).DoAndReturn(tt.known).Times(len(block.Body.Txs))
+
+			notice := newCompactBlockNotice(block.Header.BlockNo, block, mockPeer)
+			assert.Nil(t, notice.Block.Body)
+			assert.Equal(t, block.Hash, notice.Block.Hash)
+			assert.Equal(t, len(block.Body.Txs), len(notice.TxHashes))
+			assert.Equal(t, tt.wantPrefilled, len(notice.Prefilled))
+		})
+	}
+}
+
+func TestCompactBlockReceiver(t *testing.T) {
+	ctrl := gomock.NewController(t)
+	defer ctrl.Finish()
+	chain.Init(1<<20, "", false, 1, 1)
+
+	block := makeCompactTestBlock(6)
+	txs := block.Body.Txs
+	wrongTx := &types.Tx{Body: &types.TxBody{Nonce: 99}, Hash: txs[5].Hash}
+
+	tests := []struct {
+		name      string
+		prefilled []*types.Tx
+		cached    []*types.Tx
+		inMempool []*types.Tx
+		// nil means no response is expected
+		respTxs []*types.Tx
+
+		wantAdd      bool
+		wantFallback bool
+	}{
+		{"TAllLocal", txs[:2], txs[2:4], txs[4:], nil, true, false},
+		{"TMissing", txs[:2], txs[2:4], nil, txs[4:], true, false},
+		{"TWrongResp", txs[:2], txs[2:4], nil, []*types.Tx{txs[4], wrongTx}, false, true},
+		{"TFewerResp", txs[:2], txs[2:4], nil, txs[4:5], false, true},
+		{"TInvalidPrefilled", []*types.Tx{wrongTx}, nil, nil, nil, false, true},
+	}
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			mockActor := p2pmock.NewMockActorService(ctrl)
+			mockPeer := p2pmock.NewMockRemotePeer(ctrl)
+			mockMF := p2pmock.NewMockMoFactory(ctrl)
+			mockMO := p2pmock.NewMockMsgOrder(ctrl)
+			mockPeer.EXPECT().ID().Return(dummyPeerID).AnyTimes()
+			mockPeer.EXPECT().Name().Return("dummyPeer").AnyTimes()
+			mockPeer.EXPECT().MF().Return(mockMF).AnyTimes()
+			mockPeer.EXPECT().ConsumeRequest(gomock.Any()).AnyTimes()
+			mockMO.EXPECT().GetMsgID().Return(p2pcommon.NewMsgID()).AnyTimes()
+
+			txCache, _ := lru.New(100)
+			for _, tx := range tt.cached {
+				txCache.Add(types.ToTxID(tx.Hash), tx)
+			}
+			mockActor.EXPECT().CallRequestDefaultTimeout(message.MemPoolSvc, gomock.AssignableToTypeOf(&message.MemPoolExistEx{})).DoAndReturn(func(_ string, arg *message.MemPoolExistEx) (interface{}, error) {
+				ret := make([]*types.Tx, len(arg.Hashes))
+				for i, hash := range arg.Hashes {
+					for _, tx := range tt.inMempool {
+						if types.ToTxID(hash) == types.ToTxID(tx.Hash) {
+							ret[i] = tx
+						}
+					}
+				}
+				return &message.MemPoolExistExRsp{Txs: ret}, nil
+			}).AnyTimes()
+			var sentReq *types.GetBlockTxsRequest
+			mockMF.EXPECT().NewMsgRequestOrderWithReceiver(gomock.Any(), p2pcommon.GetBlockTxsRequest, gomock.Any()).DoAndReturn(func(_ p2pcommon.ResponseReceiver, _ p2pcommon.SubProtocol, req p2pcommon.MessageBody) p2pcommon.MsgOrder {
+				sentReq = req.(*types.GetBlockTxsRequest)
+				return mockMO
+			}).AnyTimes()
+			mockPeer.EXPECT().SendMessage(mockMO).AnyTimes()
+
+			added, fallback := false, false
+			mockActor.EXPECT().SendRequest(message.ChainSvc, gomock.AssignableToTypeOf(&message.AddBlock{})).Do(func(_ string, arg *message.AddBlock) {
+				added = true
+				assert.Equal(t, len(txs), len(arg.Block.Body.Txs))
+			}).MaxTimes(1)
+			mockActor.EXPECT().SendRequest(message.P2PSvc, gomock.AssignableToTypeOf(&message.GetBlockInfos{})).Do(func(_ string, _ interface{}) {
+				fallback = true
+			}).MaxTimes(1)
+
+			hashes := make([][]byte, len(txs))
+			for i, tx := range txs {
+				hashes[i] = tx.Hash
+			}
+			data := &types.CompactBlockNotice{BlockNo: block.Header.BlockNo, Block: &types.Block{Hash: block.Hash, Header: block.Header}, TxHashes: hashes, Prefilled: tt.prefilled}
+			r := newCompactBlockReceiver(mockActor, mockPeer, logger, txCache, data, time.Minute)
+			r.StartGet()
+			if tt.respTxs != nil {
+				assert.NotNil(t, sentReq)
+				r.ReceiveResp(nil, &types.GetBlockTxsResponse{Status: types.ResultStatus_OK, BlockHash: block.Hash, Txs: tt.respTxs})
+				// late responses or timeout are ignored
+				r.checkTimeout()
+			}
+			assert.Equal(t, tt.wantAdd, added)
+			assert.Equal(t, tt.wantFallback, fallback)
+		})
+	}
+}
@@ -15,8 +15,14 @@ const (
 	defaultPingInterval = time.Second * 60
 	// txNoticeInterval is max wait time when not sufficient txs to notify is collected. i.e newTxNotice is sent to peer within this time.
 	txNoticeInterval = time.Second * 1
-	// writeMsgBufferSize is queue size of message to a peer. connection will be closed when queue is exceeded.
+	// txNoticeIntervalFast is txNoticeInterval for remote peers which are block producers or agents.
+	txNoticeIntervalFast = time.Millisecond * 200
+	// writeMsgBufferSize is queue size of message to a peer, for each priority. connection will be closed when queue is exceeded.
 	writeMsgBufferSize = 40
+	// maxWriteBatch is max number of queued messages which are written to a peer before flush.
+	maxWriteBatch = 16
+	// maxUrgentBurst is max number of urgent messages sent in a row, before other messages get a turn.
+	maxUrgentBurst = 8
 )
 
 // constants for node discovery
@@ -57,4 +63,7 @@ const (
 	HourlyInterval          = time.Hour
 	TenMinutesInterval      = time.Minute * 10
 	MinNewBlkNoticeInterval = time.Second >> 2
+
+	// compactBlockTxTimeout is max wait time for missing txs of compact block. full block is requested after timeout.
+	compactBlockTxTimeout = time.Second * 3
 )
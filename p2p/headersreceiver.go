@@ -0,0 +1,63 @@
+/*
+ * @file
+ * @copyright defined in aergo/LICENSE.txt
+ */
+
+package p2p
+
+import (
+	"time"
+
+	"github.com/aergoio/aergo/message"
+	"github.com/aergoio/aergo/p2p/p2pcommon"
+	"github.com/aergoio/aergo/types"
+)
+
+// BlockHeadersReceiver sends p2p GetBlockHeadersRequest to target peer and tells the headers to syncer.
+// It doesn't send response if timeout expired, and syncer handles the timeout by itself.
+type BlockHeadersReceiver struct {
+	requestID p2pcommon.MsgID
+
+	peer  p2pcommon.RemotePeer
+	actor p2pcommon.ActorService
+
+	req      *message.GetSyncHeaders
+	timeout  time.Time
+	finished bool
+}
+
+func NewBlockHeadersReceiver(actor p2pcommon.ActorService, peer p2pcommon.RemotePeer, req *message.GetSyncHeaders, ttl time.Duration) *BlockHeadersReceiver {
+	timeout := time.Now().Add(ttl)
+	return &BlockHeadersReceiver{actor: actor, peer: peer, req: req, timeout: timeout}
+}
+
+func (br *BlockHeadersReceiver) StartGet() {
+	// create message data. headers are returned from the block of hash to its ancestors
+	req := &types.GetBlockHeadersRequest{Hash: br.req.Hash, Size: br.req.Count}
+	mo := br.peer.MF().NewMsgRequestOrderWithReceiver(br.ReceiveResp, p2pcommon.GetBlockHeadersRequest, req)
+	br.requestID = mo.GetMsgID()
+	br.peer.SendMessage(mo)
+}
+
+// ReceiveResp must be called just in read go routine
+func (br *BlockHeadersReceiver) ReceiveResp(msg p2pcommon.Message, msgBody p2pcommon.MessageBody) (ret bool) {
+	ret = true
+	br.peer.ConsumeRequest(br.requestID)
+	// timeout
+	if br.finished || br.timeout.Before(time.Now()) {
+		// silently ignore already finished job
+		br.finished = true
+		return
+	}
+	br.finished = true
+
+	rsp := &message.GetSyncHeadersRsp{Seq: br.req.Seq, ToWhom: br.peer.ID(), Hash: br.req.Hash}
+	body := msgBody.(*types.GetBlockHeadersResponse)
+	if body.Status != types.ResultStatus_OK {
+		rsp.Err = message.RemotePeerFailError
+	} else {
+		rsp.Headers = body.Headers
+	}
+	br.actor.TellRequest(message.SyncerSvc, rsp)
+	return
+}
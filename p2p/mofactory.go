@@ -72,6 +72,16 @@ func (mf *baseMOFactory) NewMsgTxBroadcastOrder(message *types.NewTransactionsNo
 	return nil
 }
 
+func (mf *baseMOFactory) NewMsgTxShortBroadcastOrder(message *types.NewTxShortNotice) p2pcommon.MsgOrder {
+	rmo := &pbTxNoticeOrder{}
+	reqID := uuid.Must(uuid.NewV4())
+	if mf.fillUpMsgOrder(&rmo.pbMessageOrder, reqID, uuid.Nil, p2pcommon.NewTxShortNotice, message) {
+		rmo.shortCnt = len(message.ShortIDs)
+		return rmo
+	}
+	return nil
+}
+
 func (mf *baseMOFactory) NewMsgBPBroadcastOrder(noticeMsg *types.BlockProducedNotice) p2pcommon.MsgOrder {
 	rmo := &pbBpNoticeOrder{}
 	msgID := uuid.Must(uuid.NewV4())
@@ -82,6 +92,16 @@ func (mf *baseMOFactory) NewMsgBPBroadcastOrder(noticeMsg *types.BlockProducedNo
 	return nil
 }
 
+func (mf *baseMOFactory) NewMsgCompactBlockOrder(noticeMsg *types.CompactBlockNotice) p2pcommon.MsgOrder {
+	rmo := &pbBpNoticeOrder{}
+	msgID := uuid.Must(uuid.NewV4())
+	if mf.fillUpMsgOrder(&rmo.pbMessageOrder, msgID, uuid.Nil, p2pcommon.CompactBlockNotice, noticeMsg) {
+		rmo.block = noticeMsg.Block
+		return rmo
+	}
+	return nil
+}
+
 func (mf *baseMOFactory) NewRaftMsgOrder(msgType raftpb.MessageType, raftMsg *raftpb.Message) p2pcommon.MsgOrder {
 	rmo := &pbRaftMsgOrder{msg: raftMsg, raftAcc: mf.is.ConsensusAccessor().RaftAccessor()}
 	msgID := uuid.Must(uuid.NewV4())
@@ -178,6 +178,8 @@ func (pr *pbBpNoticeOrder) SendTo(pi p2pcommon.RemotePeer) error {
 type pbTxNoticeOrder struct {
 	pbMessageOrder
 	txHashes []types.TxID
+	// shortCnt is the number of short ids if the notice is NewTxShortNotice
+	shortCnt int
 }
 
 func (pr *pbTxNoticeOrder) SendTo(pi p2pcommon.RemotePeer) error {
@@ -190,7 +192,7 @@ func (pr *pbTxNoticeOrder) SendTo(pi p2pcommon.RemotePeer) error {
 	}
 	if p.logger.IsDebugEnabled() && pr.trace {
 		p.logger.Debug().Str(p2putil.LogPeerName, p.Name()).Str(p2putil.LogProtoID, pr.GetProtocolID().String()).
-			Str(p2putil.LogMsgID, pr.GetMsgID().String()).Int("hash_cnt", len(pr.txHashes)).Array("hashes", types.NewLogTxIDsMarshaller(pr.txHashes, 10)).Msg("Sent tx notice")
+			Str(p2putil.LogMsgID, pr.GetMsgID().String()).Int("hash_cnt", len(pr.txHashes)).Int("short_cnt", pr.shortCnt).Array("hashes", types.NewLogTxIDsMarshaller(pr.txHashes, 10)).Msg("Sent tx notice")
 	}
 	return nil
 }
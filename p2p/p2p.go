@@ -248,6 +248,8 @@ func (p2ps *P2P) Receive(context actor.Context) {
 		context.Respond(p2ps.mm.Metrics())
 	case *message.GetBlockHeaders:
 		p2ps.GetBlockHeaders(msg)
+	case *message.GetSyncHeaders:
+		p2ps.GetSyncHeaders(msg)
 	case *message.GetBlockChunks:
 		p2ps.GetBlocksChunk(context, msg)
 	case *message.GetBlockInfos:
@@ -256,6 +258,8 @@ func (p2ps *P2P) Receive(context actor.Context) {
 		p2ps.GetBlockHashes(context, msg)
 	case *message.GetHashByNo:
 		p2ps.GetBlockHashByNo(context, msg)
+	case *message.GetStateChunk:
+		p2ps.GetStateChunk(context, msg)
 	case *message.NotifyNewBlock:
 		if msg.Produced {
 			p2ps.NotifyBlockProduced(*msg)
@@ -422,23 +426,34 @@ func (p2ps *P2P) insertHandlers(peer p2pcommon.RemotePeer) {
 	peer.AddMessageHandler(p2pcommon.GetHashesResponse, subproto.NewGetHashesRespHandler(p2ps.pm, peer, logger, p2ps))
 	peer.AddMessageHandler(p2pcommon.GetHashByNoRequest, subproto.NewGetHashByNoReqHandler(p2ps.pm, peer, logger, p2ps))
 	peer.AddMessageHandler(p2pcommon.GetHashByNoResponse, subproto.NewGetHashByNoRespHandler(p2ps.pm, peer, logger, p2ps))
+	peer.AddMessageHandler(p2pcommon.GetStateChunkRequest, subproto.NewGetStateChunkReqHandler(p2ps.pm, peer, logger, p2ps))
+	peer.AddMessageHandler(p2pcommon.GetStateChunkResponse, subproto.NewGetStateChunkRespHandler(p2ps.pm, peer, logger, p2ps))
 
 	// TxHandlers
 	peer.AddMessageHandler(p2pcommon.GetTXsRequest, subproto.WithTimeLog(subproto.NewTxReqHandler(p2ps.pm, p2ps.sm, peer, logger, p2ps), p2ps.Logger, zerolog.DebugLevel))
 	peer.AddMessageHandler(p2pcommon.GetTXsResponse, subproto.WithTimeLog(subproto.NewTxRespHandler(p2ps.pm, peer, logger, p2ps), p2ps.Logger, zerolog.DebugLevel))
 	peer.AddMessageHandler(p2pcommon.NewTxNotice, subproto.WithTimeLog(subproto.NewNewTxNoticeHandler(p2ps.pm, peer, logger, p2ps, p2ps.sm), p2ps.Logger, zerolog.DebugLevel))
+	peer.AddMessageHandler(p2pcommon.NewTxShortNotice, subproto.WithTimeLog(subproto.NewNewTxShortNoticeHandler(p2ps.pm, peer, logger, p2ps, p2ps.sm), p2ps.Logger, zerolog.DebugLevel))
+	peer.AddMessageHandler(p2pcommon.GetTxHashesRequest, subproto.NewTxHashesReqHandler(p2ps.pm, peer, logger, p2ps))
+	peer.AddMessageHandler(p2pcommon.GetTxHashesResponse, subproto.NewTxHashesRespHandler(p2ps.pm, peer, logger, p2ps, p2ps.sm))
 
 	// block notice handlers
 	if p2ps.useRaft && p2ps.selfMeta.Role == types.PeerRole_Producer {
 		peer.AddMessageHandler(p2pcommon.BlockProducedNotice, subproto.NewBPNoticeDiscardHandler(p2ps.pm, peer, logger, p2ps, p2ps.sm))
+		peer.AddMessageHandler(p2pcommon.CompactBlockNotice, subproto.NewCompactBlkNoticeDiscardHandler(p2ps.pm, peer, logger, p2ps, p2ps.sm))
 		peer.AddMessageHandler(p2pcommon.NewBlockNotice, subproto.NewBlkNoticeDiscardHandler(p2ps.pm, peer, logger, p2ps, p2ps.sm))
 	} else if p2ps.selfMeta.Role == types.PeerRole_Agent {
 		peer.AddMessageHandler(p2pcommon.BlockProducedNotice, subproto.WithTimeLog(subproto.NewAgentBlockProducedNoticeHandler(p2ps.pm, peer, logger, p2ps, p2ps.sm, p2ps.cm), p2ps.Logger, zerolog.DebugLevel))
+		// compact block is not sent to agent, but handled in case.
+		peer.AddMessageHandler(p2pcommon.CompactBlockNotice, subproto.WithTimeLog(subproto.NewCompactBlockNoticeHandler(p2ps, p2ps.pm, peer, logger, p2ps, p2ps.sm), p2ps.Logger, zerolog.DebugLevel))
 		peer.AddMessageHandler(p2pcommon.NewBlockNotice, subproto.NewNewBlockNoticeHandler(p2ps.pm, peer, logger, p2ps, p2ps.sm))
 	} else {
 		peer.AddMessageHandler(p2pcommon.BlockProducedNotice, subproto.WithTimeLog(subproto.NewBlockProducedNoticeHandler(p2ps, p2ps.pm, peer, logger, p2ps, p2ps.sm), p2ps.Logger, zerolog.DebugLevel))
+		peer.AddMessageHandler(p2pcommon.CompactBlockNotice, subproto.WithTimeLog(subproto.NewCompactBlockNoticeHandler(p2ps, p2ps.pm, peer, logger, p2ps, p2ps.sm), p2ps.Logger, zerolog.DebugLevel))
 		peer.AddMessageHandler(p2pcommon.NewBlockNotice, subproto.NewNewBlockNoticeHandler(p2ps.pm, peer, logger, p2ps, p2ps.sm))
 	}
+	peer.AddMessageHandler(p2pcommon.GetBlockTxsRequest, subproto.NewBlockTxsReqHandler(p2ps.pm, peer, logger, p2ps))
+	peer.AddMessageHandler(p2pcommon.GetBlockTxsResponse, subproto.NewBlockTxsRespHandler(p2ps.pm, peer, logger, p2ps))
 
 	// Raft support
 	peer.AddMessageHandler(p2pcommon.GetClusterRequest, subproto.NewGetClusterReqHandler(p2ps.pm, peer, logger, p2ps, p2ps.consacc))
@@ -0,0 +1,44 @@
+/*
+ * @file
+ * @copyright defined in aergo/LICENSE.txt
+ */
+
+package p2pcommon
+
+// PeerCapability is bit flags of optional p2p features. Capabilities are exchanged in
+// status message of handshake, and the feature is used only if both local and remote peer have it.
+// Remote peers of older version send no capabilities, so the optional features are disabled for them.
+type PeerCapability uint64
+
+const (
+	// CapShortTxNotice means that peer can send and receive tx notice with salted short tx ids
+	CapShortTxNotice PeerCapability = 1 << iota
+	// CapCompactBlock means that peer can receive block produced notice in compact form, and respond missing txs of it
+	CapCompactBlock
+	// CapCompressMsg means that peer can read messages of CompressibleProtocols with compressed payload
+	CapCompressMsg
+)
+
+// LocalCapabilities is the set of capabilities which this aergosvr supports.
+var LocalCapabilities = CapShortTxNotice | CapCompactBlock | CapCompressMsg
+
+// CompressibleProtocols are protocols which can carry big payload of blocks, txs or hashes. Their payloads are
+// compressed if remote peer has capability CapCompressMsg.
+var CompressibleProtocols = map[SubProtocol]bool{
+	GetBlocksResponse:   true,
+	GetHashesResponse:   true,
+	GetTXsResponse:      true,
+	GetTxHashesResponse: true,
+	GetBlockTxsResponse: true,
+	RaftWrapperMessage:  true,
+}
+
+// Has returns true if all capabilities in c are contained in pc.
+func (pc PeerCapability) Has(c PeerCapability) bool {
+	return pc&c == c
+}
+
+// Negotiate returns capabilities which both pc and remote support
+func (pc PeerCapability) Negotiate(remote PeerCapability) PeerCapability {
+	return pc & remote
+}
@@ -0,0 +1,32 @@
+/*
+ * @file
+ * @copyright defined in aergo/LICENSE.txt
+ */
+
+package p2pcommon
+
+import "testing"
+
+func TestPeerCapability_Negotiate(t *testing.T) {
+	const capX PeerCapability = 1 << 62
+	tests := []struct {
+		name   string
+		local  PeerCapability
+		remote PeerCapability
+		check  PeerCapability
+		want   bool
+	}{
+		{"TBoth", CapShortTxNotice, CapShortTxNotice, CapShortTxNotice, true},
+		{"TOldRemote", CapShortTxNotice, 0, CapShortTxNotice, false},
+		{"TOnlyRemote", 0, CapShortTxNotice, CapShortTxNotice, false},
+		{"TPartial", CapShortTxNotice | capX, CapShortTxNotice, CapShortTxNotice | capX, false},
+		{"TNothing", CapShortTxNotice, CapShortTxNotice, 0, true},
+	}
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			if got := tt.local.Negotiate(tt.remote).Has(tt.check); got != tt.want {
+				t.Errorf("Negotiate().Has() = %v, want %v", got, tt.want)
+			}
+		})
+	}
+}
@@ -21,6 +21,8 @@ type HandshakeResult struct {
 	BestBlockNo   types.BlockNo
 	Hidden        bool
 	Certificates []*AgentCertificateV1
+	// Capabilities is negotiated optional features, which both local and remote peer support.
+	Capabilities PeerCapability
 }
 
 // HSHandlerFactory is creator of HSHandler
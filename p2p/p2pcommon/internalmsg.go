@@ -33,7 +33,9 @@ type MoFactory interface {
 	NewMsgResponseOrder(reqID MsgID, protocolID SubProtocol, message MessageBody) MsgOrder
 	NewMsgBlkBroadcastOrder(noticeMsg *types.NewBlockNotice) MsgOrder
 	NewMsgTxBroadcastOrder(noticeMsg *types.NewTransactionsNotice) MsgOrder
+	NewMsgTxShortBroadcastOrder(noticeMsg *types.NewTxShortNotice) MsgOrder
 	NewMsgBPBroadcastOrder(noticeMsg *types.BlockProducedNotice) MsgOrder
+	NewMsgCompactBlockOrder(noticeMsg *types.CompactBlockNotice) MsgOrder
 	NewRaftMsgOrder(msgType raftpb.MessageType, raftMsg *raftpb.Message) MsgOrder
 	NewTossMsgOrder(orgMsg Message) MsgOrder
 }
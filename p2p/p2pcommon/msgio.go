@@ -16,6 +16,19 @@ type MsgReadWriter interface {
 	AddIOListener(l MsgIOListener)
 }
 
+// PayloadReleaser is optionally implemented by MsgReadWriter which reads payloads into pooled buffers.
+// ReleasePayload gives back the payload buffer of read message, so neither message nor its payload must be used after it.
+type PayloadReleaser interface {
+	ReleasePayload(msg Message)
+}
+
+// MsgBatchWriter is optionally implemented by MsgReadWriter which can defer flushing. Messages written between
+// BeginBatch and EndBatch are buffered and flushed to the stream together at EndBatch.
+type MsgBatchWriter interface {
+	BeginBatch()
+	EndBatch() error
+}
+
 // MsgIOListener listen read and write of p2p message. The concrete implementations must consume much of times.
 type MsgIOListener interface {
 	OnRead(protocol SubProtocol, read int)
@@ -22,6 +22,8 @@ type SyncManager interface {
 
 	// handle notice from bp
 	HandleBlockProducedNotice(peer RemotePeer, block *types.Block)
+	// HandleCompactBlockNotice reconstructs block from compact notice and local txs, requesting missing txs to remote peer.
+	HandleCompactBlockNotice(peer RemotePeer, data *types.CompactBlockNotice)
 	// handle notice from other node
 	HandleNewBlockNotice(peer RemotePeer, data *types.NewBlockNotice)
 	HandleGetBlockResponse(peer RemotePeer, msg Message, resp *types.GetBlockResponse)
@@ -30,6 +32,8 @@ type SyncManager interface {
 	RegisterTxNotice(txs []*types.Tx)
 	// HandleNewTxNotice handle received tx from remote peer. it caches txIDs.
 	HandleNewTxNotice(peer RemotePeer, hashes []types.TxID, data *types.NewTransactionsNotice)
+	// HandleNewTxShortNotice resolves short ids to tx ids which local node knows, and requests full hashes of the rest to remote peer.
+	HandleNewTxShortNotice(peer RemotePeer, data *types.NewTxShortNotice)
 	HandleGetTxReq(peer RemotePeer, msgID MsgID, data *types.GetTransactionsRequest) error
 	RetryGetTx(peer RemotePeer, hashes [][]byte)
 }
@@ -39,4 +39,6 @@ type RemoteInfo struct {
 	AcceptedRole types.PeerRole
 	Certificates []*AgentCertificateV1
 	Zone         PeerZone
+	// Capabilities is negotiated optional features of this connection
+	Capabilities PeerCapability
 }
@@ -53,6 +53,10 @@ type RemotePeer interface {
 	UpdateBlkCache(blkHash types.BlockID, blkNumber types.BlockNo) bool
 	// updateTxCache add hashes to transaction cache and return newly added hashes.
 	UpdateTxCache(hashes []types.TxID) []types.TxID
+	// LookupShortTxIDs returns full tx ids of short ids which local peer sent to this remote peer. Unknown short ids are omitted.
+	LookupShortTxIDs(shortIDs []uint64) []types.TxID
+	// KnownTx returns true if remote peer is expected to have the tx, i.e. the tx notice was sent to or received from remote peer.
+	KnownTx(txID types.TxID) bool
 	// updateLastNotice change estimate of the last status of remote peer
 	UpdateLastNotice(blkHash types.BlockID, blkNumber types.BlockNo)
 
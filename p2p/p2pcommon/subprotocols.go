@@ -33,17 +33,27 @@ const (
 	GetHashesResponse
 	GetHashByNoRequest
 	GetHashByNoResponse
+	GetStateChunkRequest
+	GetStateChunkResponse
 )
 const (
 	GetTXsRequest SubProtocol = 0x020 + iota
 	GetTXsResponse
 	NewTxNotice
+	// NewTxShortNotice is compact form of NewTxNotice, used only if remote peer has capability CapShortTxNotice
+	NewTxShortNotice
+	GetTxHashesRequest
+	GetTxHashesResponse
 )
 
 // subprotocols for block producers and their own trusted nodes
 const (
 	// BlockProducedNotice from block producer to trusted nodes and other bp nodes
 	BlockProducedNotice SubProtocol = 0x030 + iota
+	// CompactBlockNotice is compact form of BlockProducedNotice, used only if remote peer has capability CapCompactBlock
+	CompactBlockNotice
+	GetBlockTxsRequest
+	GetBlockTxsResponse
 )
 
 const (
@@ -224,6 +224,20 @@ func (mr *MockMoFactoryMockRecorder) NewMsgTxBroadcastOrder(noticeMsg interface{
 	return mr.mock.ctrl.RecordCallWithMethodType(mr.mock, "NewMsgTxBroadcastOrder", reflect.TypeOf((*MockMoFactory)(nil).NewMsgTxBroadcastOrder), noticeMsg)
 }
 
+// NewMsgTxShortBroadcastOrder mocks base method
+func (m *MockMoFactory) NewMsgTxShortBroadcastOrder(noticeMsg *types.NewTxShortNotice) p2pcommon.MsgOrder {
+	m.ctrl.T.Helper()
+	ret := m.ctrl.Call(m, "NewMsgTxShortBroadcastOrder", noticeMsg)
+	ret0, _ := ret[0].(p2pcommon.MsgOrder)
+	return ret0
+}
+
+// NewMsgTxShortBroadcastOrder indicates an expected call of NewMsgTxShortBroadcastOrder
+func (mr *MockMoFactoryMockRecorder) NewMsgTxShortBroadcastOrder(noticeMsg interface{}) *gomock.Call {
+	mr.mock.ctrl.T.Helper()
+	return mr.mock.ctrl.RecordCallWithMethodType(mr.mock, "NewMsgTxShortBroadcastOrder", reflect.TypeOf((*MockMoFactory)(nil).NewMsgTxShortBroadcastOrder), noticeMsg)
+}
+
 // NewMsgBPBroadcastOrder mocks base method
 func (m *MockMoFactory) NewMsgBPBroadcastOrder(noticeMsg *types.BlockProducedNotice) p2pcommon.MsgOrder {
 	m.ctrl.T.Helper()
@@ -238,6 +252,20 @@ func (mr *MockMoFactoryMockRecorder) NewMsgBPBroadcastOrder(noticeMsg interface{
 	return mr.mock.ctrl.RecordCallWithMethodType(mr.mock, "NewMsgBPBroadcastOrder", reflect.TypeOf((*MockMoFactory)(nil).NewMsgBPBroadcastOrder), noticeMsg)
 }
 
+// NewMsgCompactBlockOrder mocks base method
+func (m *MockMoFactory) NewMsgCompactBlockOrder(noticeMsg *types.CompactBlockNotice) p2pcommon.MsgOrder {
+	m.ctrl.T.Helper()
+	ret := m.ctrl.Call(m, "NewMsgCompactBlockOrder", noticeMsg)
+	ret0, _ := ret[0].(p2pcommon.MsgOrder)
+	return ret0
+}
+
+// NewMsgCompactBlockOrder indicates an expected call of NewMsgCompactBlockOrder
+func (mr *MockMoFactoryMockRecorder) NewMsgCompactBlockOrder(noticeMsg interface{}) *gomock.Call {
+	mr.mock.ctrl.T.Helper()
+	return mr.mock.ctrl.RecordCallWithMethodType(mr.mock, "NewMsgCompactBlockOrder", reflect.TypeOf((*MockMoFactory)(nil).NewMsgCompactBlockOrder), noticeMsg)
+}
+
 // NewRaftMsgOrder mocks base method
 func (m *MockMoFactory) NewRaftMsgOrder(msgType raftpb.MessageType, raftMsg *raftpb.Message) p2pcommon.MsgOrder {
 	m.ctrl.T.Helper()
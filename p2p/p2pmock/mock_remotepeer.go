@@ -353,6 +353,34 @@ func (mr *MockRemotePeerMockRecorder) UpdateTxCache(hashes interface{}) *gomock.
 	return mr.mock.ctrl.RecordCallWithMethodType(mr.mock, "UpdateTxCache", reflect.TypeOf((*MockRemotePeer)(nil).UpdateTxCache), hashes)
 }
 
+// KnownTx mocks base method
+func (m *MockRemotePeer) KnownTx(txID types.TxID) bool {
+	m.ctrl.T.Helper()
+	ret := m.ctrl.Call(m, "KnownTx", txID)
+	ret0, _ := ret[0].(bool)
+	return ret0
+}
+
+// KnownTx indicates an expected call of KnownTx
+func (mr *MockRemotePeerMockRecorder) KnownTx(txID interface{}) *gomock.Call {
+	mr.mock.ctrl.T.Helper()
+	return mr.mock.ctrl.RecordCallWithMethodType(mr.mock, "KnownTx", reflect.TypeOf((*MockRemotePeer)(nil).KnownTx), txID)
+}
+
+// LookupShortTxIDs mocks base method
+func (m *MockRemotePeer) LookupShortTxIDs(shortIDs []uint64) []types.TxID {
+	m.ctrl.T.Helper()
+	ret := m.ctrl.Call(m, "LookupShortTxIDs", shortIDs)
+	ret0, _ := ret[0].([]types.TxID)
+	return ret0
+}
+
+// LookupShortTxIDs indicates an expected call of LookupShortTxIDs
+func (mr *MockRemotePeerMockRecorder) LookupShortTxIDs(shortIDs interface{}) *gomock.Call {
+	mr.mock.ctrl.T.Helper()
+	return mr.mock.ctrl.RecordCallWithMethodType(mr.mock, "LookupShortTxIDs", reflect.TypeOf((*MockRemotePeer)(nil).LookupShortTxIDs), shortIDs)
+}
+
 // UpdateLastNotice mocks base method
 func (m *MockRemotePeer) UpdateLastNotice(blkHash types.BlockID, blkNumber types.BlockNo) {
 	m.ctrl.T.Helper()
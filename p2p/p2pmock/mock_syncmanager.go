@@ -47,6 +47,18 @@ func (mr *MockSyncManagerMockRecorder) HandleBlockProducedNotice(arg0, arg1 inte
 	return mr.mock.ctrl.RecordCallWithMethodType(mr.mock, "HandleBlockProducedNotice", reflect.TypeOf((*MockSyncManager)(nil).HandleBlockProducedNotice), arg0, arg1)
 }
 
+// HandleCompactBlockNotice mocks base method
+func (m *MockSyncManager) HandleCompactBlockNotice(arg0 p2pcommon.RemotePeer, arg1 *types.CompactBlockNotice) {
+	m.ctrl.T.Helper()
+	m.ctrl.Call(m, "HandleCompactBlockNotice", arg0, arg1)
+}
+
+// HandleCompactBlockNotice indicates an expected call of HandleCompactBlockNotice
+func (mr *MockSyncManagerMockRecorder) HandleCompactBlockNotice(arg0, arg1 interface{}) *gomock.Call {
+	mr.mock.ctrl.T.Helper()
+	return mr.mock.ctrl.RecordCallWithMethodType(mr.mock, "HandleCompactBlockNotice", reflect.TypeOf((*MockSyncManager)(nil).HandleCompactBlockNotice), arg0, arg1)
+}
+
 // HandleGetBlockResponse mocks base method
 func (m *MockSyncManager) HandleGetBlockResponse(arg0 p2pcommon.RemotePeer, arg1 p2pcommon.Message, arg2 *types.GetBlockResponse) {
 	m.ctrl.T.Helper()
@@ -97,6 +109,18 @@ func (mr *MockSyncManagerMockRecorder) HandleNewTxNotice(arg0, arg1, arg2 interf
 	return mr.mock.ctrl.RecordCallWithMethodType(mr.mock, "HandleNewTxNotice", reflect.TypeOf((*MockSyncManager)(nil).HandleNewTxNotice), arg0, arg1, arg2)
 }
 
+// HandleNewTxShortNotice mocks base method
+func (m *MockSyncManager) HandleNewTxShortNotice(arg0 p2pcommon.RemotePeer, arg1 *types.NewTxShortNotice) {
+	m.ctrl.T.Helper()
+	m.ctrl.Call(m, "HandleNewTxShortNotice", arg0, arg1)
+}
+
+// HandleNewTxShortNotice indicates an expected call of HandleNewTxShortNotice
+func (mr *MockSyncManagerMockRecorder) HandleNewTxShortNotice(arg0, arg1 interface{}) *gomock.Call {
+	mr.mock.ctrl.T.Helper()
+	return mr.mock.ctrl.RecordCallWithMethodType(mr.mock, "HandleNewTxShortNotice", reflect.TypeOf((*MockSyncManager)(nil).HandleNewTxShortNotice), arg0, arg1)
+}
+
 // RegisterTxNotice mocks base method
 func (m *MockSyncManager) RegisterTxNotice(arg0 []*types.Tx) {
 	m.ctrl.T.Helper()
@@ -0,0 +1,94 @@
+/*
+ * @file
+ * @copyright defined in aergo/LICENSE.txt
+ */
+
+package p2putil
+
+import (
+	"crypto/rand"
+	"encoding/binary"
+)
+
+// ShortIDSaltLength is the byte length of salt used to derive short ids of hashes
+const ShortIDSaltLength = 16
+
+// ShortIDKey is keyed hash function which maps 32 byte hash (tx or block) to 64bit short id.
+// Short ids are computed by SipHash-2-4, keyed by per-connection salt, so that collisions
+// can not be crafted in advance and are different across connections.
+type ShortIDKey struct {
+	k0, k1 uint64
+}
+
+// NewShortIDSalt generate random salt for short id
+func NewShortIDSalt() []byte {
+	salt := make([]byte, ShortIDSaltLength)
+	if _, err := rand.Read(salt); err != nil {
+		panic("failed to generate random salt: " + err.Error())
+	}
+	return salt
+}
+
+// NewShortIDKey create key from salt. It returns false if length of salt is wrong.
+func NewShortIDKey(salt []byte) (ShortIDKey, bool) {
+	if len(salt) != ShortIDSaltLength {
+		return ShortIDKey{}, false
+	}
+	return ShortIDKey{k0: binary.LittleEndian.Uint64(salt[:8]), k1: binary.LittleEndian.Uint64(salt[8:])}, true
+}
+
+func rotl(x uint64, b uint) uint64 {
+	return (x << b) | (x >> (64 - b))
+}
+
+// Sum returns short id of hash.
+func (k ShortIDKey) Sum(hash []byte) uint64 {
+	v0 := k.k0 ^ 0x736f6d6570736575
+	v1 := k.k1 ^ 0x646f72616e646f6d
+	v2 := k.k0 ^ 0x6c7967656e657261
+	v3 := k.k1 ^ 0x7465646279746573
+
+	round := func() {
+		v0 += v1
+		v1 = rotl(v1, 13)
+		v1 ^= v0
+		v0 = rotl(v0, 32)
+		v2 += v3
+		v3 = rotl(v3, 16)
+		v3 ^= v2
+		v0 += v3
+		v3 = rotl(v3, 21)
+		v3 ^= v0
+		v2 += v1
+		v1 = rotl(v1, 17)
+		v1 ^= v2
+		v2 = rotl(v2, 32)
+	}
+
+	length := len(hash)
+	p := hash
+	for len(p) >= 8 {
+		m := binary.LittleEndian.Uint64(p)
+		v3 ^= m
+		round()
+		round()
+		v0 ^= m
+		p = p[8:]
+	}
+	// last block contains remaining bytes and length of message
+	b := uint64(length) << 56
+	for i := len(p) - 1; i >= 0; i-- {
+		b |= uint64(p[i]) << (8 * uint(i))
+	}
+	v3 ^= b
+	round()
+	round()
+	v0 ^= b
+
+	v2 ^= 0xff
+	round()
+	round()
+	round()
+	round()
+	return v0 ^ v1 ^ v2 ^ v3
+}
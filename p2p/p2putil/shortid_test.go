@@ -0,0 +1,66 @@
+/*
+ * @file
+ * @copyright defined in aergo/LICENSE.txt
+ */
+
+package p2putil
+
+import (
+	"testing"
+
+	"github.com/stretchr/testify/assert"
+)
+
+func TestShortIDKey_Sum(t *testing.T) {
+	// test vectors of reference implementation of SipHash-2-4, with key 00 01 02 ... 0f and message 00 01 02 ... (len-1)
+	salt := make([]byte, ShortIDSaltLength)
+	for i := range salt {
+		salt[i] = byte(i)
+	}
+	msg := make([]byte, 64)
+	for i := range msg {
+		msg[i] = byte(i)
+	}
+	tests := []struct {
+		name   string
+		msgLen int
+		want   uint64
+	}{
+		{"TEmpty", 0, 0x726fdb47dd0e0e31},
+		{"TLen1", 1, 0x74f839c593dc67fd},
+		{"TLen8", 8, 0x93f5f5799a932462},
+		{"TLen15", 15, 0xa129ca6149be45e5},
+	}
+	key, ok := NewShortIDKey(salt)
+	assert.True(t, ok)
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			assert.Equal(t, tt.want, key.Sum(msg[:tt.msgLen]))
+		})
+	}
+}
+
+func TestNewShortIDKey(t *testing.T) {
+	tests := []struct {
+		name    string
+		saltLen int
+		want    bool
+	}{
+		{"TNormal", ShortIDSaltLength, true},
+		{"TShort", ShortIDSaltLength - 1, false},
+		{"TLong", ShortIDSaltLength + 1, false},
+		{"TEmpty", 0, false},
+	}
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			_, got := NewShortIDKey(make([]byte, tt.saltLen))
+			assert.Equal(t, tt.want, got)
+		})
+	}
+
+	s1, s2 := NewShortIDSalt(), NewShortIDSalt()
+	k1, _ := NewShortIDKey(s1)
+	k2, _ := NewShortIDKey(s2)
+	hash := make([]byte, 32)
+	assert.NotEqual(t, k1.Sum(hash), k2.Sum(hash), "different salt should make different short id")
+}
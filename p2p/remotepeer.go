@@ -10,6 +10,7 @@ import (
 	"github.com/pkg/errors"
 	"runtime/debug"
 	"sync"
+	"sync/atomic"
 	"time"
 
 	"github.com/aergoio/aergo/p2p/metric"
@@ -55,8 +56,8 @@ type remotePeerImpl struct {
 	certChan chan *p2pcommon.AgentCertificateV1
 	stopChan chan struct{}
 
-	// direct write channel
-	writeBuf   chan p2pcommon.MsgOrder
+	// sendQueue is queues of messages to be written, by priority
+	sendQueue   *sendQueue
 	writeDirect chan p2pcommon.MsgOrder
 	closeWrite chan struct{}
 
@@ -76,6 +77,14 @@ type remotePeerImpl struct {
 	txQueueLock         *sync.Mutex
 	txNoticeQueue       *p2putil.PressableQueue
 	maxTxNoticeHashSize int
+	// txFlushInterval is max wait time to send queued tx notices to this peer. It is changed with the role of peer,
+	// and accessed atomically.
+	txFlushInterval int64
+	// txNoticeSalt is fixed during connection, and txShortKey made from it is used to make short tx ids sent to this peer.
+	txNoticeSalt []byte
+	txShortKey   p2putil.ShortIDKey
+	// txShortIDs maps short id sent to this peer to full tx id.
+	txShortIDs *lru.Cache
 
 	rw p2pcommon.MsgReadWriter
 
@@ -108,9 +117,10 @@ func newRemotePeer(remote p2pcommon.RemoteInfo, manageNum uint32, pm p2pcommon.P
 		txQueueLock:         &sync.Mutex{},
 		txNoticeQueue:       p2putil.NewPressableQueue(DefaultPeerTxQueueSize),
 		maxTxNoticeHashSize: DefaultPeerTxQueueSize,
+		txFlushInterval:     int64(txNoticeFlushInterval(remote.AcceptedRole)),
 		taskChannel: make(chan p2pcommon.PeerTask, 1),
 	}
-	rPeer.writeBuf = make(chan p2pcommon.MsgOrder, writeMsgBufferSize)
+	rPeer.sendQueue = newSendQueue(writeMsgBufferSize)
 	rPeer.writeDirect = make(chan p2pcommon.MsgOrder)
 
 	var err error
@@ -122,10 +132,30 @@ func newRemotePeer(remote p2pcommon.RemoteInfo, manageNum uint32, pm p2pcommon.P
 	if err != nil {
 		panic("Failed to create remote peer " + err.Error())
 	}
+	if remote.Capabilities.Has(p2pcommon.CapShortTxNotice) {
+		rPeer.txNoticeSalt = p2putil.NewShortIDSalt()
+		rPeer.txShortKey, _ = p2putil.NewShortIDKey(rPeer.txNoticeSalt)
+		rPeer.txShortIDs, err = lru.New(DefaultPeerTxCacheSize)
+		if err != nil {
+			panic("Failed to create remote peer " + err.Error())
+		}
+	}
 
 	return rPeer
 }
 
+// txNoticeFlushInterval returns interval of sending tx notices by role of remote peer. Txs should arrive to
+// block producers (and agents which relay to producers) as soon as possible, while other peers can wait
+// a little more to be batched in fewer notices.
+func txNoticeFlushInterval(role types.PeerRole) time.Duration {
+	switch role {
+	case types.PeerRole_Producer, types.PeerRole_Agent:
+		return txNoticeIntervalFast
+	default:
+		return txNoticeInterval
+	}
+}
+
 // ID return id of peer, same as peer.remoteInfo.ID
 func (p *remotePeerImpl) ID() types.PeerID {
 	return p.remoteInfo.Meta.ID
@@ -156,6 +186,11 @@ func (p *remotePeerImpl) AcceptedRole() types.PeerRole {
 }
 func (p *remotePeerImpl) ChangeRole(role types.PeerRole) {
 	p.remoteInfo.AcceptedRole = role
+	atomic.StoreInt64(&p.txFlushInterval, int64(txNoticeFlushInterval(role)))
+}
+
+func (p *remotePeerImpl) txNoticeFlushInterval() time.Duration {
+	return time.Duration(atomic.LoadInt64(&p.txFlushInterval))
 }
 
 func (p *remotePeerImpl) AddMessageHandler(subProtocol p2pcommon.SubProtocol, handler p2pcommon.MessageHandler) {
@@ -183,7 +218,8 @@ func (p *remotePeerImpl) RunPeer() {
 	go p.runWrite()
 	go p.runRead()
 
-	txNoticeTicker := time.NewTicker(txNoticeInterval)
+	txFlushInterval := p.txNoticeFlushInterval()
+	txNoticeTicker := time.NewTicker(txFlushInterval)
 	certCleanupTicker := time.NewTicker(p2pcommon.RemoteCertCheckInterval)
 
 	// peer state is changed to RUNNING after all sub goroutine is ready, and to STOPPED before fll sub goroutine is stopped.
@@ -196,6 +232,12 @@ READNOPLOOP:
 			// no operation for now
 		case <-txNoticeTicker.C:
 			p.trySendTxNotices()
+			// the role of peer can be changed after connected
+			if interval := p.txNoticeFlushInterval(); interval != txFlushInterval {
+				txNoticeTicker.Stop()
+				txFlushInterval = interval
+				txNoticeTicker = time.NewTicker(txFlushInterval)
+			}
 		case <-certCleanupTicker.C:
 			p.cleanupCerts()
 		case c := <-p.certChan:
@@ -208,7 +250,7 @@ READNOPLOOP:
 		}
 	}
 
-	p.logger.Info().Str(p2putil.LogPeerName, p.Name()).Msg("Finishing peer")
+	p.logger.Info().Str(p2putil.LogPeerName, p.Name()).Object("send_queue", p.sendQueue).Msg("Finishing peer")
 	txNoticeTicker.Stop()
 	pingTicker.Stop()
 	// finish goroutine write. read goroutine will be closed automatically when disconnect
@@ -229,17 +271,22 @@ func (p *remotePeerImpl) runWrite() {
 
 WRITELOOP:
 	for {
-		select {
-		case m := <-p.writeBuf:
-			p.writeToPeer(m)
-		case m := <-p.writeDirect:
-			p.writeToPeer(m)
-		case <-cleanupTicker.C:
-			p.pruneRequests()
-		case <-p.closeWrite:
-			p.logger.Debug().Str(p2putil.LogPeerName, p.Name()).Msg("Quitting runWrite")
-			break WRITELOOP
+		m := p.sendQueue.poll()
+		if m == nil {
+			select {
+			case m = <-p.sendQueue.queues[prioUrgent]:
+			case m = <-p.sendQueue.queues[prioNormal]:
+			case m = <-p.sendQueue.queues[prioBulk]:
+			case m = <-p.writeDirect:
+			case <-cleanupTicker.C:
+				p.pruneRequests()
+				continue
+			case <-p.closeWrite:
+				p.logger.Debug().Str(p2putil.LogPeerName, p.Name()).Msg("Quitting runWrite")
+				break WRITELOOP
+			}
 		}
+		p.writeBatch(m)
 	}
 	cleanupTicker.Stop()
 	p.cleanupWrite()
@@ -254,13 +301,8 @@ func (p *remotePeerImpl) cleanupWrite() {
 	// 1. cleaning receive handlers. TODO add code
 
 	// 2. canceling not sent orders
-	for {
-		select {
-		case m := <-p.writeBuf:
-			m.CancelSend(p)
-		default:
-			return
-		}
+	for _, m := range p.sendQueue.drain() {
+		m.CancelSend(p)
 	}
 }
 
@@ -279,6 +321,18 @@ func (p *remotePeerImpl) runRead() {
 			p.Stop()
 			return
 		}
+		p.releasePayload(msg)
+	}
+}
+
+// releasePayload recycles the read buffer of handled message. Payload of block produced notice is not released,
+// since the message can be tossed to other peers asynchronously.
+func (p *remotePeerImpl) releasePayload(msg p2pcommon.Message) {
+	if msg.Subprotocol() == p2pcommon.BlockProducedNotice {
+		return
+	}
+	if releaser, ok := p.rw.(p2pcommon.PayloadReleaser); ok {
+		releaser.ReleasePayload(msg)
 	}
 }
 
@@ -341,12 +395,9 @@ func (p *remotePeerImpl) SendMessage(msg p2pcommon.MsgOrder) {
 			Str(p2putil.LogMsgID, msg.GetMsgID().String()).Str("current_state", p.State().String()).Msg("Cancel sending message, since peer is not running state")
 		return
 	}
-	select {
-	case p.writeBuf <- msg:
-		// it's OK
-	default:
+	if !p.sendQueue.offer(msg) {
 		p.logger.Info().Str(p2putil.LogPeerName, p.Name()).Str(p2putil.LogProtoID, msg.GetProtocolID().String()).
-			Str(p2putil.LogMsgID, msg.GetMsgID().String()).Msg("Remote peer is busy or down")
+			Str(p2putil.LogMsgID, msg.GetMsgID().String()).Object("send_queue", p.sendQueue).Msg("Remote peer is busy or down")
 		// TODO find more elegant way to handled flooding queue. in lots of cases, pending for dropped tx notice or newBlock notice (not blockProduced notice) are not critical in lots of cases.
 		p.Stop()
 	}
@@ -359,13 +410,7 @@ func (p *remotePeerImpl) TrySendMessage(msg p2pcommon.MsgOrder) bool {
 			Str(p2putil.LogMsgID, msg.GetMsgID().String()).Str("current_state", p.State().String()).Msg("Cancel sending message, since peer is not running state")
 		return false
 	}
-	select {
-	case p.writeBuf <- msg:
-		// succeed to send message
-		return true
-	default:
-		return false
-	}
+	return p.sendQueue.offer(msg)
 }
 
 func (p *remotePeerImpl) SendAndWaitMessage(msg p2pcommon.MsgOrder, timeout time.Duration) error {
@@ -374,16 +419,14 @@ func (p *remotePeerImpl) SendAndWaitMessage(msg p2pcommon.MsgOrder, timeout time
 			Str(p2putil.LogMsgID, msg.GetMsgID().String()).Str("current_state", p.State().String()).Msg("Cancel sending message, since peer is not running state")
 		return fmt.Errorf("not running")
 	}
-	select {
-	case p.writeBuf <- msg:
-		return nil
-	case <-time.NewTimer(timeout).C:
+	if !p.sendQueue.offerWait(msg, timeout) {
 		p.logger.Info().Str(p2putil.LogPeerName, p.Name()).Str(p2putil.LogProtoID, msg.GetProtocolID().String()).
-			Str(p2putil.LogMsgID, msg.GetMsgID().String()).Msg("Remote peer is busy or down")
+			Str(p2putil.LogMsgID, msg.GetMsgID().String()).Object("send_queue", p.sendQueue).Msg("Remote peer is busy or down")
 		// TODO find more elegant way to handled flooding queue. in lots of cases, pending for dropped tx notice or newBlock notice (not blockProduced notice) are not critical in lots of cases.
 		p.Stop()
 		return TimeoutError
 	}
+	return nil
 }
 
 func (p *remotePeerImpl) PushTxsNotice(txHashes []types.TxID) {
@@ -432,6 +475,31 @@ func (p *remotePeerImpl) GetReceiver(originalID p2pcommon.MsgID) p2pcommon.Respo
 	}
 }
 
+// writeBatch writes first and following queued messages, and flushes them at once if the rw supports it.
+func (p *remotePeerImpl) writeBatch(first p2pcommon.MsgOrder) {
+	batchWriter, ok := p.rw.(p2pcommon.MsgBatchWriter)
+	if !ok {
+		p.writeToPeer(first)
+		p.sendQueue.addBatch(1)
+		return
+	}
+	batchWriter.BeginBatch()
+	p.writeToPeer(first)
+	written := 1
+	for ; written < maxWriteBatch && p.State() <= types.RUNNING; written++ {
+		m := p.sendQueue.poll()
+		if m == nil {
+			break
+		}
+		p.writeToPeer(m)
+	}
+	if err := batchWriter.EndBatch(); err != nil {
+		p.logger.Warn().Str(p2putil.LogPeerName, p.Name()).Err(err).Msg("fail to flush messages")
+		p.Stop()
+	}
+	p.sendQueue.addBatch(written)
+}
+
 func (p *remotePeerImpl) writeToPeer(m p2pcommon.MsgOrder) {
 	if err := m.SendTo(p); err != nil {
 		// write fail
@@ -455,6 +523,10 @@ func (p *remotePeerImpl) sendTxNotices() {
 			return
 		}
 		hashes := make([][]byte, 0, p.txNoticeQueue.Size())
+		var shortIDs []uint64
+		if p.txShortIDs != nil {
+			shortIDs = make([]uint64, 0, p.txNoticeQueue.Size())
+		}
 		skippedTxIDs := make([]types.TxID, 0)
 		for element := p.txNoticeQueue.Poll(); element != nil; element = p.txNoticeQueue.Poll() {
 			hash := element.(types.TxID)
@@ -462,8 +534,19 @@ func (p *remotePeerImpl) sendTxNotices() {
 				skippedTxIDs = append(skippedTxIDs, hash)
 				continue
 			}
-			hashes = append(hashes, hash[:])
 			p.txHashCache.Add(hash, cachePlaceHolder)
+			if p.txShortIDs != nil {
+				if shortID, ok := p.toShortTxID(hash); ok {
+					shortIDs = append(shortIDs, shortID)
+					continue
+				}
+				// collided short id is sent in full hash
+			}
+			hashes = append(hashes, hash[:])
+		}
+		if len(shortIDs) > 0 {
+			mo := p.mf.NewMsgTxShortBroadcastOrder(&types.NewTxShortNotice{Salt: p.txNoticeSalt, ShortIDs: shortIDs})
+			p.SendMessage(mo)
 		}
 		if len(hashes) > 0 {
 			mo := p.mf.NewMsgTxBroadcastOrder(&types.NewTransactionsNotice{TxHashes: hashes})
@@ -472,6 +555,34 @@ func (p *remotePeerImpl) sendTxNotices() {
 	}
 }
 
+// toShortTxID returns short id of tx for this peer. It returns false if the short id is collided with
+// other tx which was sent before, since remote peer can't resolve it.
+func (p *remotePeerImpl) toShortTxID(txID types.TxID) (uint64, bool) {
+	shortID := p.txShortKey.Sum(txID[:])
+	if prev, found := p.txShortIDs.Get(shortID); found && prev.(types.TxID) != txID {
+		return shortID, false
+	}
+	p.txShortIDs.Add(shortID, txID)
+	return shortID, true
+}
+
+func (p *remotePeerImpl) LookupShortTxIDs(shortIDs []uint64) []types.TxID {
+	if p.txShortIDs == nil {
+		return nil
+	}
+	found := make([]types.TxID, 0, len(shortIDs))
+	for _, shortID := range shortIDs {
+		if txID, ok := p.txShortIDs.Get(shortID); ok {
+			found = append(found, txID.(types.TxID))
+		}
+	}
+	return found
+}
+
+func (p *remotePeerImpl) KnownTx(txID types.TxID) bool {
+	return p.txHashCache.Contains(txID)
+}
+
 // this method MUST be called in same go routine as AergoPeer.RunPeer()
 func (p *remotePeerImpl) sendPing() {
 	// find my best block
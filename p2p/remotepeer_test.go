@@ -8,6 +8,7 @@ package p2p
 import (
 	"bytes"
 	"encoding/binary"
+	"fmt"
 	"github.com/aergoio/aergo-lib/log"
 	"github.com/libp2p/go-libp2p-core/crypto"
 	"net"
@@ -472,6 +473,7 @@ func TestRemotePeerImpl_pushTxsNotice(t *testing.T) {
 			mockSigner := new(p2pmock.MockMsgSigner)
 
 			mockMO.EXPECT().GetMsgID().Return(p2pcommon.NewMsgID()).AnyTimes()
+			mockMO.EXPECT().GetProtocolID().Return(p2pcommon.NewTxNotice).AnyTimes()
 			mockMF.EXPECT().NewMsgTxBroadcastOrder(gomock.Any()).Return(mockMO).
 				Times(test.expectSend)
 
@@ -486,6 +488,148 @@ func TestRemotePeerImpl_pushTxsNotice(t *testing.T) {
 		})
 	}
 }
+
+func TestRemotePeerImpl_pushTxsShortNotice(t *testing.T) {
+	ctrl := gomock.NewController(t)
+	defer ctrl.Finish()
+	sampleSize := 100
+	sampleHashes := make([]types.TxID, sampleSize)
+	maxTxHashSize := 10
+	for i := 0; i < sampleSize; i++ {
+		sampleHashes[i] = generateHash(uint64(i))
+	}
+	tests := []struct {
+		name        string
+		caps        p2pcommon.PeerCapability
+		in          []types.TxID
+		expectFull  int
+		expectShort int
+	}{
+		// 1. remote peer of old version
+		{"TOldPeer", 0, sampleHashes[:maxTxHashSize*3+1], 3, 0},
+		// 2. short notice is used instead
+		{"TShort", p2pcommon.CapShortTxNotice, sampleHashes[:maxTxHashSize*3+1], 0, 3},
+	}
+	for _, test := range tests {
+		t.Run(test.name, func(t *testing.T) {
+			mockMO := p2pmock.NewMockMsgOrder(ctrl)
+			mockPeerManager := p2pmock.NewMockPeerManager(ctrl)
+			mockMF := p2pmock.NewMockMoFactory(ctrl)
+			mockSigner := new(p2pmock.MockMsgSigner)
+
+			mockMO.EXPECT().GetMsgID().Return(p2pcommon.NewMsgID()).AnyTimes()
+			mockMO.EXPECT().GetProtocolID().Return(p2pcommon.NewTxNotice).AnyTimes()
+			mockMF.EXPECT().NewMsgTxBroadcastOrder(gomock.Any()).Return(mockMO).
+				Times(test.expectFull)
+			mockMF.EXPECT().NewMsgTxShortBroadcastOrder(gomock.Any()).Return(mockMO).
+				Times(test.expectShort)
+
+			sampleConn := p2pcommon.RemoteConn{IP: net.ParseIP(sampleMeta.PrimaryAddress()), Port: sampleMeta.PrimaryPort()}
+			sampleRemote := p2pcommon.RemoteInfo{Meta: sampleMeta, Connection: sampleConn, Capabilities: test.caps}
+
+			p := newRemotePeer(sampleRemote, 0, mockPeerManager, nil, logger, mockMF, mockSigner, nil)
+			p.txNoticeQueue = p2putil.NewPressableQueue(maxTxHashSize)
+			p.maxTxNoticeHashSize = maxTxHashSize
+
+			p.PushTxsNotice(test.in)
+		})
+	}
+}
+
+func TestRemotePeerImpl_ChangeRole(t *testing.T) {
+	sampleConn := p2pcommon.RemoteConn{IP: net.ParseIP(sampleMeta.PrimaryAddress()), Port: sampleMeta.PrimaryPort()}
+	sampleRemote := p2pcommon.RemoteInfo{Meta: sampleMeta, Connection: sampleConn, AcceptedRole: types.PeerRole_Watcher}
+	p := newRemotePeer(sampleRemote, 0, nil, nil, logger, nil, nil, nil)
+	assert.Equal(t, txNoticeInterval, p.txNoticeFlushInterval())
+
+	p.ChangeRole(types.PeerRole_Producer)
+	assert.Equal(t, txNoticeIntervalFast, p.txNoticeFlushInterval())
+	p.ChangeRole(types.PeerRole_Watcher)
+	assert.Equal(t, txNoticeInterval, p.txNoticeFlushInterval())
+}
+
+func TestRemotePeerImpl_LookupShortTxIDs(t *testing.T) {
+	sampleConn := p2pcommon.RemoteConn{IP: net.ParseIP(sampleMeta.PrimaryAddress()), Port: sampleMeta.PrimaryPort()}
+	sampleRemote := p2pcommon.RemoteInfo{Meta: sampleMeta, Connection: sampleConn, Capabilities: p2pcommon.CapShortTxNotice}
+	p := newRemotePeer(sampleRemote, 0, nil, nil, logger, nil, nil, nil)
+
+	sent := []types.TxID{generateHash(1), generateHash(2), generateHash(3)}
+	shortIDs := make([]uint64, len(sent))
+	for i, id := range sent {
+		var ok bool
+		shortIDs[i], ok = p.toShortTxID(id)
+		assert.True(t, ok)
+	}
+	// same tx is not a collision
+	_, ok := p.toShortTxID(sent[0])
+	assert.True(t, ok)
+
+	unknownTx := generateHash(4)
+	unknown := p.txShortKey.Sum(unknownTx[:])
+	actual := p.LookupShortTxIDs([]uint64{shortIDs[1], shortIDs[2], unknown})
+	assert.Equal(t, sent[1:], actual)
+
+	// peer of old version has no short ids
+	oldPeer := newRemotePeer(p2pcommon.RemoteInfo{Meta: sampleMeta, Connection: sampleConn}, 0, nil, nil, logger, nil, nil, nil)
+	assert.Nil(t, oldPeer.txShortIDs)
+	assert.Empty(t, oldPeer.LookupShortTxIDs(shortIDs))
+}
+
+// BenchmarkTxNoticeGossip simulates tx notices which a node sends to its peers when txs are flooded, and
+// compares written bytes of full hash notices and short id notices.
+func BenchmarkTxNoticeGossip(b *testing.B) {
+	const peerCnt = 20
+	const txPerRound = DefaultPeerTxQueueSize >> 1
+
+	benches := []struct {
+		name string
+		caps p2pcommon.PeerCapability
+	}{
+		{"BFullHash", 0},
+		{"BShortID", p2pcommon.CapShortTxNotice},
+	}
+	for _, bb := range benches {
+		b.Run(bb.name, func(b *testing.B) {
+			ctrl := gomock.NewController(b)
+			defer ctrl.Finish()
+
+			written, notices := 0, 0
+			mf := &baseMOFactory{}
+			peers := make([]*remotePeerImpl, peerCnt)
+			for i := range peers {
+				mockRW := p2pmock.NewMockMsgReadWriter(ctrl)
+				mockRW.EXPECT().WriteMsg(gomock.Any()).DoAndReturn(func(msg p2pcommon.Message) error {
+					written += len(msg.Payload())
+					notices++
+					return nil
+				}).AnyTimes()
+				meta := p2pcommon.PeerMeta{ID: types.PeerID(fmt.Sprintf("peer%d", i))}
+				remote := p2pcommon.RemoteInfo{Meta: meta, Capabilities: bb.caps}
+				peers[i] = newRemotePeer(remote, uint32(i), nil, nil, logger, mf, nil, mockRW)
+				peers[i].state.SetAndGet(types.RUNNING)
+			}
+			txIDs := make([]types.TxID, txPerRound)
+
+			b.ResetTimer()
+			for n := 0; n < b.N; n++ {
+				for i := range txIDs {
+					txIDs[i] = generateHash(uint64(n*txPerRound + i))
+				}
+				for _, p := range peers {
+					p.PushTxsNotice(txIDs)
+					p.trySendTxNotices()
+					for mo := p.sendQueue.poll(); mo != nil; mo = p.sendQueue.poll() {
+						p.writeToPeer(mo)
+					}
+				}
+			}
+			b.StopTimer()
+			txCnt := b.N * txPerRound * peerCnt
+			b.Logf("%d txs are noticed in %d messages, %d bytes. %.2f bytes per tx", txCnt, notices, written, float64(written)/float64(txCnt))
+		})
+	}
+}
+
 func TestRemotePeer_writeToPeer(t *testing.T) {
 	ctrl := gomock.NewController(t)
 	defer ctrl.Finish()
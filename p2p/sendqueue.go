@@ -0,0 +1,153 @@
+/*
+ * @file
+ * @copyright defined in aergo/LICENSE.txt
+ */
+
+package p2p
+
+import (
+	"sync/atomic"
+	"time"
+
+	"github.com/aergoio/aergo/p2p/p2pcommon"
+	"github.com/rs/zerolog"
+)
+
+// writePriority is class of message to be sent to remote peer.
+type writePriority int
+
+const (
+	// prioUrgent is for small and latency-sensitive messages, such as consensus messages and pings
+	prioUrgent writePriority = iota
+	// prioNormal is for other requests, responses and notices
+	prioNormal
+	// prioBulk is for big responses for sync, such as block chunks and hash lists
+	prioBulk
+	writePriorityCount
+)
+
+func writePriorityOf(protocol p2pcommon.SubProtocol) writePriority {
+	switch protocol {
+	case p2pcommon.PingRequest, p2pcommon.PingResponse, p2pcommon.GoAway,
+		p2pcommon.BlockProducedNotice, p2pcommon.CompactBlockNotice, p2pcommon.GetBlockTxsRequest, p2pcommon.GetBlockTxsResponse,
+		p2pcommon.NewBlockNotice, p2pcommon.RaftWrapperMessage, p2pcommon.GetClusterRequest, p2pcommon.GetClusterResponse:
+		return prioUrgent
+	case p2pcommon.GetBlocksResponse, p2pcommon.GetBlockHeadersResponse, p2pcommon.GetHashesResponse,
+		p2pcommon.GetTXsResponse, p2pcommon.GetTxHashesResponse:
+		return prioBulk
+	default:
+		return prioNormal
+	}
+}
+
+// sendQueue is the queues of messages to a remote peer, for each priority. Urgent messages are sent first,
+// but at most maxUrgentBurst messages in a row, so that sync traffic is not starved. Normal and bulk messages
+// take turns. The offer methods are thread-safe, but poll must be called only in write goroutine.
+type sendQueue struct {
+	queues [writePriorityCount]chan p2pcommon.MsgOrder
+
+	// fields below are accessed only in write goroutine
+	urgentRun int
+	bulkTurn  bool
+
+	// counters for backpressure monitoring
+	offered  [writePriorityCount]int64
+	rejected [writePriorityCount]int64
+	batches  int64
+	written  int64
+}
+
+func newSendQueue(size int) *sendQueue {
+	q := &sendQueue{}
+	for i := range q.queues {
+		q.queues[i] = make(chan p2pcommon.MsgOrder, size)
+	}
+	return q
+}
+
+// offer add mo to queue without blocking. It returns false if the queue is full.
+func (q *sendQueue) offer(mo p2pcommon.MsgOrder) bool {
+	prio := writePriorityOf(mo.GetProtocolID())
+	select {
+	case q.queues[prio] <- mo:
+		atomic.AddInt64(&q.offered[prio], 1)
+		return true
+	default:
+		atomic.AddInt64(&q.rejected[prio], 1)
+		return false
+	}
+}
+
+// offerWait add mo to queue, waiting at most timeout. It returns false if the queue is still full after timeout.
+func (q *sendQueue) offerWait(mo p2pcommon.MsgOrder, timeout time.Duration) bool {
+	prio := writePriorityOf(mo.GetProtocolID())
+	timer := time.NewTimer(timeout)
+	defer timer.Stop()
+	select {
+	case q.queues[prio] <- mo:
+		atomic.AddInt64(&q.offered[prio], 1)
+		return true
+	case <-timer.C:
+		atomic.AddInt64(&q.rejected[prio], 1)
+		return false
+	}
+}
+
+// poll returns next message to send without blocking, or nil if all queues are empty.
+func (q *sendQueue) poll() p2pcommon.MsgOrder {
+	if q.urgentRun < maxUrgentBurst {
+		if mo := q.pollFrom(prioUrgent); mo != nil {
+			q.urgentRun++
+			return mo
+		}
+	}
+	q.urgentRun = 0
+	first, second := prioNormal, prioBulk
+	if q.bulkTurn {
+		first, second = prioBulk, prioNormal
+	}
+	for _, prio := range []writePriority{first, second} {
+		if mo := q.pollFrom(prio); mo != nil {
+			q.bulkTurn = prio == prioNormal
+			return mo
+		}
+	}
+	// urgent message can be left if the burst limit was just reached
+	if mo := q.pollFrom(prioUrgent); mo != nil {
+		q.urgentRun++
+		return mo
+	}
+	return nil
+}
+
+func (q *sendQueue) pollFrom(prio writePriority) p2pcommon.MsgOrder {
+	select {
+	case mo := <-q.queues[prio]:
+		return mo
+	default:
+		return nil
+	}
+}
+
+// drain removes all queued messages and returns them.
+func (q *sendQueue) drain() []p2pcommon.MsgOrder {
+	var mos []p2pcommon.MsgOrder
+	for prio := range q.queues {
+		for mo := q.pollFrom(writePriority(prio)); mo != nil; mo = q.pollFrom(writePriority(prio)) {
+			mos = append(mos, mo)
+		}
+	}
+	return mos
+}
+
+func (q *sendQueue) addBatch(written int) {
+	atomic.AddInt64(&q.batches, 1)
+	atomic.AddInt64(&q.written, int64(written))
+}
+
+func (q *sendQueue) MarshalZerologObject(e *zerolog.Event) {
+	e.Ints("pending", []int{len(q.queues[prioUrgent]), len(q.queues[prioNormal]), len(q.queues[prioBulk])})
+	e.Int64("urgent", atomic.LoadInt64(&q.offered[prioUrgent])).Int64("normal", atomic.LoadInt64(&q.offered[prioNormal])).Int64("bulk", atomic.LoadInt64(&q.offered[prioBulk]))
+	e.Int64("rejected", atomic.LoadInt64(&q.rejected[prioUrgent])+atomic.LoadInt64(&q.rejected[prioNormal])+atomic.LoadInt64(&q.rejected[prioBulk]))
+	e.Int64("batches", atomic.LoadInt64(&q.batches)).Int64("written", atomic.LoadInt64(&q.written))
+}
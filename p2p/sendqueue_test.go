@@ -0,0 +1,86 @@
+/*
+ * @file
+ * @copyright defined in aergo/LICENSE.txt
+ */
+
+package p2p
+
+import (
+	"testing"
+	"time"
+
+	"github.com/aergoio/aergo/p2p/p2pcommon"
+	"github.com/aergoio/aergo/p2p/p2pmock"
+	"github.com/golang/mock/gomock"
+	"github.com/stretchr/testify/assert"
+)
+
+func TestSendQueue_poll(t *testing.T) {
+	ctrl := gomock.NewController(t)
+	defer ctrl.Finish()
+
+	newOrder := func(protocol p2pcommon.SubProtocol) p2pcommon.MsgOrder {
+		mo := p2pmock.NewMockMsgOrder(ctrl)
+		mo.EXPECT().GetProtocolID().Return(protocol).AnyTimes()
+		return mo
+	}
+	tests := []struct {
+		name    string
+		urgent  int
+		normal  int
+		bulk    int
+		wantSeq []writePriority
+	}{
+		{"TEmpty", 0, 0, 0, nil},
+		{"TUrgentFirst", 2, 1, 1, []writePriority{prioUrgent, prioUrgent, prioNormal, prioBulk}},
+		{"TAlternate", 0, 3, 3, []writePriority{prioNormal, prioBulk, prioNormal, prioBulk, prioNormal, prioBulk}},
+		{"TOnlyBulk", 0, 0, 3, []writePriority{prioBulk, prioBulk, prioBulk}},
+		{"TUrgentBurst", maxUrgentBurst + 2, 0, 2, append(func() []writePriority {
+			seq := make([]writePriority, maxUrgentBurst)
+			for i := range seq {
+				seq[i] = prioUrgent
+			}
+			return seq
+		}(), prioBulk, prioUrgent, prioUrgent, prioBulk)},
+	}
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			q := newSendQueue(20)
+			for i := 0; i < tt.bulk; i++ {
+				assert.True(t, q.offer(newOrder(p2pcommon.GetBlocksResponse)))
+			}
+			for i := 0; i < tt.normal; i++ {
+				assert.True(t, q.offer(newOrder(p2pcommon.GetBlocksRequest)))
+			}
+			for i := 0; i < tt.urgent; i++ {
+				assert.True(t, q.offer(newOrder(p2pcommon.BlockProducedNotice)))
+			}
+			var actual []writePriority
+			for mo := q.poll(); mo != nil; mo = q.poll() {
+				actual = append(actual, writePriorityOf(mo.GetProtocolID()))
+			}
+			assert.Equal(t, tt.wantSeq, actual)
+		})
+	}
+}
+
+func TestSendQueue_offer(t *testing.T) {
+	ctrl := gomock.NewController(t)
+	defer ctrl.Finish()
+
+	bulkMO := p2pmock.NewMockMsgOrder(ctrl)
+	bulkMO.EXPECT().GetProtocolID().Return(p2pcommon.GetBlocksResponse).AnyTimes()
+	urgentMO := p2pmock.NewMockMsgOrder(ctrl)
+	urgentMO.EXPECT().GetProtocolID().Return(p2pcommon.PingRequest).AnyTimes()
+
+	q := newSendQueue(2)
+	assert.True(t, q.offer(bulkMO))
+	assert.True(t, q.offer(bulkMO))
+	// full bulk queue does not block urgent messages
+	assert.False(t, q.offer(bulkMO))
+	assert.False(t, q.offerWait(bulkMO, time.Millisecond))
+	assert.True(t, q.offer(urgentMO))
+	assert.Equal(t, int64(2), q.rejected[prioBulk])
+	assert.Equal(t, 3, len(q.drain()))
+	assert.Nil(t, q.poll())
+}
@@ -0,0 +1,69 @@
+/*
+ * @file
+ * @copyright defined in aergo/LICENSE.txt
+ */
+
+package p2p
+
+import (
+	"bytes"
+
+	"github.com/aergoio/aergo/p2p/p2putil"
+	"github.com/aergoio/aergo/types"
+)
+
+// maxShortTxIndexSize is the size limit of a short tx index. The index is rebuilt from caches if it exceeds the limit.
+const maxShortTxIndexSize = DefaultGlobalTxCacheSize << 1
+
+// shortTxIndex maps short tx ids with salt of a remote peer to tx ids which local node already knows.
+// It is not thread-safe and must be used in goroutine of syncTxManager
+type shortTxIndex struct {
+	salt []byte
+	key  p2putil.ShortIDKey
+
+	ids map[uint64]types.TxID
+	// collided is short ids which are mapped to more than one tx ids. they can not be resolved locally.
+	collided map[uint64]bool
+}
+
+func newShortTxIndex(salt []byte) *shortTxIndex {
+	key, ok := p2putil.NewShortIDKey(salt)
+	if !ok {
+		return nil
+	}
+	return &shortTxIndex{salt: salt, key: key, ids: make(map[uint64]types.TxID), collided: make(map[uint64]bool)}
+}
+
+func (si *shortTxIndex) sameSalt(salt []byte) bool {
+	return bytes.Equal(si.salt, salt)
+}
+
+func (si *shortTxIndex) add(txID types.TxID) {
+	shortID := si.key.Sum(txID[:])
+	if si.collided[shortID] {
+		return
+	}
+	if prev, exist := si.ids[shortID]; exist && prev != txID {
+		delete(si.ids, shortID)
+		si.collided[shortID] = true
+		return
+	}
+	si.ids[shortID] = txID
+}
+
+func (si *shortTxIndex) size() int {
+	return len(si.ids) + len(si.collided)
+}
+
+// resolve split short ids to resolved tx ids and unresolved short ids.
+func (si *shortTxIndex) resolve(shortIDs []uint64) (resolved []types.TxID, unresolved []uint64) {
+	resolved = make([]types.TxID, 0, len(shortIDs))
+	for _, shortID := range shortIDs {
+		if txID, found := si.ids[shortID]; found {
+			resolved = append(resolved, txID)
+		} else {
+			unresolved = append(unresolved, shortID)
+		}
+	}
+	return
+}
@@ -0,0 +1,70 @@
+/*
+ * @file
+ * @copyright defined in aergo/LICENSE.txt
+ */
+
+package p2p
+
+import (
+	"testing"
+
+	"github.com/aergoio/aergo/p2p/p2putil"
+	"github.com/aergoio/aergo/types"
+	"github.com/stretchr/testify/assert"
+)
+
+func TestNewShortTxIndex(t *testing.T) {
+	assert.NotNil(t, newShortTxIndex(p2putil.NewShortIDSalt()))
+	assert.Nil(t, newShortTxIndex(nil))
+	assert.Nil(t, newShortTxIndex(make([]byte, p2putil.ShortIDSaltLength-1)))
+}
+
+func TestShortTxIndex_resolve(t *testing.T) {
+	salt := p2putil.NewShortIDSalt()
+	key, _ := p2putil.NewShortIDKey(salt)
+	known := make([]types.TxID, 10)
+	knownIDs := make([]uint64, len(known))
+	for i := range known {
+		known[i] = generateHash(uint64(i))
+		knownIDs[i] = key.Sum(known[i][:])
+	}
+	unknownTx := generateHash(100)
+	unknownID := key.Sum(unknownTx[:])
+
+	si := newShortTxIndex(salt)
+	assert.True(t, si.sameSalt(salt))
+	assert.False(t, si.sameSalt(p2putil.NewShortIDSalt()))
+	for _, txID := range known {
+		si.add(txID)
+	}
+	// adding same tx again is not a collision
+	si.add(known[0])
+	assert.Equal(t, len(known), si.size())
+
+	resolved, unresolved := si.resolve(append([]uint64{unknownID}, knownIDs...))
+	assert.Equal(t, known, resolved)
+	assert.Equal(t, []uint64{unknownID}, unresolved)
+}
+
+func TestShortTxIndex_addCollision(t *testing.T) {
+	salt := p2putil.NewShortIDSalt()
+	key, _ := p2putil.NewShortIDKey(salt)
+	tx1, tx2 := generateHash(1), generateHash(2)
+
+	si := newShortTxIndex(salt)
+	si.add(tx1)
+	// make collision artificially, since finding real collision of 64bit ids is impractical
+	collidedID := key.Sum(tx2[:])
+	si.ids[collidedID] = tx1
+	si.add(tx2)
+
+	assert.True(t, si.collided[collidedID])
+	resolved, unresolved := si.resolve([]uint64{collidedID})
+	assert.Empty(t, resolved)
+	assert.Equal(t, []uint64{collidedID}, unresolved)
+
+	// collided short id is not resolved anymore
+	si.add(tx2)
+	_, unresolved = si.resolve([]uint64{collidedID})
+	assert.Equal(t, []uint64{collidedID}, unresolved)
+}
@@ -0,0 +1,65 @@
+/*
+ * @file
+ * @copyright defined in aergo/LICENSE.txt
+ */
+
+package p2p
+
+import (
+	"time"
+
+	"github.com/aergoio/aergo/message"
+	"github.com/aergoio/aergo/p2p/p2pcommon"
+	"github.com/aergoio/aergo/types"
+)
+
+// StateChunkReceiver sends p2p GetStateChunkRequest to target peer and tells the response to syncer.
+// It doesn't send response if timeout expired, and syncer handles the timeout by itself.
+type StateChunkReceiver struct {
+	requestID p2pcommon.MsgID
+
+	peer  p2pcommon.RemotePeer
+	actor p2pcommon.ActorService
+
+	req      *message.GetStateChunk
+	timeout  time.Time
+	finished bool
+}
+
+func NewStateChunkReceiver(actor p2pcommon.ActorService, peer p2pcommon.RemotePeer, req *message.GetStateChunk, ttl time.Duration) *StateChunkReceiver {
+	timeout := time.Now().Add(ttl)
+	return &StateChunkReceiver{actor: actor, peer: peer, req: req, timeout: timeout}
+}
+
+func (br *StateChunkReceiver) StartGet() {
+	// create message data
+	req := &types.GetStateChunkRequest{Root: br.req.Root, Start: br.req.Start, End: br.req.End, Limit: br.req.Limit,
+		Accounts: br.req.Accounts, StateRoot: br.req.StateRoot, Account: br.req.Account, Sql: br.req.Sql,
+		Offset: br.req.Offset, Snapshot: br.req.Snapshot}
+	mo := br.peer.MF().NewMsgRequestOrderWithReceiver(br.ReceiveResp, p2pcommon.GetStateChunkRequest, req)
+	br.requestID = mo.GetMsgID()
+	br.peer.SendMessage(mo)
+}
+
+// ReceiveResp must be called just in read go routine
+func (br *StateChunkReceiver) ReceiveResp(msg p2pcommon.Message, msgBody p2pcommon.MessageBody) (ret bool) {
+	ret = true
+	br.peer.ConsumeRequest(br.requestID)
+	// timeout
+	if br.finished || br.timeout.Before(time.Now()) {
+		// silently ignore already finished job
+		br.finished = true
+		return
+	}
+	br.finished = true
+
+	rsp := &message.GetStateChunkRsp{Seq: br.req.Seq, ToWhom: br.peer.ID()}
+	body := msgBody.(*types.GetStateChunkResponse)
+	if body.Status != types.ResultStatus_OK {
+		rsp.Err = message.RemotePeerFailError
+	} else {
+		rsp.Chunk = body
+	}
+	br.actor.TellRequest(message.SyncerSvc, rsp)
+	return
+}
@@ -288,10 +288,18 @@ func (f *testDoubleHashesRespFactory) NewMsgTxBroadcastOrder(noticeMsg *types.Ne
 	panic("implement me")
 }
 
+func (f *testDoubleHashesRespFactory) NewMsgTxShortBroadcastOrder(noticeMsg *types.NewTxShortNotice) p2pcommon.MsgOrder {
+	panic("implement me")
+}
+
 func (f *testDoubleHashesRespFactory) NewMsgBPBroadcastOrder(noticeMsg *types.BlockProducedNotice) p2pcommon.MsgOrder {
 	panic("implement me")
 }
 
+func (f *testDoubleHashesRespFactory) NewMsgCompactBlockOrder(noticeMsg *types.CompactBlockNotice) p2pcommon.MsgOrder {
+	panic("implement me")
+}
+
 func (f *testDoubleHashesRespFactory) NewRaftMsgOrder(msgType raftpb.MessageType, raftMsg *raftpb.Message) p2pcommon.MsgOrder {
 	panic("implement me")
 }
@@ -319,10 +327,18 @@ func (f *testDoubleMOFactory) NewMsgTxBroadcastOrder(noticeMsg *types.NewTransac
 	panic("implement me")
 }
 
+func (f *testDoubleMOFactory) NewMsgTxShortBroadcastOrder(noticeMsg *types.NewTxShortNotice) p2pcommon.MsgOrder {
+	panic("implement me")
+}
+
 func (f *testDoubleMOFactory) NewMsgBPBroadcastOrder(noticeMsg *types.BlockProducedNotice) p2pcommon.MsgOrder {
 	panic("implement me")
 }
 
+func (f *testDoubleMOFactory) NewMsgCompactBlockOrder(noticeMsg *types.CompactBlockNotice) p2pcommon.MsgOrder {
+	panic("implement me")
+}
+
 func (f *testDoubleMOFactory) NewMsgRequestOrder(expecteResponse bool, protocolID p2pcommon.SubProtocol, message p2pcommon.MessageBody) p2pcommon.MsgOrder {
 	panic("implement me")
 }
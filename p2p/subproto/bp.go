@@ -74,6 +74,146 @@ func (h *blockProducedNoticeHandler) checkSender(bpID types.PeerID) bool {
 	}
 }
 
+// compactBlockNoticeHandler handle compact form of blockProducedNotice
+type compactBlockNoticeHandler struct {
+	blockProducedNoticeHandler
+}
+
+var _ p2pcommon.MessageHandler = (*compactBlockNoticeHandler)(nil)
+
+// NewCompactBlockNoticeHandler creates handler for CompactBlockNotice
+func NewCompactBlockNoticeHandler(is p2pcommon.InternalService, pm p2pcommon.PeerManager, peer p2pcommon.RemotePeer, logger *log.Logger, actor p2pcommon.ActorService, sm p2pcommon.SyncManager) *compactBlockNoticeHandler {
+	bh := &compactBlockNoticeHandler{blockProducedNoticeHandler: *NewBlockProducedNoticeHandler(is, pm, peer, logger, actor, sm)}
+	bh.protocol = p2pcommon.CompactBlockNotice
+	return bh
+}
+
+func (h *compactBlockNoticeHandler) ParsePayload(rawbytes []byte) (p2pcommon.MessageBody, error) {
+	return p2putil.UnmarshalAndReturn(rawbytes, &types.CompactBlockNotice{})
+}
+
+func (h *compactBlockNoticeHandler) Handle(msg p2pcommon.Message, msgBody p2pcommon.MessageBody) {
+	remotePeer := h.peer
+	data := msgBody.(*types.CompactBlockNotice)
+	if data.Block == nil || len(data.Block.Hash) == 0 || data.Block.Header == nil {
+		h.logger.Info().Str(p2putil.LogPeerName, remotePeer.Name()).Msg("invalid compact block notice. block is null")
+		return
+	}
+	// remove to verbose log
+	p2putil.DebugLogReceive(h.logger, h.protocol, msg.ID().String(), remotePeer, data)
+
+	block := data.Block
+	blockID, err := types.ParseToBlockID(block.GetHash())
+	if err != nil {
+		// TODO add penalty score
+		h.logger.Info().Str(p2putil.LogPeerName, remotePeer.Name()).Str("hash", enc.ToString(block.GetHash())).Msg("malformed blockHash")
+		return
+	}
+	bpID, err := block.BPID()
+	if err != nil {
+		h.logger.Debug().Err(err).Str("blockID", blockID.String()).Msg("invalid block publick key")
+		return
+	}
+	if !h.checkSender(bpID) {
+		h.logger.Debug().Str("blockID", blockID.String()).Msg("peer is not access right to send bp notice")
+		return
+	}
+	txIDs := make([]types.TxID, len(data.TxHashes))
+	for i, hash := range data.TxHashes {
+		if txIDs[i], err = types.ParseToTxID(hash); err != nil {
+			h.logger.Info().Str(p2putil.LogPeerName, remotePeer.Name()).Str("hash", enc.ToString(hash)).Msg("malformed txhash found")
+			return
+		}
+	}
+	// remote peer has all txs in block
+	remotePeer.UpdateTxCache(txIDs)
+	// block by blockProduced notice must be new fresh block
+	remotePeer.UpdateLastNotice(blockID, data.BlockNo)
+	h.sm.HandleCompactBlockNotice(remotePeer, data)
+}
+
+type blockTxsRequestHandler struct {
+	BaseMsgHandler
+	asyncHelper
+}
+
+var _ p2pcommon.MessageHandler = (*blockTxsRequestHandler)(nil)
+
+// NewBlockTxsReqHandler creates handler for GetBlockTxsRequest
+func NewBlockTxsReqHandler(pm p2pcommon.PeerManager, peer p2pcommon.RemotePeer, logger *log.Logger, actor p2pcommon.ActorService) *blockTxsRequestHandler {
+	bh := &blockTxsRequestHandler{BaseMsgHandler: BaseMsgHandler{protocol: p2pcommon.GetBlockTxsRequest, pm: pm, peer: peer, actor: actor, logger: logger}, asyncHelper: newAsyncHelper()}
+	return bh
+}
+
+func (bh *blockTxsRequestHandler) ParsePayload(rawbytes []byte) (p2pcommon.MessageBody, error) {
+	return p2putil.UnmarshalAndReturn(rawbytes, &types.GetBlockTxsRequest{})
+}
+
+func (bh *blockTxsRequestHandler) Handle(msg p2pcommon.Message, msgBody p2pcommon.MessageBody) {
+	remotePeer := bh.peer
+	data := msgBody.(*types.GetBlockTxsRequest)
+	p2putil.DebugLogReceive(bh.logger, bh.protocol, msg.ID().String(), remotePeer, data)
+	if bh.issue() {
+		go bh.handleBlockTxsReq(msg, data)
+	} else {
+		resp := &types.GetBlockTxsResponse{Status: types.ResultStatus_RESOURCE_EXHAUSTED, BlockHash: data.BlockHash}
+		remotePeer.SendMessage(remotePeer.MF().NewMsgResponseOrder(msg.ID(), p2pcommon.GetBlockTxsResponse, resp))
+	}
+}
+
+func (bh *blockTxsRequestHandler) handleBlockTxsReq(msg p2pcommon.Message, data *types.GetBlockTxsRequest) {
+	defer bh.release()
+	remotePeer := bh.peer
+
+	status := types.ResultStatus_OK
+	var txs []*types.Tx
+	foundBlock, err := bh.actor.GetChainAccessor().GetBlock(data.BlockHash)
+	if err != nil || foundBlock == nil {
+		bh.logger.Debug().Err(err).Str(p2putil.LogBlkHash, enc.ToString(data.BlockHash)).Str(p2putil.LogOrgReqID, msg.ID().String()).Msg("requested block of txs is missing")
+		status = types.ResultStatus_NOT_FOUND
+	} else {
+		blockTxs := foundBlock.GetBody().GetTxs()
+		txs = make([]*types.Tx, 0, len(data.Indexes))
+		for _, idx := range data.Indexes {
+			if int(idx) >= len(blockTxs) {
+				status = types.ResultStatus_INVALID_ARGUMENT
+				txs = nil
+				break
+			}
+			txs = append(txs, blockTxs[idx])
+		}
+	}
+	resp := &types.GetBlockTxsResponse{Status: status, BlockHash: data.BlockHash, Txs: txs}
+	remotePeer.SendMessage(remotePeer.MF().NewMsgResponseOrder(msg.ID(), p2pcommon.GetBlockTxsResponse, resp))
+}
+
+type blockTxsResponseHandler struct {
+	BaseMsgHandler
+}
+
+var _ p2pcommon.MessageHandler = (*blockTxsResponseHandler)(nil)
+
+// NewBlockTxsRespHandler creates handler for GetBlockTxsResponse
+func NewBlockTxsRespHandler(pm p2pcommon.PeerManager, peer p2pcommon.RemotePeer, logger *log.Logger, actor p2pcommon.ActorService) *blockTxsResponseHandler {
+	bh := &blockTxsResponseHandler{BaseMsgHandler{protocol: p2pcommon.GetBlockTxsResponse, pm: pm, peer: peer, actor: actor, logger: logger}}
+	return bh
+}
+
+func (bh *blockTxsResponseHandler) ParsePayload(rawbytes []byte) (p2pcommon.MessageBody, error) {
+	return p2putil.UnmarshalAndReturn(rawbytes, &types.GetBlockTxsResponse{})
+}
+
+func (bh *blockTxsResponseHandler) Handle(msg p2pcommon.Message, msgBody p2pcommon.MessageBody) {
+	remotePeer := bh.peer
+	data := msgBody.(*types.GetBlockTxsResponse)
+	p2putil.DebugLogReceiveResponse(bh.logger, bh.protocol, msg.ID().String(), msg.OriginalID().String(), remotePeer, data)
+
+	// response is consumed by compact block receiver
+	if !remotePeer.GetReceiver(msg.OriginalID())(msg, data) {
+		remotePeer.ConsumeRequest(msg.OriginalID())
+	}
+}
+
 // toAgentBPNoticeHandler handle blockProducedNotice to agent node from any other peer
 type toAgentBPNoticeHandler struct {
 	BaseMsgHandler
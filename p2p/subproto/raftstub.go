@@ -46,6 +46,39 @@ func (bh *raftBPNoticeDiscardHandler) Handle(msg p2pcommon.Message, msgBody p2pc
 	}
 }
 
+// raftCompactBlkNoticeDiscardHandler silently discard compact block notice, same as raftBPNoticeDiscardHandler.
+type raftCompactBlkNoticeDiscardHandler struct {
+	BaseMsgHandler
+}
+
+var _ p2pcommon.MessageHandler = (*raftCompactBlkNoticeDiscardHandler)(nil)
+
+// NewCompactBlkNoticeDiscardHandler creates handler for CompactBlockNotice
+func NewCompactBlkNoticeDiscardHandler(pm p2pcommon.PeerManager, peer p2pcommon.RemotePeer, logger *log.Logger, actor p2pcommon.ActorService, sm p2pcommon.SyncManager) p2pcommon.MessageHandler {
+	bh := &raftCompactBlkNoticeDiscardHandler{BaseMsgHandler: BaseMsgHandler{protocol: p2pcommon.CompactBlockNotice, pm: pm, sm: sm, peer: peer, actor: actor, logger: logger}}
+	return bh
+}
+
+func (bh *raftCompactBlkNoticeDiscardHandler) ParsePayload(rawbytes []byte) (p2pcommon.MessageBody, error) {
+	return p2putil.UnmarshalAndReturn(rawbytes, &types.CompactBlockNotice{})
+}
+
+func (bh *raftCompactBlkNoticeDiscardHandler) Handle(msg p2pcommon.Message, msgBody p2pcommon.MessageBody) {
+	remotePeer := bh.peer
+	data := msgBody.(*types.CompactBlockNotice)
+	if data.GetBlock() == nil || len(data.GetBlock().Hash) == 0 {
+		bh.logger.Info().Str(p2putil.LogPeerName, remotePeer.Name()).Msg("invalid compact block notice. block is null")
+		return
+	}
+	// just update last status
+	if blockID, err := types.ParseToBlockID(data.GetBlock().Hash); err != nil {
+		bh.logger.Info().Err(err).Str(p2putil.LogPeerName, remotePeer.Name()).Msg("invalid block hash")
+		return
+	} else {
+		remotePeer.UpdateLastNotice(blockID, data.BlockNo)
+	}
+}
+
 // raftBPNoticeDiscardHandler silently discard blk notice. It is for raft block producer, since raft BP receive notice from raft HTTPS
 type raftNewBlkNoticeDiscardHandler struct {
 	BaseMsgHandler
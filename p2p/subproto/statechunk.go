@@ -0,0 +1,66 @@
+/*
+ * @file
+ * @copyright defined in aergo/LICENSE.txt
+ */
+
+package subproto
+
+import (
+	"github.com/aergoio/aergo-lib/log"
+	"github.com/aergoio/aergo/p2p/p2pcommon"
+	"github.com/aergoio/aergo/p2p/p2putil"
+	"github.com/aergoio/aergo/types"
+)
+
+type getStateChunkRequestHandler struct {
+	BaseMsgHandler
+}
+
+var _ p2pcommon.MessageHandler = (*getStateChunkRequestHandler)(nil)
+
+type getStateChunkResponseHandler struct {
+	BaseMsgHandler
+}
+
+var _ p2pcommon.MessageHandler = (*getStateChunkResponseHandler)(nil)
+
+// NewGetStateChunkReqHandler creates handler for GetStateChunkRequest
+func NewGetStateChunkReqHandler(pm p2pcommon.PeerManager, peer p2pcommon.RemotePeer, logger *log.Logger, actor p2pcommon.ActorService) *getStateChunkRequestHandler {
+	bh := &getStateChunkRequestHandler{BaseMsgHandler: BaseMsgHandler{protocol: p2pcommon.GetStateChunkRequest, pm: pm, peer: peer, actor: actor, logger: logger}}
+	return bh
+}
+
+func (bh *getStateChunkRequestHandler) ParsePayload(rawbytes []byte) (p2pcommon.MessageBody, error) {
+	return p2putil.UnmarshalAndReturn(rawbytes, &types.GetStateChunkRequest{})
+}
+
+func (bh *getStateChunkRequestHandler) Handle(msg p2pcommon.Message, msgBody p2pcommon.MessageBody) {
+	remotePeer := bh.peer
+	data := msgBody.(*types.GetStateChunkRequest)
+	p2putil.DebugLogReceive(bh.logger, bh.protocol, msg.ID().String(), remotePeer, data)
+
+	var resp *types.GetStateChunkResponse
+	if reader, ok := bh.actor.GetChainAccessor().(types.StateChunkReader); ok {
+		resp = reader.GetStateChunk(data)
+	} else {
+		resp = &types.GetStateChunkResponse{Status: types.ResultStatus_UNIMPLEMENTED}
+	}
+	remotePeer.SendMessage(remotePeer.MF().NewMsgResponseOrder(msg.ID(), p2pcommon.GetStateChunkResponse, resp))
+}
+
+// NewGetStateChunkRespHandler creates handler for GetStateChunkResponse
+func NewGetStateChunkRespHandler(pm p2pcommon.PeerManager, peer p2pcommon.RemotePeer, logger *log.Logger, actor p2pcommon.ActorService) *getStateChunkResponseHandler {
+	bh := &getStateChunkResponseHandler{BaseMsgHandler: BaseMsgHandler{protocol: p2pcommon.GetStateChunkResponse, pm: pm, peer: peer, actor: actor, logger: logger}}
+	return bh
+}
+
+func (bh *getStateChunkResponseHandler) ParsePayload(rawbytes []byte) (p2pcommon.MessageBody, error) {
+	return p2putil.UnmarshalAndReturn(rawbytes, &types.GetStateChunkResponse{})
+}
+
+func (bh *getStateChunkResponseHandler) Handle(msg p2pcommon.Message, msgBody p2pcommon.MessageBody) {
+	data := msgBody.(*types.GetStateChunkResponse)
+	p2putil.DebugLogReceiveResponse(bh.logger, bh.protocol, msg.ID().String(), msg.OriginalID().String(), bh.peer, data)
+
+	bh.peer.GetReceiver(msg.OriginalID())(msg, data)
+}
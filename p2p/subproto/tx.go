@@ -119,3 +119,107 @@ func (th *newTxNoticeHandler) Handle(msg p2pcommon.Message, msgBody p2pcommon.Me
 		th.sm.HandleNewTxNotice(th.peer, added, data)
 	}
 }
+
+type newTxShortNoticeHandler struct {
+	BaseMsgHandler
+}
+
+var _ p2pcommon.MessageHandler = (*newTxShortNoticeHandler)(nil)
+
+// NewNewTxShortNoticeHandler creates handler for NewTxShortNotice
+func NewNewTxShortNoticeHandler(pm p2pcommon.PeerManager, peer p2pcommon.RemotePeer, logger *log.Logger, actor p2pcommon.ActorService, sm p2pcommon.SyncManager) *newTxShortNoticeHandler {
+	th := &newTxShortNoticeHandler{BaseMsgHandler: BaseMsgHandler{protocol: p2pcommon.NewTxShortNotice, pm: pm, sm: sm, peer: peer, actor: actor, logger: logger}}
+	return th
+}
+
+func (th *newTxShortNoticeHandler) ParsePayload(rawbytes []byte) (p2pcommon.MessageBody, error) {
+	return p2putil.UnmarshalAndReturn(rawbytes, &types.NewTxShortNotice{})
+}
+
+func (th *newTxShortNoticeHandler) Handle(msg p2pcommon.Message, msgBody p2pcommon.MessageBody) {
+	remotePeer := th.peer
+	data := msgBody.(*types.NewTxShortNotice)
+	// remove to verbose log
+	if th.logger.IsDebugEnabled() {
+		p2putil.DebugLogReceive(th.logger, th.protocol, msg.ID().String(), remotePeer, data)
+	}
+
+	if len(data.ShortIDs) == 0 {
+		return
+	}
+	th.sm.HandleNewTxShortNotice(remotePeer, data)
+}
+
+type txHashesRequestHandler struct {
+	BaseMsgHandler
+}
+
+var _ p2pcommon.MessageHandler = (*txHashesRequestHandler)(nil)
+
+// NewTxHashesReqHandler creates handler for GetTxHashesRequest
+func NewTxHashesReqHandler(pm p2pcommon.PeerManager, peer p2pcommon.RemotePeer, logger *log.Logger, actor p2pcommon.ActorService) *txHashesRequestHandler {
+	th := &txHashesRequestHandler{BaseMsgHandler{protocol: p2pcommon.GetTxHashesRequest, pm: pm, peer: peer, actor: actor, logger: logger}}
+	return th
+}
+
+func (th *txHashesRequestHandler) ParsePayload(rawbytes []byte) (p2pcommon.MessageBody, error) {
+	return p2putil.UnmarshalAndReturn(rawbytes, &types.GetTxHashesRequest{})
+}
+
+func (th *txHashesRequestHandler) Handle(msg p2pcommon.Message, msgBody p2pcommon.MessageBody) {
+	remotePeer := th.peer
+	body := msgBody.(*types.GetTxHashesRequest)
+	p2putil.DebugLogReceive(th.logger, th.protocol, msg.ID().String(), remotePeer, body)
+
+	status := types.ResultStatus_OK
+	txIDs := remotePeer.LookupShortTxIDs(body.ShortIDs)
+	if len(txIDs) == 0 {
+		status = types.ResultStatus_NOT_FOUND
+	}
+	hashes := make([][]byte, len(txIDs))
+	for i := range txIDs {
+		hashes[i] = txIDs[i][:]
+	}
+	resp := &types.GetTxHashesResponse{Status: status, Hashes: hashes}
+	remotePeer.SendMessage(remotePeer.MF().NewMsgResponseOrder(msg.ID(), p2pcommon.GetTxHashesResponse, resp))
+}
+
+type txHashesResponseHandler struct {
+	BaseMsgHandler
+}
+
+var _ p2pcommon.MessageHandler = (*txHashesResponseHandler)(nil)
+
+// NewTxHashesRespHandler creates handler for GetTxHashesResponse
+func NewTxHashesRespHandler(pm p2pcommon.PeerManager, peer p2pcommon.RemotePeer, logger *log.Logger, actor p2pcommon.ActorService, sm p2pcommon.SyncManager) *txHashesResponseHandler {
+	th := &txHashesResponseHandler{BaseMsgHandler{protocol: p2pcommon.GetTxHashesResponse, pm: pm, sm: sm, peer: peer, actor: actor, logger: logger}}
+	return th
+}
+
+func (th *txHashesResponseHandler) ParsePayload(rawbytes []byte) (p2pcommon.MessageBody, error) {
+	return p2putil.UnmarshalAndReturn(rawbytes, &types.GetTxHashesResponse{})
+}
+
+func (th *txHashesResponseHandler) Handle(msg p2pcommon.Message, msgBody p2pcommon.MessageBody) {
+	remotePeer := th.peer
+	data := msgBody.(*types.GetTxHashesResponse)
+	p2putil.DebugLogReceiveResponse(th.logger, th.protocol, msg.ID().String(), msg.OriginalID().String(), remotePeer, data)
+
+	remotePeer.ConsumeRequest(msg.OriginalID())
+	if data.Status != types.ResultStatus_OK || len(data.Hashes) == 0 {
+		return
+	}
+	hashes := make([]types.TxID, 0, len(data.Hashes))
+	for _, hash := range data.Hashes {
+		if tid, err := types.ParseToTxID(hash); err != nil {
+			th.logger.Info().Str(p2putil.LogPeerName, remotePeer.Name()).Str("hash", enc.ToString(hash)).Msg("malformed txhash found")
+			return
+		} else {
+			hashes = append(hashes, tid)
+		}
+	}
+	added := remotePeer.UpdateTxCache(hashes)
+	if len(added) > 0 {
+		th.sm.HandleNewTxNotice(remotePeer, added, &types.NewTransactionsNotice{TxHashes: data.Hashes})
+	}
+}
@@ -66,6 +66,18 @@ func (sm *syncManager) HandleBlockProducedNotice(peer p2pcommon.RemotePeer, bloc
 	sm.actor.SendRequest(message.ChainSvc, &message.AddBlock{PeerID: peer.ID(), Block: block, Bstate: nil})
 }
 
+func (sm *syncManager) HandleCompactBlockNotice(peer p2pcommon.RemotePeer, data *types.CompactBlockNotice) {
+	hash := types.MustParseBlockID(data.Block.GetHash())
+	ok, _ := sm.blkCache.ContainsOrAdd(hash, cachePlaceHolder)
+	if ok {
+		sm.logger.Warn().Str(p2putil.LogBlkHash, hash.String()).Str(p2putil.LogPeerName, peer.Name()).Msg("Duplicated compact block notice")
+		return
+	}
+
+	receiver := newCompactBlockReceiver(sm.actor, peer, sm.logger, sm.tm.txCache, data, compactBlockTxTimeout)
+	go receiver.StartGet()
+}
+
 func (sm *syncManager) HandleNewBlockNotice(peer p2pcommon.RemotePeer, data *types.NewBlockNotice) {
 	hash := types.MustParseBlockID(data.BlockHash)
 	peerID := peer.ID()
@@ -124,6 +136,10 @@ func (sm *syncManager) HandleNewTxNotice(peer p2pcommon.RemotePeer, hashes []typ
 	sm.tm.HandleNewTxNotice(peer, hashes, data)
 }
 
+func (sm *syncManager) HandleNewTxShortNotice(peer p2pcommon.RemotePeer, data *types.NewTxShortNotice) {
+	sm.tm.HandleNewTxShortNotice(peer, data)
+}
+
 func (sm *syncManager) HandleGetTxReq(peer p2pcommon.RemotePeer, msgID p2pcommon.MsgID, data *types.GetTransactionsRequest) error {
 	return sm.tm.HandleGetTxReq(peer, msgID, data)
 }
@@ -33,6 +33,8 @@ type syncTxManager struct {
 	// received notice but not in my mempool
 	frontCache       map[types.TxID]*incomingTxNotice
 	toNoticeIdQueue  *list.List
+	// shortIndexes resolves short tx ids in tx notices from remote peers
+	shortIndexes map[types.PeerID]*shortTxIndex
 
 	taskChannel      chan smTask
 	taskQueryChannel chan smTask
@@ -52,6 +54,7 @@ func newTxSyncManager(sm p2pcommon.SyncManager, actor p2pcommon.ActorService, pm
 	tm := &syncTxManager{sm:sm, actor: actor, pm: pm, logger: logger,
 		frontCache:       make(map[types.TxID]*incomingTxNotice),
 		toNoticeIdQueue:  list.New(),
+		shortIndexes:     make(map[types.PeerID]*shortTxIndex),
 		taskChannel:      make(chan smTask, 20),
 		finishChannel:    make(chan struct{}, 1),
 		taskQueryChannel: make(chan smTask, 10),
@@ -150,46 +153,111 @@ func getIDsBuf(idx int) []types.TxID {
 
 func (tm *syncTxManager) HandleNewTxNotice(peer p2pcommon.RemotePeer, txIDs []types.TxID, data *types.NewTransactionsNotice) {
 	tm.taskChannel <- func() {
-		peerID := peer.ID()
-		now := time.Now()
-		newComer := addBuf[:0]
-		duplicated := dupBuf[:0]
-		queued := queuedBuf[:0]
-
-		for _, txID := range txIDs {
-			// If you want to strict check, query tx to cahinservice. It is skipped since it's so time consuming
-			// mempool has tx already
-			if ok := tm.txCache.Contains(txID); ok {
-				duplicated = append(duplicated, txID)
-				continue
-			}
-			// check if tx is in front cache
-			if info, ok := tm.frontCache[txID]; ok {
-				// other peer sent notice already. so add peerid to next waiting list
-				appendPeerID(info, peerID)
-				queued = append(queued,txID)
-				continue
-			}
+		tm.handleNewTxIDs(peer, txIDs)
+	}
+}
+
+// handleNewTxIDs must be called in syncTxManager goroutine
+func (tm *syncTxManager) handleNewTxIDs(peer p2pcommon.RemotePeer, txIDs []types.TxID) {
+	peerID := peer.ID()
+	now := time.Now()
+	newComer := addBuf[:0]
+	duplicated := dupBuf[:0]
+	queued := queuedBuf[:0]
+
+	for _, txID := range txIDs {
+		// If you want to strict check, query tx to cahinservice. It is skipped since it's so time consuming
+		// mempool has tx already
+		if ok := tm.txCache.Contains(txID); ok {
+			duplicated = append(duplicated, txID)
+			continue
+		}
+		// check if tx is in front cache
+		if info, ok := tm.frontCache[txID]; ok {
+			// other peer sent notice already. so add peerid to next waiting list
+			appendPeerID(info, peerID)
+			queued = append(queued,txID)
+			continue
+		}
+
+		info := &incomingTxNotice{hash: txID, created: now, lastSent: now}
+		tm.frontCache[txID] = info
+		tm.indexShortTxID(txID)
+		newComer = append(newComer,txID)
+	}
 
-			info := &incomingTxNotice{hash: txID, created: now, lastSent: now}
-			tm.frontCache[txID] = info
-			newComer = append(newComer,txID)
+	if len(newComer) > 0 {
+		if len(newComer) <= len(txIDs) {
+			copy(txIDs, newComer)
+			txIDs=txIDs[:len(newComer)]
 		}
+		tm.sendGetTx(peer, txIDs)
+	}
+	if len(queued) > 0 {
+		toQueue := make([]types.TxID,len(queued))
+		copy(toQueue, queued)
+		tm.toNoticeIdQueue.PushBack(&queryQueue{peerID:peerID,txIDs:toQueue})
+	}
 
-		if len(newComer) > 0 {
-			if len(newComer) <= len(txIDs) {
-				copy(txIDs, newComer)
-				txIDs=txIDs[:len(newComer)]
+	tm.logger.Trace().Str(p2putil.LogPeerID, p2putil.ShortForm(peerID)).Int("newCnt",len(newComer)).Int("queCnt",len(queued)).Int("dupCnt",len(duplicated)).Array("newComer", types.NewLogTxIDsMarshaller(newComer, 10)).Array("duplicated", types.NewLogTxIDsMarshaller(duplicated, 10)).Array("queued", types.NewLogTxIDsMarshaller(queued, 10)).Int("frontCacheSize",len(tm.frontCache)).Msg("push txs, to query next time")
+}
+
+func (tm *syncTxManager) HandleNewTxShortNotice(peer p2pcommon.RemotePeer, data *types.NewTxShortNotice) {
+	tm.taskChannel <- func() {
+		idx := tm.getShortTxIndex(peer.ID(), data.Salt)
+		if idx == nil {
+			tm.logger.Info().Str(p2putil.LogPeerName, peer.Name()).Int("saltLen", len(data.Salt)).Msg("invalid salt of short tx notice")
+			return
+		}
+		resolved, unresolved := idx.resolve(data.ShortIDs)
+		if len(resolved) > 0 {
+			// peer also knows these txs, so local peer don't need to notify it back.
+			if added := peer.UpdateTxCache(resolved); len(added) > 0 {
+				tm.handleNewTxIDs(peer, added)
 			}
-			tm.sendGetTx(peer, txIDs)
 		}
-		if len(queued) > 0 {
-			toQueue := make([]types.TxID,len(queued))
-			copy(toQueue, queued)
-			tm.toNoticeIdQueue.PushBack(&queryQueue{peerID:peerID,txIDs:toQueue})
+		if len(unresolved) > 0 {
+			// unknown or collided short ids. get full hashes to remote peer.
+			tm.logger.Trace().Str(p2putil.LogPeerName, peer.Name()).Int("resolved", len(resolved)).Int("unresolved", len(unresolved)).Msg("syncManager request full hashes of short tx ids")
+			peer.SendMessage(peer.MF().NewMsgRequestOrder(true, p2pcommon.GetTxHashesRequest, &types.GetTxHashesRequest{ShortIDs: unresolved}))
 		}
+	}
+}
 
-		tm.logger.Trace().Str(p2putil.LogPeerID, p2putil.ShortForm(peerID)).Int("newCnt",len(newComer)).Int("queCnt",len(queued)).Int("dupCnt",len(duplicated)).Array("newComer", types.NewLogTxIDsMarshaller(newComer, 10)).Array("duplicated", types.NewLogTxIDsMarshaller(duplicated, 10)).Array("queued", types.NewLogTxIDsMarshaller(queued, 10)).Int("frontCacheSize",len(tm.frontCache)).Msg("push txs, to query next time")
+// getShortTxIndex returns index for the salt of remote peer. The index is newly built if salt is changed
+// (i.e. peer is reconnected) or the index is grown too big.
+func (tm *syncTxManager) getShortTxIndex(peerID types.PeerID, salt []byte) *shortTxIndex {
+	idx, found := tm.shortIndexes[peerID]
+	if found && idx.sameSalt(salt) && idx.size() < maxShortTxIndexSize {
+		return idx
+	}
+	idx = newShortTxIndex(salt)
+	if idx == nil {
+		return nil
+	}
+	for _, key := range tm.txCache.Keys() {
+		idx.add(key.(types.TxID))
+	}
+	for txID := range tm.frontCache {
+		idx.add(txID)
+	}
+	tm.shortIndexes[peerID] = idx
+	return idx
+}
+
+// indexShortTxID add newly known tx id to short id indexes of all remote peers
+func (tm *syncTxManager) indexShortTxID(txID types.TxID) {
+	for _, idx := range tm.shortIndexes {
+		idx.add(txID)
+	}
+}
+
+// cleanupShortTxIndexes removes indexes of disconnected peers
+func (tm *syncTxManager) cleanupShortTxIndexes() {
+	for peerID := range tm.shortIndexes {
+		if _, connected := tm.pm.GetPeer(peerID); !connected {
+			delete(tm.shortIndexes, peerID)
+		}
 	}
 }
 
@@ -379,6 +447,9 @@ func (tm *syncTxManager) refineFrontCache() {
 			if len(tm.frontCache) > 0 {
 				tm.cleanupFrontCache(expireTime)
 			}
+			if len(tm.shortIndexes) > 0 {
+				tm.cleanupShortTxIndexes()
+			}
 		}
 		return
 	}
@@ -525,6 +596,9 @@ func (tm *syncTxManager) assignTxToPeer(info *incomingTxNotice, sendMap map[type
 
 func (tm *syncTxManager) moveToMPCache(tx *types.Tx) {
 	txID := types.ToTxID(tx.Hash)
+	if _, inFront := tm.frontCache[txID]; !inFront && !tm.txCache.Contains(txID) {
+		tm.indexShortTxID(txID)
+	}
 	delete(tm.frontCache, txID)
 	tm.txCache.Add(txID, tx)
 	tm.logger.Trace().Str("txID", txID.String()).Msg("syncManager caches tx")
@@ -10,6 +10,7 @@ import (
 	"github.com/aergoio/aergo/message/messagemock"
 	"github.com/aergoio/aergo/p2p/p2pcommon"
 	"github.com/aergoio/aergo/p2p/p2pmock"
+	"github.com/aergoio/aergo/p2p/p2putil"
 	"github.com/aergoio/aergo/types"
 	"github.com/golang/mock/gomock"
 	"github.com/stretchr/testify/assert"
@@ -129,6 +130,85 @@ func Test_syncTxManager_HandleNewTxNotice(t *testing.T) {
 	}
 }
 
+func Test_syncTxManager_HandleNewTxShortNotice(t *testing.T) {
+	logger := log.NewLogger("tt.p2p")
+	txHashes := sampleTxIDs
+	salt := p2putil.NewShortIDSalt()
+	key, _ := p2putil.NewShortIDKey(salt)
+	shortIDs := make([]uint64, len(txHashes))
+	for i, id := range txHashes {
+		shortIDs[i] = key.Sum(id[:])
+	}
+
+	tests := []struct {
+		name        string
+		salt        []byte
+		inCache     []types.TxID
+		wantResolve int
+		wantQuery   int
+	}{
+		// 0. all txs are known
+		{"TAllKnown", salt, txHashes, len(txHashes), 0},
+		// 1. some txs are unknown, so they are queried to remote peer
+		{"TPartial", salt, txHashes[2:], len(txHashes) - 2, 2},
+		// 2. all txs are unknown
+		{"TAllUnknown", salt, nil, 0, len(txHashes)},
+		// 3. wrong salt is ignored
+		{"TWrongSalt", salt[:4], txHashes, 0, 0},
+	}
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			ctrl := gomock.NewController(t)
+			defer ctrl.Finish()
+
+			mockPM := p2pmock.NewMockPeerManager(ctrl)
+			mockActor := p2pmock.NewMockActorService(ctrl)
+			mockMF := p2pmock.NewMockMoFactory(ctrl)
+			mockMO := p2pmock.NewMockMsgOrder(ctrl)
+			mockPeer := p2pmock.NewMockRemotePeer(ctrl)
+			mockPeer.EXPECT().ID().Return(sampleMeta.ID).AnyTimes()
+			mockPeer.EXPECT().Name().Return(sampleMeta.ID.String()).AnyTimes()
+
+			resolved := 0
+			if tt.wantResolve > 0 {
+				// remote peer already knows resolved txs, so they are not new
+				mockPeer.EXPECT().UpdateTxCache(gomock.Any()).DoAndReturn(func(ids []types.TxID) []types.TxID {
+					resolved = len(ids)
+					return nil
+				}).Times(1)
+			}
+			var queried *types.GetTxHashesRequest
+			if tt.wantQuery > 0 {
+				mockPeer.EXPECT().MF().Return(mockMF).Times(1)
+				mockPeer.EXPECT().SendMessage(mockMO).Times(1)
+				mockMF.EXPECT().NewMsgRequestOrder(true, p2pcommon.GetTxHashesRequest, gomock.Any()).DoAndReturn(func(e bool, p p2pcommon.SubProtocol, m p2pcommon.MessageBody) p2pcommon.MsgOrder {
+					queried = m.(*types.GetTxHashesRequest)
+					return mockMO
+				}).Times(1)
+			}
+
+			tm := newTxSyncManager(nil, mockActor, mockPM, logger)
+			for _, hash := range tt.inCache {
+				tm.txCache.Add(hash, true)
+			}
+			tm.Start()
+
+			tm.HandleNewTxShortNotice(mockPeer, &types.NewTxShortNotice{Salt: tt.salt, ShortIDs: shortIDs})
+
+			// make terminate
+			tm.taskChannel <- func() {
+				tm.Stop()
+			}
+			<-tm.finishChannel
+
+			assert.Equal(t, tt.wantResolve, resolved)
+			if tt.wantQuery > 0 {
+				assert.Equal(t, tt.wantQuery, len(queried.ShortIDs))
+			}
+		})
+	}
+}
+
 func equalTXIDs(a []types.TxID, b []types.TxID) bool {
 	if len(a) != len(b) {
 		return false
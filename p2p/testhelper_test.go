@@ -26,10 +26,18 @@ func (f *testDoubleMOFactory) NewMsgTxBroadcastOrder(noticeMsg *types.NewTransac
 	panic("implement me")
 }
 
+func (f *testDoubleMOFactory) NewMsgTxShortBroadcastOrder(noticeMsg *types.NewTxShortNotice) p2pcommon.MsgOrder {
+	panic("implement me")
+}
+
 func (f *testDoubleMOFactory) NewMsgBPBroadcastOrder(noticeMsg *types.BlockProducedNotice) p2pcommon.MsgOrder {
 	panic("implement me")
 }
 
+func (f *testDoubleMOFactory) NewMsgCompactBlockOrder(noticeMsg *types.CompactBlockNotice) p2pcommon.MsgOrder {
+	panic("implement me")
+}
+
 func (f *testDoubleMOFactory) NewMsgRequestOrder(expecteResponse bool, protocolID p2pcommon.SubProtocol, message p2pcommon.MessageBody) p2pcommon.MsgOrder {
 	panic("implement me")
 }
@@ -0,0 +1,62 @@
+/*
+ * @file
+ * @copyright defined in aergo/LICENSE.txt
+ */
+
+package v030
+
+import (
+	"math/bits"
+	"sync"
+)
+
+const (
+	// minPayloadClassBits is the size of smallest class of pooled payload buffer, 1KiB
+	minPayloadClassBits = 10
+	// maxPayloadClassBits is the size of biggest class of pooled payload buffer, 4MiB. bigger payloads are not pooled
+	maxPayloadClassBits = 22
+)
+
+// payloadPools are size-classed pools of payload buffers. The buffer in i-th pool has capacity of 2^(minPayloadClassBits+i) bytes.
+var payloadPools [maxPayloadClassBits - minPayloadClassBits + 1]sync.Pool
+
+// payloadClass returns the index of pool for buffer of size, or -1 if it is too big to be pooled.
+func payloadClass(size int) int {
+	if size > 1<<maxPayloadClassBits {
+		return -1
+	}
+	class := bits.Len(uint(size-1)) - minPayloadClassBits
+	if class < 0 {
+		return 0
+	}
+	return class
+}
+
+// getPayloadBuf returns buffer of length size, which is taken from pool if available.
+func getPayloadBuf(size int) []byte {
+	if size == 0 {
+		return make([]byte, 0)
+	}
+	class := payloadClass(size)
+	if class < 0 {
+		return make([]byte, size)
+	}
+	if pooled := payloadPools[class].Get(); pooled != nil {
+		return (*pooled.(*[]byte))[:size]
+	}
+	return make([]byte, size, 1<<uint(minPayloadClassBits+class))
+}
+
+// putPayloadBuf returns buffer to pool. Buffers which were not made by getPayloadBuf are just dropped.
+func putPayloadBuf(buf []byte) {
+	size := cap(buf)
+	if size == 0 {
+		return
+	}
+	class := payloadClass(size)
+	if class < 0 || size != 1<<uint(minPayloadClassBits+class) {
+		return
+	}
+	buf = buf[:0]
+	payloadPools[class].Put(&buf)
+}
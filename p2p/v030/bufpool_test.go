@@ -0,0 +1,48 @@
+/*
+ * @file
+ * @copyright defined in aergo/LICENSE.txt
+ */
+
+package v030
+
+import (
+	"testing"
+
+	"github.com/stretchr/testify/assert"
+)
+
+func Test_payloadClass(t *testing.T) {
+	tests := []struct {
+		name string
+		size int
+
+		want    int
+		wantCap int
+	}{
+		{"TTiny", 1, 0, 1024},
+		{"TMin", 1024, 0, 1024},
+		{"TMinOver", 1025, 1, 2048},
+		{"TMid", 100000, 7, 131072},
+		{"TMax", 1 << maxPayloadClassBits, maxPayloadClassBits - minPayloadClassBits, 1 << maxPayloadClassBits},
+		{"TTooBig", 1<<maxPayloadClassBits + 1, -1, 1<<maxPayloadClassBits + 1},
+	}
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			assert.Equal(t, tt.want, payloadClass(tt.size))
+			buf := getPayloadBuf(tt.size)
+			assert.Equal(t, tt.size, len(buf))
+			assert.Equal(t, tt.wantCap, cap(buf))
+			putPayloadBuf(buf)
+		})
+	}
+}
+
+func Test_putPayloadBuf(t *testing.T) {
+	// buffers not from pool must not be pooled, since their capacities do not match size class.
+	putPayloadBuf(make([]byte, 1500))
+	for i := 0; i < 10; i++ {
+		buf := getPayloadBuf(1500)
+		assert.Equal(t, 2048, cap(buf))
+	}
+	assert.NotNil(t, getPayloadBuf(0))
+}
@@ -0,0 +1,94 @@
+/*
+ * @file
+ * @copyright defined in aergo/LICENSE.txt
+ */
+
+package v030
+
+import (
+	"bytes"
+	"compress/flate"
+	"encoding/binary"
+	"fmt"
+	"io"
+	"sync"
+
+	"github.com/aergoio/aergo/p2p/p2pcommon"
+)
+
+const (
+	// compressedFlag is set to subprotocol field of header if the payload is compressed.
+	compressedFlag uint32 = 1 << 31
+	// minCompressLength is the minimum size of payload to be compressed. smaller payloads are not worth of cpu time.
+	minCompressLength = 1 << 10
+	// origLengthSize is the size of uncompressed length, which is prepended to deflated payload.
+	origLengthSize = 4
+)
+
+var flateWriterPool = sync.Pool{
+	New: func() interface{} {
+		// it can not fail with valid level
+		w, _ := flate.NewWriter(nil, flate.BestSpeed)
+		return w
+	},
+}
+
+var flateReaderPool = sync.Pool{
+	New: func() interface{} {
+		return flate.NewReader(nil)
+	},
+}
+
+var compressBufPool = sync.Pool{
+	New: func() interface{} {
+		return &bytes.Buffer{}
+	},
+}
+
+// compressPayload deflates payload into buf. It returns false if the compressed form is not smaller than original.
+func compressPayload(buf *bytes.Buffer, payload []byte) bool {
+	var origLen [origLengthSize]byte
+	binary.BigEndian.PutUint32(origLen[:], uint32(len(payload)))
+	buf.Reset()
+	buf.Write(origLen[:])
+
+	fw := flateWriterPool.Get().(*flate.Writer)
+	defer flateWriterPool.Put(fw)
+	fw.Reset(buf)
+	if _, err := fw.Write(payload); err != nil {
+		return false
+	}
+	if err := fw.Close(); err != nil {
+		return false
+	}
+	return buf.Len() < len(payload)
+}
+
+// decompressPayload inflates payload which was made by compressPayload. The returned buffer is taken from buffer pool.
+func decompressPayload(compressed []byte) ([]byte, error) {
+	if len(compressed) < origLengthSize {
+		return nil, fmt.Errorf("too short compressed payload")
+	}
+	origLen := binary.BigEndian.Uint32(compressed[:origLengthSize])
+	if origLen > p2pcommon.MaxPayloadLength {
+		return nil, fmt.Errorf("too big payload")
+	}
+
+	fr := flateReaderPool.Get().(io.ReadCloser)
+	defer flateReaderPool.Put(fr)
+	if err := fr.(flate.Resetter).Reset(bytes.NewReader(compressed[origLengthSize:]), nil); err != nil {
+		return nil, err
+	}
+	payload := getPayloadBuf(int(origLen))
+	if _, err := io.ReadFull(fr, payload); err != nil {
+		putPayloadBuf(payload)
+		return nil, fmt.Errorf("failed to inflate payload: %s", err.Error())
+	}
+	// compressed data must end exactly at the original length
+	var trail [1]byte
+	if n, _ := fr.Read(trail[:]); n != 0 {
+		putPayloadBuf(payload)
+		return nil, fmt.Errorf("payload length mismatch")
+	}
+	return payload, nil
+}
@@ -0,0 +1,181 @@
+/*
+ * @file
+ * @copyright defined in aergo/LICENSE.txt
+ */
+
+package v030
+
+import (
+	"bytes"
+	"crypto/rand"
+	"net"
+	"testing"
+	"time"
+
+	"github.com/aergoio/aergo/p2p/p2pcommon"
+	"github.com/aergoio/aergo/types"
+	"github.com/golang/protobuf/proto"
+	"github.com/stretchr/testify/assert"
+)
+
+// sampleBlocksPayload makes marshaled GetBlockResponse with blocks of contract call txs, which looks like typical
+// payload of block chunk. Hashes and signatures are random, so they are not compressible.
+func sampleBlocksPayload(blkCnt, txCnt int) []byte {
+	randBytes := func(size int) []byte {
+		b := make([]byte, size)
+		rand.Read(b)
+		return b
+	}
+	account, recipient, chainID := randBytes(33), randBytes(33), randBytes(32)
+	blocks := make([]*types.Block, blkCnt)
+	for i := range blocks {
+		txs := make([]*types.Tx, txCnt)
+		for j := range txs {
+			txs[j] = &types.Tx{Hash: randBytes(32), Body: &types.TxBody{Nonce: uint64(i*txCnt + j), Account: account, Recipient: recipient,
+				Amount: []byte{0}, Payload: []byte(`{"Name":"transfer","Args":["AmPbWrQbtQrCaJqLWdMtfk2KiN83m2HFpBbQQSTxqqchVv58o82i","1000"]}`),
+				GasLimit: 100000, GasPrice: []byte{1}, Type: types.TxType_NORMAL, ChainIdHash: chainID, Sign: randBytes(71)}}
+		}
+		blocks[i] = &types.Block{Hash: randBytes(32), Header: &types.BlockHeader{ChainID: chainID, PrevBlockHash: randBytes(32),
+			BlockNo: uint64(i), Timestamp: time.Now().UnixNano(), BlocksRootHash: randBytes(32), TxsRootHash: randBytes(32),
+			ReceiptsRootHash: randBytes(32), CoinbaseAccount: account, Sign: randBytes(71)}, Body: &types.BlockBody{Txs: txs}}
+	}
+	payload, _ := proto.Marshal(&types.GetBlockResponse{Status: types.ResultStatus_OK, Blocks: blocks, HasNext: true})
+	return payload
+}
+
+func TestV030ReadWriter_Compression(t *testing.T) {
+	bigPayload := sampleBlocksPayload(2, 100)
+	smallPayload := sampleBlocksPayload(1, 1)[:minCompressLength-1]
+
+	tests := []struct {
+		name      string
+		protocol  p2pcommon.SubProtocol
+		payload   []byte
+		enableW   bool
+		enableR   bool
+		wantCompr bool
+		wantErr   bool
+	}{
+		{"TCompressed", p2pcommon.GetBlocksResponse, bigPayload, true, true, true, false},
+		{"TNotEnabled", p2pcommon.GetBlocksResponse, bigPayload, false, false, false, false},
+		{"TSmall", p2pcommon.GetBlocksResponse, smallPayload, true, true, false, false},
+		{"TNotCompressible", p2pcommon.NewTxNotice, bigPayload, true, true, false, false},
+		{"TNotNegotiated", p2pcommon.GetBlocksResponse, bigPayload, true, false, true, true},
+	}
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			sample := p2pcommon.NewMessageValue(tt.protocol, p2pcommon.NewMsgID(), p2pcommon.EmptyID, time.Now().UnixNano(), tt.payload)
+			buf := bytes.NewBuffer(nil)
+			writer := NewV030ReadWriter(nil, buf, nil)
+			if tt.enableW {
+				writer.EnableCompression()
+			}
+			assert.Nil(t, writer.WriteMsg(sample))
+			_, _, compressed := parseHeader(func() *[msgHeaderLength]byte {
+				var header [msgHeaderLength]byte
+				copy(header[:], buf.Bytes())
+				return &header
+			}())
+			assert.Equal(t, tt.wantCompr, compressed)
+			if compressed {
+				assert.True(t, buf.Len() < msgHeaderLength+len(tt.payload))
+			}
+
+			reader := NewV030ReadWriter(buf, nil, nil)
+			if tt.enableR {
+				reader.EnableCompression()
+			}
+			actual, err := reader.ReadMsg()
+			if tt.wantErr {
+				assert.NotNil(t, err)
+				return
+			}
+			assert.Nil(t, err)
+			assert.Equal(t, sample.Subprotocol(), actual.Subprotocol())
+			assert.Equal(t, sample.ID(), actual.ID())
+			assert.Equal(t, sample.Length(), actual.Length())
+			assert.True(t, bytes.Equal(tt.payload, actual.Payload()))
+		})
+	}
+}
+
+func Test_decompressPayload(t *testing.T) {
+	payload := sampleBlocksPayload(1, 50)
+	buf := bytes.NewBuffer(nil)
+	assert.True(t, compressPayload(buf, payload))
+	compressed := buf.Bytes()
+
+	actual, err := decompressPayload(compressed)
+	assert.Nil(t, err)
+	assert.True(t, bytes.Equal(payload, actual))
+
+	// wrong original length
+	wrongLen := append([]byte{}, compressed...)
+	wrongLen[origLengthSize-1]--
+	_, err = decompressPayload(wrongLen)
+	assert.NotNil(t, err)
+	wrongLen[origLengthSize-1] += 2
+	_, err = decompressPayload(wrongLen)
+	assert.NotNil(t, err)
+	_, err = decompressPayload(compressed[:origLengthSize-1])
+	assert.NotNil(t, err)
+}
+
+// BenchmarkV030Compression measures throughput of block chunk over loopback tcp connection with and without compression.
+func BenchmarkV030Compression(b *testing.B) {
+	payload := sampleBlocksPayload(10, 200)
+	buf := bytes.NewBuffer(nil)
+	compressPayload(buf, payload)
+	b.Logf("block chunk payload %d bytes, compressed %d bytes", len(payload), buf.Len())
+
+	benchmarks := []struct {
+		name     string
+		compress bool
+	}{
+		{"BRaw", false},
+		{"BCompressed", true},
+	}
+	for _, bm := range benchmarks {
+		b.Run(bm.name, func(b *testing.B) {
+			listener, err := net.Listen("tcp", "127.0.0.1:0")
+			if err != nil {
+				b.Skip("loopback is not available:", err.Error())
+			}
+			defer listener.Close()
+			go func() {
+				conn, err := listener.Accept()
+				if err != nil {
+					return
+				}
+				defer conn.Close()
+				writer := NewV030MsgPipe(conn)
+				if bm.compress {
+					writer.EnableCompression()
+				}
+				msg := p2pcommon.NewMessageValue(p2pcommon.GetBlocksResponse, p2pcommon.NewMsgID(), p2pcommon.EmptyID, time.Now().UnixNano(), payload)
+				for i := 0; i < b.N; i++ {
+					if err := writer.WriteMsg(msg); err != nil {
+						return
+					}
+				}
+			}()
+			conn, err := net.Dial("tcp", listener.Addr().String())
+			if err != nil {
+				b.Fatal(err)
+			}
+			defer conn.Close()
+			reader := NewV030MsgPipe(conn)
+			reader.EnableCompression()
+
+			b.SetBytes(int64(len(payload)))
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				actual, err := reader.ReadMsg()
+				if err != nil {
+					b.Fatal("err while reading on lap", i, err.Error())
+				}
+				reader.ReleasePayload(actual)
+			}
+		})
+	}
+}
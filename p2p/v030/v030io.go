@@ -7,9 +7,11 @@ package v030
 
 import (
 	"bufio"
+	"bytes"
 	"encoding/binary"
 	"fmt"
 	"io"
+	"net"
 
 	"github.com/aergoio/aergo/p2p/p2pcommon"
 )
@@ -21,7 +23,16 @@ type V030ReadWriter struct {
 	readBuf  [msgHeaderLength]byte
 	w        *bufio.Writer
 	writeBuf [msgHeaderLength]byte
-	c        io.Closer
+	// raw is underlying writer of w. big payload is written to it directly with header in single vectored write.
+	// it is nil if the writer is given as bufio.Writer.
+	raw io.Writer
+	c   io.Closer
+
+	// compress is set if remote peer can read compressed payload.
+	// only big payloads of p2pcommon.CompressibleProtocols are compressed.
+	compress bool
+	// batching is set between BeginBatch and EndBatch, and written messages are not flushed during it.
+	batching bool
 
 	ls []p2pcommon.MsgIOListener
 }
@@ -34,14 +45,17 @@ func NewV030ReadWriter(r io.Reader, w io.Writer, c io.Closer) *V030ReadWriter {
 	if !ok {
 		br = bufio.NewReader(r)
 	}
+	var raw io.Writer
 	bw, ok := w.(*bufio.Writer)
 	if !ok {
 		bw = bufio.NewWriter(w)
+		raw = w
 	}
 	return &V030ReadWriter{
-		r: br,
-		w: bw,
-		c: c,
+		r:   br,
+		w:   bw,
+		raw: raw,
+		c:   c,
 	}
 }
 
@@ -53,31 +67,46 @@ func (rw *V030ReadWriter) AddIOListener(l p2pcommon.MsgIOListener) {
 	rw.ls = append(rw.ls, l)
 }
 
-// ReadMsg() must be used in single thread
+// EnableCompression makes rw compress big payloads of compressible protocols. It must be called only if remote peer
+// has capability p2pcommon.CapCompressMsg, and before any message other than handshake is written.
+func (rw *V030ReadWriter) EnableCompression() {
+	rw.compress = true
+}
+
+// ReadMsg() must be used in single thread. The payload of returned message is taken from buffer pool,
+// and it can be given back by ReleasePayload after the message is handled.
 func (rw *V030ReadWriter) ReadMsg() (p2pcommon.Message, error) {
 	readN := 0
 	// fill data
-	read, err := rw.readToLen(rw.readBuf[:], msgHeaderLength)
+	read, err := io.ReadFull(rw.r, rw.readBuf[:])
 	if err != nil {
 		return nil, err
 	}
 	readN += read
-	if read != msgHeaderLength {
-		return nil, fmt.Errorf("invalid msgHeader")
-	}
 
-	msg, bodyLen := parseHeader(rw.readBuf)
+	msg, bodyLen, compressed := parseHeader(&rw.readBuf)
 	if bodyLen > p2pcommon.MaxPayloadLength {
 		return nil, fmt.Errorf("too big payload")
 	}
-	payload := make([]byte, bodyLen)
-	read, err = rw.readToLen(payload, int(bodyLen))
+	payload := getPayloadBuf(int(bodyLen))
+	read, err = io.ReadFull(rw.r, payload)
 	if err != nil {
+		putPayloadBuf(payload)
 		return nil, fmt.Errorf("failed to read paylod of msg %s %s : %s", msg.Subprotocol().String(), msg.ID(), err.Error())
 	}
 	readN += read
-	if read != int(bodyLen) {
-		return nil, fmt.Errorf("failed to read paylod of msg %s %s : payload length mismatch", msg.Subprotocol().String(), msg.ID())
+	if compressed {
+		// remote peer must not send compressed payload unless it is negotiated
+		if !rw.compress {
+			putPayloadBuf(payload)
+			return nil, fmt.Errorf("not negotiated compressed payload of msg %s %s", msg.Subprotocol().String(), msg.ID())
+		}
+		inflated, err := decompressPayload(payload)
+		putPayloadBuf(payload)
+		if err != nil {
+			return nil, fmt.Errorf("failed to decompress paylod of msg %s %s : %s", msg.Subprotocol().String(), msg.ID(), err.Error())
+		}
+		payload = inflated
 	}
 
 	msg.SetPayload(payload)
@@ -87,18 +116,15 @@ func (rw *V030ReadWriter) ReadMsg() (p2pcommon.Message, error) {
 	return msg, nil
 }
 
-func (rw *V030ReadWriter) readToLen(bf []byte, max int) (int, error) {
-	remain := max
-	offset := 0
-	for remain > 0 {
-		read, err := rw.r.Read(bf[offset:])
-		if err != nil {
-			return offset, err
-		}
-		remain -= read
-		offset += read
+// ReleasePayload gives back the payload buffer of msg, which was read by ReadMsg, to buffer pool.
+// Neither msg nor its payload must be used after release.
+func (rw *V030ReadWriter) ReleasePayload(msg p2pcommon.Message) {
+	mv, ok := msg.(*p2pcommon.MessageValue)
+	if !ok {
+		return
 	}
-	return offset, nil
+	putPayloadBuf(mv.Payload())
+	mv.SetPayload(nil)
 }
 
 // WriteMsg() must be used in single thread
@@ -111,41 +137,96 @@ func (rw *V030ReadWriter) WriteMsg(msg p2pcommon.Message) error {
 		return fmt.Errorf("too big payload")
 	}
 
-	rw.marshalHeader(msg)
-	written, err := rw.w.Write(rw.writeBuf[:])
-	if err != nil {
-		return err
+	payload := msg.Payload()
+	compressed := false
+	if rw.compress && len(payload) >= minCompressLength && p2pcommon.CompressibleProtocols[msg.Subprotocol()] {
+		cbuf := compressBufPool.Get().(*bytes.Buffer)
+		defer compressBufPool.Put(cbuf)
+		if compressed = compressPayload(cbuf, payload); compressed {
+			payload = cbuf.Bytes()
+		}
 	}
-	writeN += written
-	if written != msgHeaderLength {
-		return fmt.Errorf("header is not written")
+	rw.marshalHeader(msg, uint32(len(payload)), compressed)
+	var err error
+	if rw.raw != nil && len(payload) > rw.w.Available() {
+		writeN, err = rw.writeVectored(payload)
+	} else {
+		writeN, err = rw.writeBuffered(payload)
 	}
-	written, err = rw.w.Write(msg.Payload())
 	if err != nil {
 		return err
 	}
-	writeN += written
-	if written != int(msg.Length()) {
+	if writeN != msgHeaderLength+len(payload) {
 		return fmt.Errorf("wrong write")
 	}
 	for _, l := range rw.ls {
 		l.OnWrite(msg.Subprotocol(), writeN)
 	}
+	return nil
+}
+
+// BeginBatch makes following messages not flushed until EndBatch is called. It must be called in write goroutine.
+func (rw *V030ReadWriter) BeginBatch() {
+	rw.batching = true
+}
+
+// EndBatch flushes messages written after BeginBatch.
+func (rw *V030ReadWriter) EndBatch() error {
+	rw.batching = false
 	return rw.w.Flush()
 }
 
-func parseHeader(buf [msgHeaderLength]byte) (*p2pcommon.MessageValue, uint32) {
-	subProtocol := p2pcommon.SubProtocol(binary.BigEndian.Uint32(buf[0:4]))
+// writeBuffered copies header and payload into write buffer and flush it, unless in batch.
+func (rw *V030ReadWriter) writeBuffered(payload []byte) (int, error) {
+	writeN := 0
+	written, err := rw.w.Write(rw.writeBuf[:])
+	if err != nil {
+		return writeN, err
+	}
+	writeN += written
+	written, err = rw.w.Write(payload)
+	if err != nil {
+		return writeN, err
+	}
+	writeN += written
+	if rw.batching {
+		return writeN, nil
+	}
+	return writeN, rw.w.Flush()
+}
+
+// writeVectored writes header and payload to underlying writer at once without copying payload, using writev
+// if the writer supports it.
+func (rw *V030ReadWriter) writeVectored(payload []byte) (int, error) {
+	// write buffer is always flushed after each message, but check it for safety.
+	if err := rw.w.Flush(); err != nil {
+		return 0, err
+	}
+	bufs := net.Buffers{rw.writeBuf[:], payload}
+	written, err := bufs.WriteTo(rw.raw)
+	return int(written), err
+}
+
+func parseHeader(buf *[msgHeaderLength]byte) (*p2pcommon.MessageValue, uint32, bool) {
+	rawProtocol := binary.BigEndian.Uint32(buf[0:4])
+	compressed := rawProtocol&compressedFlag != 0
+	subProtocol := p2pcommon.SubProtocol(rawProtocol &^ compressedFlag)
 	length := binary.BigEndian.Uint32(buf[4:8])
 	timestamp := int64(binary.BigEndian.Uint64(buf[8:16]))
 	msgID := p2pcommon.MustParseBytes(buf[16:32])
 	orgID := p2pcommon.MustParseBytes(buf[32:48])
-	return p2pcommon.NewLiteMessageValue(subProtocol, msgID, orgID, timestamp), length
+	return p2pcommon.NewLiteMessageValue(subProtocol, msgID, orgID, timestamp), length, compressed
 }
 
-func (rw *V030ReadWriter) marshalHeader(m p2pcommon.Message) {
-	binary.BigEndian.PutUint32(rw.writeBuf[0:4], m.Subprotocol().Uint32())
-	binary.BigEndian.PutUint32(rw.writeBuf[4:8], m.Length())
+// marshalHeader writes header of m to write buffer. length is the size of payload on wire, which differs from
+// m.Length() if the payload is compressed.
+func (rw *V030ReadWriter) marshalHeader(m p2pcommon.Message, length uint32, compressed bool) {
+	rawProtocol := m.Subprotocol().Uint32()
+	if compressed {
+		rawProtocol |= compressedFlag
+	}
+	binary.BigEndian.PutUint32(rw.writeBuf[0:4], rawProtocol)
+	binary.BigEndian.PutUint32(rw.writeBuf[4:8], length)
 	binary.BigEndian.PutUint64(rw.writeBuf[8:16], uint64(m.Timestamp()))
 
 	msgID := m.ID()
@@ -11,6 +11,7 @@ import (
 	"fmt"
 	"github.com/aergoio/aergo/internal/enc"
 	"io/ioutil"
+	"net"
 	"testing"
 	"time"
 
@@ -120,6 +121,47 @@ func Test_ReadWrite(t *testing.T) {
 	}
 }
 
+func TestV030ReadWriter_ReleasePayload(t *testing.T) {
+	var sampleID p2pcommon.MsgID
+	sampleUUID, _ := uuid.NewV4()
+	copy(sampleID[:], sampleUUID[:])
+	payload, _ := proto.Marshal(&types.NewTransactionsNotice{TxHashes: sampleTxs})
+	sample := p2pcommon.NewMessageValue(p2pcommon.NewTxNotice, sampleID, p2pcommon.EmptyID, time.Now().UnixNano(), payload)
+
+	buf := bytes.NewBuffer(nil)
+	target := NewV030ReadWriter(buf, buf, nil)
+	for i := 0; i < 3; i++ {
+		assert.Nil(t, target.WriteMsg(sample))
+	}
+	for i := 0; i < 3; i++ {
+		readMsg, err := target.ReadMsg()
+		assert.Nil(t, err)
+		assert.True(t, bytes.Equal(payload, readMsg.Payload()))
+		target.ReleasePayload(readMsg)
+		assert.Nil(t, readMsg.Payload())
+		assert.Equal(t, uint32(0), readMsg.Length())
+	}
+}
+
+func TestV030ReadWriter_Batch(t *testing.T) {
+	payload, _ := proto.Marshal(&types.NewTransactionsNotice{TxHashes: sampleTxs})
+	sample := p2pcommon.NewMessageValue(p2pcommon.NewTxNotice, p2pcommon.NewMsgID(), p2pcommon.EmptyID, time.Now().UnixNano(), payload)
+
+	buf := bytes.NewBuffer(nil)
+	target := NewV030ReadWriter(nil, buf, nil)
+	target.BeginBatch()
+	for i := 0; i < 3; i++ {
+		assert.Nil(t, target.WriteMsg(sample))
+		assert.Equal(t, 0, buf.Len())
+	}
+	assert.Nil(t, target.EndBatch())
+	assert.Equal(t, (msgHeaderLength+len(payload))*3, buf.Len())
+
+	// flushed immediately after batch
+	assert.Nil(t, target.WriteMsg(sample))
+	assert.Equal(t, (msgHeaderLength+len(payload))*4, buf.Len())
+}
+
 type ioSum struct {
 	readN int
 	writeN int
@@ -243,6 +285,60 @@ func BenchmarkV030Reader_ReadMsg(b *testing.B) {
 	}
 }
 
+func BenchmarkV030Pipe(b *testing.B) {
+	var sampleID p2pcommon.MsgID
+	sampleUUID, _ := uuid.NewV4()
+	copy(sampleID[:], sampleUUID[:])
+	timestamp := time.Now().UnixNano()
+
+	bigHashes := make([][]byte, 0, len(sampleTxs)*1000)
+	for i := 0; i < 1000; i++ {
+		bigHashes = append(bigHashes, sampleTxs...)
+	}
+	smallPayload, _ := proto.Marshal(&types.NewTransactionsNotice{TxHashes: sampleTxs})
+	bigPayload, _ := proto.Marshal(&types.NewTransactionsNotice{TxHashes: bigHashes})
+
+	benchmarks := []struct {
+		name    string
+		payload []byte
+		release bool
+	}{
+		{"BPSmall", smallPayload, false},
+		{"BPSmallRelease", smallPayload, true},
+		{"BPBig", bigPayload, false},
+		{"BPBigRelease", bigPayload, true},
+	}
+	for _, bm := range benchmarks {
+		b.Run(bm.name, func(b *testing.B) {
+			msg := p2pcommon.NewMessageValue(p2pcommon.NewTxNotice, sampleID, p2pcommon.EmptyID, timestamp, bm.payload)
+			wc, rc := net.Pipe()
+			defer wc.Close()
+			defer rc.Close()
+			writer, reader := NewV030MsgPipe(wc), NewV030MsgPipe(rc)
+			go func() {
+				for i := 0; i < b.N; i++ {
+					if err := writer.WriteMsg(msg); err != nil {
+						return
+					}
+				}
+			}()
+
+			b.SetBytes(int64(msgHeaderLength + len(bm.payload)))
+			b.ReportAllocs()
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				actual, err := reader.ReadMsg()
+				if err != nil {
+					b.Fatal("err while reading on lap", i, err.Error())
+				}
+				if bm.release {
+					reader.ReleasePayload(actual)
+				}
+			}
+		})
+	}
+}
+
 func getMarshaledV030(m *p2pcommon.MessageValue, repeat int) []byte {
 	unitbuf := &bytes.Buffer{}
 	writer := NewV030ReadWriter(nil, bufio.NewWriter(unitbuf), nil)
@@ -47,6 +47,7 @@ type V200Handshaker struct {
 	remoteCerts []*p2pcommon.AgentCertificateV1
 	remoteHash  types.BlockID
 	remoteNo    types.BlockNo
+	remoteCaps  p2pcommon.PeerCapability
 }
 
 var _ p2pcommon.VersionedHandshaker = (*V200Handshaker)(nil)
@@ -93,7 +94,7 @@ func (h *V200Handshaker) DoForOutbound(ctx context.Context) (*p2pcommon.Handshak
 	if err = h.checkRemoteStatus(remotePeerStatus); err != nil {
 		return nil, err
 	} else {
-		hsResult := &p2pcommon.HandshakeResult{Meta: h.remoteMeta, BestBlockHash: h.remoteHash, BestBlockNo: h.remoteNo, MsgRW: h.msgRW, Certificates: h.remoteCerts, Hidden: remotePeerStatus.NoExpose}
+		hsResult := &p2pcommon.HandshakeResult{Meta: h.remoteMeta, BestBlockHash: h.remoteHash, BestBlockNo: h.remoteNo, MsgRW: h.msgRW, Certificates: h.remoteCerts, Hidden: remotePeerStatus.NoExpose, Capabilities: h.remoteCaps}
 		return hsResult, nil
 	}
 }
@@ -196,6 +197,12 @@ func (h *V200Handshaker) checkRemoteStatus(remotePeerStatus *types.Status) error
 	}
 
 	h.remoteMeta = rMeta
+	// optional features are used only if both peers support it.
+	h.remoteCaps = p2pcommon.LocalCapabilities.Negotiate(p2pcommon.PeerCapability(remotePeerStatus.Capabilities))
+	// handshake messages are not compressible, so it is safe to enable compression before the end of handshake
+	if rw, ok := h.msgRW.(*v030.V030ReadWriter); ok && h.remoteCaps.Has(p2pcommon.CapCompressMsg) {
+		rw.EnableCompression()
+	}
 
 	if err = h.checkByRole(remotePeerStatus); err != nil {
 		h.sendGoAway("invalid certificate works")
@@ -235,7 +242,7 @@ func (h *V200Handshaker) DoForInbound(ctx context.Context) (*p2pcommon.Handshake
 	if err != nil {
 		return nil, err
 	}
-	hsResult := &p2pcommon.HandshakeResult{Meta: h.remoteMeta, BestBlockHash: h.remoteHash, BestBlockNo: h.remoteNo, MsgRW: h.msgRW, Certificates: h.remoteCerts, Hidden: remotePeerStatus.NoExpose}
+	hsResult := &p2pcommon.HandshakeResult{Meta: h.remoteMeta, BestBlockHash: h.remoteHash, BestBlockNo: h.remoteNo, MsgRW: h.msgRW, Certificates: h.remoteCerts, Hidden: remotePeerStatus.NoExpose, Capabilities: h.remoteCaps}
 	return hsResult, nil
 }
 
@@ -315,6 +322,7 @@ func (h *V200Handshaker) createLocalStatus(chainID *types.ChainID, bestBlock *ty
 		NoExpose:      h.selfMeta.Hidden,
 		Version:       p2pkey.NodeVersion(),
 		Genesis:       h.localGenesisHash,
+		Capabilities:  uint64(p2pcommon.LocalCapabilities),
 	}
 
 	if h.selfMeta.Role == types.PeerRole_Agent {
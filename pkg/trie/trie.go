@@ -7,7 +7,9 @@ package trie
 
 import (
 	"bytes"
+	"encoding/binary"
 	"fmt"
+	"math/bits"
 	"sync"
 
 	"github.com/aergoio/aergo-lib/db"
@@ -37,6 +39,12 @@ type Trie struct {
 	LoadCacheCounter int
 	// liveCountMux is a lock fo LoadCacheCounter
 	liveCountMux sync.RWMutex
+	// LoadNodeCacheCounter counts the nb of shared node cache reads in on update
+	LoadNodeCacheCounter int
+	// nodeCacheCountMux is a lock for LoadNodeCacheCounter
+	nodeCacheCountMux sync.RWMutex
+	// nodeCache is optional node cache shared with other tries
+	nodeCache *NodeCache
 	// counterOn is used to enable/diseable for efficiency
 	counterOn bool
 	// CacheHeightLimit is the number of tree levels we want to store in cache
@@ -65,6 +73,12 @@ func NewTrie(root []byte, hash func(data ...[]byte) []byte, store db.DB) *Trie {
 	return s
 }
 
+// SetNodeCache makes the trie look up nodes in the shared node cache before reading disk db.
+// It is useful for tries which don't use liveCache, like storage tries of contracts.
+func (s *Trie) SetNodeCache(cache *NodeCache) {
+	s.nodeCache = cache
+}
+
 // Update adds and deletes a sorted list of keys and their values to the trie
 // Adding and deleting can be simultaneous.
 // To delete, set the value to DefaultLeaf.
@@ -76,9 +90,8 @@ func (s *Trie) Update(keys, values [][]byte) ([]byte, error) {
 	s.atomicUpdate = false
 	s.LoadDbCounter = 0
 	s.LoadCacheCounter = 0
-	ch := make(chan mresult, 1)
-	s.update(s.Root, keys, values, nil, 0, s.TrieHeight, ch)
-	result := <-ch
+	s.LoadNodeCacheCounter = 0
+	result := s.update(s.Root, keys, values, nil, 0, s.TrieHeight)
 	if result.err != nil {
 		return nil, result.err
 	}
@@ -99,9 +112,8 @@ func (s *Trie) AtomicUpdate(keys, values [][]byte) ([]byte, error) {
 	s.atomicUpdate = true
 	s.LoadDbCounter = 0
 	s.LoadCacheCounter = 0
-	ch := make(chan mresult, 1)
-	s.update(s.Root, keys, values, nil, 0, s.TrieHeight, ch)
-	result := <-ch
+	s.LoadNodeCacheCounter = 0
+	result := s.update(s.Root, keys, values, nil, 0, s.TrieHeight)
 	if result.err != nil {
 		return nil, result.err
 	}
@@ -114,7 +126,7 @@ func (s *Trie) AtomicUpdate(keys, values [][]byte) ([]byte, error) {
 	return s.Root, nil
 }
 
-// mresult is used to contain the result of goroutines and is sent through a channel.
+// mresult is used to contain the result of updating a subtree.
 type mresult struct {
 	update []byte
 	// flag if a node was deleted and a shortcut node maybe has to move up the tree
@@ -126,29 +138,26 @@ type mresult struct {
 // Adding and deleting can be simultaneous.
 // To delete, set the value to DefaultLeaf.
 // It returns the root of the updated tree.
-func (s *Trie) update(root []byte, keys, values, batch [][]byte, iBatch, height int, ch chan<- (mresult)) {
+func (s *Trie) update(root []byte, keys, values, batch [][]byte, iBatch, height int) mresult {
 	if height == 0 {
 		if bytes.Equal(DefaultLeaf, values[0]) {
 			// Delete the key-value from the trie if it is being set to DefaultLeaf
 			// The value will be set to [] in batch by maybeMoveupShortcut or interiorHash
 			s.deleteOldNode(root, height, false)
-			ch <- mresult{nil, true, nil}
-		} else {
-			// create a new shortcut batch.
-			// simply storing the value will make it hard to move up the
-			// shortcut in case of sibling deletion
-			batch = make([][]byte, 31, 31)
-			node := s.leafHash(keys[0], values[0], root, batch, 0, height)
-			ch <- mresult{node, false, nil}
+			return mresult{nil, true, nil}
 		}
-		return
+		// create a new shortcut batch.
+		// simply storing the value will make it hard to move up the
+		// shortcut in case of sibling deletion
+		batch = newBatch()
+		node := s.leafHash(keys[0], values[0], root, batch, 0, height)
+		return mresult{node, false, nil}
 	}
 
 	// Load the node to update
 	batch, iBatch, lnode, rnode, isShortcut, err := s.loadChildren(root, height, iBatch, batch)
 	if err != nil {
-		ch <- mresult{nil, false, err}
-		return
+		return mresult{nil, false, err}
 	}
 	// Check if the keys are updating the shortcut node
 	if isShortcut {
@@ -164,20 +173,17 @@ func (s *Trie) update(root []byte, keys, values, batch [][]byte, iBatch, height
 		batch[2*iBatch+2] = nil
 		if len(keys) == 0 {
 			// Set true so that a potential sibling shortcut may move up.
-			ch <- mresult{nil, true, nil}
-			return
+			return mresult{nil, true, nil}
 		}
 	}
 	// Store shortcut node
 	if (len(lnode) == 0) && (len(rnode) == 0) && (len(keys) == 1) {
 		// We are adding 1 key to an empty subtree so store it as a shortcut
 		if bytes.Equal(DefaultLeaf, values[0]) {
-			ch <- mresult{nil, true, nil}
-		} else {
-			node := s.leafHash(keys[0], values[0], root, batch, iBatch, height)
-			ch <- mresult{node, false, nil}
+			return mresult{nil, true, nil}
 		}
-		return
+		node := s.leafHash(keys[0], values[0], root, batch, iBatch, height)
+		return mresult{node, false, nil}
 	}
 
 	// Split the keys array so each branch can be updated in parallel
@@ -187,79 +193,80 @@ func (s *Trie) update(root []byte, keys, values, batch [][]byte, iBatch, height
 
 	switch {
 	case len(lkeys) == 0 && len(rkeys) > 0:
-		s.updateRight(lnode, rnode, root, keys, values, batch, iBatch, height, ch)
+		return s.updateRight(lnode, rnode, root, keys, values, batch, iBatch, height)
 	case len(lkeys) > 0 && len(rkeys) == 0:
-		s.updateLeft(lnode, rnode, root, keys, values, batch, iBatch, height, ch)
+		return s.updateLeft(lnode, rnode, root, keys, values, batch, iBatch, height)
 	default:
-		s.updateParallel(lnode, rnode, root, lkeys, rkeys, lvalues, rvalues, batch, iBatch, height, ch)
+		return s.updateParallel(lnode, rnode, root, lkeys, rkeys, lvalues, rvalues, batch, iBatch, height)
 	}
 }
 
 // updateRight updates the right side of the tree
-func (s *Trie) updateRight(lnode, rnode, root []byte, keys, values, batch [][]byte, iBatch, height int, ch chan<- (mresult)) {
+func (s *Trie) updateRight(lnode, rnode, root []byte, keys, values, batch [][]byte, iBatch, height int) mresult {
 	// all the keys go in the right subtree
-	newch := make(chan mresult, 1)
-	s.update(rnode, keys, values, batch, 2*iBatch+2, height-1, newch)
-	result := <-newch
+	result := s.update(rnode, keys, values, batch, 2*iBatch+2, height-1)
 	if result.err != nil {
-		ch <- mresult{nil, false, result.err}
-		return
+		return mresult{nil, false, result.err}
 	}
 	// Move up a shortcut node if necessary.
 	if result.deleted {
-		if s.maybeMoveUpShortcut(lnode, result.update, root, batch, iBatch, height, ch) {
-			return
+		if moved, ok := s.maybeMoveUpShortcut(lnode, result.update, root, batch, iBatch, height); ok {
+			return moved
 		}
 	}
 	node := s.interiorHash(lnode, result.update, root, batch, iBatch, height)
-	ch <- mresult{node, false, nil}
+	return mresult{node, false, nil}
 }
 
 // updateLeft updates the left side of the tree
-func (s *Trie) updateLeft(lnode, rnode, root []byte, keys, values, batch [][]byte, iBatch, height int, ch chan<- (mresult)) {
+func (s *Trie) updateLeft(lnode, rnode, root []byte, keys, values, batch [][]byte, iBatch, height int) mresult {
 	// all the keys go in the left subtree
-	newch := make(chan mresult, 1)
-	s.update(lnode, keys, values, batch, 2*iBatch+1, height-1, newch)
-	result := <-newch
+	result := s.update(lnode, keys, values, batch, 2*iBatch+1, height-1)
 	if result.err != nil {
-		ch <- mresult{nil, false, result.err}
-		return
+		return mresult{nil, false, result.err}
 	}
 	// Move up a shortcut node if necessary.
 	if result.deleted {
-		if s.maybeMoveUpShortcut(result.update, rnode, root, batch, iBatch, height, ch) {
-			return
+		if moved, ok := s.maybeMoveUpShortcut(result.update, rnode, root, batch, iBatch, height); ok {
+			return moved
 		}
 	}
 	node := s.interiorHash(result.update, rnode, root, batch, iBatch, height)
-	ch <- mresult{node, false, nil}
+	return mresult{node, false, nil}
 }
 
-// updateParallel updates both sides of the trie simultaneously
-func (s *Trie) updateParallel(lnode, rnode, root []byte, lkeys, rkeys, lvalues, rvalues, batch [][]byte, iBatch, height int, ch chan<- (mresult)) {
-	lch := make(chan mresult, 1)
-	rch := make(chan mresult, 1)
-	go s.update(lnode, lkeys, lvalues, batch, 2*iBatch+1, height-1, lch)
-	go s.update(rnode, rkeys, rvalues, batch, 2*iBatch+2, height-1, rch)
-	lresult := <-lch
-	rresult := <-rch
+// updateParallel updates both sides of the trie. The left side is updated by another goroutine if the subtree is big enough
+// and an update worker is available, otherwise both sides are updated in the current goroutine.
+func (s *Trie) updateParallel(lnode, rnode, root []byte, lkeys, rkeys, lvalues, rvalues, batch [][]byte, iBatch, height int) mresult {
+	var lresult, rresult mresult
+	if len(lkeys)+len(rkeys) >= minParallelUpdateKeys && acquireUpdateWorker() {
+		done := make(chan struct{})
+		go func() {
+			lresult = s.update(lnode, lkeys, lvalues, batch, 2*iBatch+1, height-1)
+			releaseUpdateWorker()
+			close(done)
+		}()
+		rresult = s.update(rnode, rkeys, rvalues, batch, 2*iBatch+2, height-1)
+		<-done
+	} else {
+		lresult = s.update(lnode, lkeys, lvalues, batch, 2*iBatch+1, height-1)
+		rresult = s.update(rnode, rkeys, rvalues, batch, 2*iBatch+2, height-1)
+	}
 	if lresult.err != nil {
-		ch <- mresult{nil, false, lresult.err}
-		return
+		return mresult{nil, false, lresult.err}
 	}
 	if rresult.err != nil {
-		ch <- mresult{nil, false, rresult.err}
-		return
+		return mresult{nil, false, rresult.err}
 	}
 
 	// Move up a shortcut node if it's sibling is default
 	if lresult.deleted || rresult.deleted {
-		if s.maybeMoveUpShortcut(lresult.update, rresult.update, root, batch, iBatch, height, ch) {
-			return
+		if moved, ok := s.maybeMoveUpShortcut(lresult.update, rresult.update, root, batch, iBatch, height); ok {
+			return moved
 		}
 	}
 	node := s.interiorHash(lresult.update, rresult.update, root, batch, iBatch, height)
-	ch <- mresult{node, false, nil}
+	return mresult{node, false, nil}
 }
 
 // deleteOldNode deletes an old node that has been updated
@@ -290,8 +297,8 @@ func (s *Trie) splitKeys(keys [][]byte, height int) ([][]byte, [][]byte) {
 	return keys, nil
 }
 
-// maybeMoveUpShortcut moves up a shortcut if it's sibling node is default
-func (s *Trie) maybeMoveUpShortcut(left, right, root []byte, batch [][]byte, iBatch, height int, ch chan<- (mresult)) bool {
+// maybeMoveUpShortcut moves up a shortcut if it's sibling node is default. It returns false if nothing is moved up.
+func (s *Trie) maybeMoveUpShortcut(left, right, root []byte, batch [][]byte, iBatch, height int) (mresult, bool) {
 	if len(left) == 0 && len(right) == 0 {
 		// Both update and sibling are deleted subtrees
 		if iBatch == 0 {
@@ -301,30 +308,26 @@ func (s *Trie) maybeMoveUpShortcut(left, right, root []byte, batch [][]byte, iBa
 			batch[2*iBatch+1] = nil
 			batch[2*iBatch+2] = nil
 		}
-		ch <- mresult{nil, true, nil}
-		return true
+		return mresult{nil, true, nil}, true
 	} else if len(left) == 0 {
 		// If right is a shortcut move it up
 		if right[HashLength] == 1 {
-			s.moveUpShortcut(right, root, batch, iBatch, 2*iBatch+2, height, ch)
-			return true
+			return s.moveUpShortcut(right, root, batch, iBatch, 2*iBatch+2, height), true
 		}
 	} else if len(right) == 0 {
 		// If left is a shortcut move it up
 		if left[HashLength] == 1 {
-			s.moveUpShortcut(left, root, batch, iBatch, 2*iBatch+1, height, ch)
-			return true
+			return s.moveUpShortcut(left, root, batch, iBatch, 2*iBatch+1, height), true
 		}
 	}
-	return false
+	return mresult{}, false
 }
 
-func (s *Trie) moveUpShortcut(shortcut, root []byte, batch [][]byte, iBatch, iShortcut, height int, ch chan<- (mresult)) {
+func (s *Trie) moveUpShortcut(shortcut, root []byte, batch [][]byte, iBatch, iShortcut, height int) mresult {
 	// it doesn't matter if atomic update is true or false since the batch is node modified
 	_, _, shortcutKey, shortcutVal, _, err := s.loadChildren(shortcut, height-1, iShortcut, batch)
 	if err != nil {
-		ch <- mresult{nil, false, err}
-		return
+		return mresult{nil, false, err}
 	}
 	// when moving up the shortcut, it's hash will change because height is +1
 	newShortcut := s.hash(shortcutKey[:HashLength], shortcutVal[:HashLength], []byte{byte(height)})
@@ -332,7 +335,7 @@ func (s *Trie) moveUpShortcut(shortcut, root []byte, batch [][]byte, iBatch, iSh
 
 	if iBatch == 0 {
 		// Modify batch to a shortcut batch
-		batch[0] = []byte{1}
+		batch[0] = shortcutBatchFlag
 		batch[2*iBatch+1] = shortcutKey
 		batch[2*iBatch+2] = shortcutVal
 		batch[2*iShortcut+1] = nil
@@ -354,7 +357,7 @@ func (s *Trie) moveUpShortcut(shortcut, root []byte, batch [][]byte, iBatch, iSh
 		batch[2*iShortcut+2] = nil
 	}
 	// Return the left sibling node to move it up
-	ch <- mresult{newShortcut, true, nil}
+	return mresult{newShortcut, true, nil}
 }
 
 // maybeAddShortcutToKV adds a shortcut key to the keys array to be updated.
@@ -413,8 +416,8 @@ func (s *Trie) loadChildren(root []byte, height, iBatch int, batch [][]byte) ([]
 	if height%4 == 0 {
 		if len(root) == 0 {
 			// create a new default batch
-			batch = make([][]byte, 31, 31)
-			batch[0] = []byte{0}
+			batch = newBatch()
+			batch[0] = defaultBatchFlag
 		} else {
 			var err error
 			batch, err = s.loadBatch(root)
@@ -436,6 +439,16 @@ func (s *Trie) loadChildren(root []byte, height, iBatch int, batch [][]byte) ([]
 
 // loadBatch fetches a batch of nodes in cache or db
 func (s *Trie) loadBatch(root []byte) ([][]byte, error) {
+	batch, val, err := s.loadBatchOrBytes(root)
+	if err != nil || batch != nil {
+		return batch, err
+	}
+	return s.parseBatch(val), nil
+}
+
+// loadBatchOrBytes fetches a batch of nodes in cache, or a serialized batch in node cache or db
+// which is not decoded yet.
+func (s *Trie) loadBatchOrBytes(root []byte) ([][]byte, []byte, error) {
 	var node Hash
 	copy(node[:], root)
 
@@ -451,12 +464,12 @@ func (s *Trie) loadBatch(root []byte) ([][]byte, error) {
 		if s.atomicUpdate {
 			// Return a copy so that Commit() doesnt have to be called at
 			// each block and still commit every state transition.
-			// Before Commit, the same batch is in liveCache and in updatedNodes
-			newVal := make([][]byte, 31, 31)
+			// Before Commit, the same nodes are in liveCache and in updatedNodes
+			newVal := newBatch()
 			copy(newVal, val)
-			return newVal, nil
+			return newVal, nil, nil
 		}
-		return val, nil
+		return val, nil, nil
 	}
 	// checking updated nodes is useful if get() or update() is called twice in a row without db commit
 	s.db.updatedMux.RLock()
@@ -466,15 +479,26 @@ func (s *Trie) loadBatch(root []byte) ([][]byte, error) {
 		if s.atomicUpdate {
 			// Return a copy so that Commit() doesnt have to be called at
 			// each block and still commit every state transition.
-			newVal := make([][]byte, 31, 31)
+			newVal := newBatch()
 			copy(newVal, val)
-			return newVal, nil
+			return newVal, nil, nil
+		}
+		return val, nil, nil
+	}
+	// batch parsed later refers the bytes in shared cache, but they are safe since node bytes are never modified in place
+	if s.nodeCache != nil {
+		if cached, exists := s.nodeCache.get(node); exists {
+			if s.counterOn {
+				s.nodeCacheCountMux.Lock()
+				s.LoadNodeCacheCounter++
+				s.nodeCacheCountMux.Unlock()
+			}
+			return nil, cached, nil
 		}
-		return val, nil
 	}
 	//Fetch node in disk database
 	if s.db.Store == nil {
-		return nil, fmt.Errorf("DB not connected to trie")
+		return nil, nil, fmt.Errorf("DB not connected to trie")
 	}
 	if s.counterOn {
 		s.loadDbMux.Lock()
@@ -486,22 +510,25 @@ func (s *Trie) loadBatch(root []byte) ([][]byte, error) {
 	s.db.lock.Unlock()
 	nodeSize := len(dbval)
 	if nodeSize != 0 {
-		return s.parseBatch(dbval), nil
+		if s.nodeCache != nil {
+			s.nodeCache.add(node, dbval)
+		}
+		return nil, dbval, nil
 	}
-	return nil, fmt.Errorf("the trie node %x is unavailable in the disk db, db may be corrupted", root)
+	return nil, nil, fmt.Errorf("the trie node %x is unavailable in the disk db, db may be corrupted", root)
 }
 
 // parseBatch decodes the byte data into a slice of nodes and bitmap
 func (s *Trie) parseBatch(val []byte) [][]byte {
-	batch := make([][]byte, 31, 31)
+	batch := newBatch()
 	bitmap := val[:4]
 	// check if the batch root is a shortcut
 	if bitIsSet(val, 31) {
-		batch[0] = []byte{1}
+		batch[0] = shortcutBatchFlag
 		batch[1] = val[4 : 4+33]
 		batch[2] = val[4+33 : 4+33*2]
 	} else {
-		batch[0] = []byte{0}
+		batch[0] = defaultBatchFlag
 		j := 0
 		for i := 1; i <= 30; i++ {
 			if bitIsSet(bitmap, i-1) {
@@ -513,6 +540,20 @@ func (s *Trie) parseBatch(val []byte) [][]byte {
 	return batch
 }
 
+// batchNode returns the i-th node of a serialized batch without decoding the whole batch.
+// The position of the node is the number of nodes before it in the bitmap.
+func batchNode(val []byte, i int) []byte {
+	if i < 1 || i > 30 || !bitIsSet(val, i-1) {
+		return nil
+	}
+	bitmap := binary.BigEndian.Uint32(val[:4])
+	offset := 4 + (HashLength+1)*bits.OnesCount32(bitmap>>uint(32-(i-1)))
+	if offset+HashLength+1 > len(val) {
+		return nil
+	}
+	return val[offset : offset+HashLength+1]
+}
+
 // leafHash returns the hash of key_value_byte(height) concatenated, stores it in the updatedNodes and maybe in liveCache.
 // leafHash is never called for a default value. Default value should not be stored.
 func (s *Trie) leafHash(key, value, oldRoot []byte, batch [][]byte, iBatch, height int) []byte {
@@ -528,7 +569,7 @@ func (s *Trie) leafHash(key, value, oldRoot []byte, batch [][]byte, iBatch, heig
 	batch[2*iBatch+2] = append(value, byte(2))
 	batch[2*iBatch+1] = append(key, byte(2))
 	if height%4 == 0 {
-		batch[0] = []byte{1} // byte(1) is a flag for the shortcut batch
+		batch[0] = shortcutBatchFlag // byte(1) is a flag for the shortcut batch
 		s.storeNode(batch, h, oldRoot, height)
 	}
 	return h
@@ -546,7 +587,7 @@ func (s *Trie) storeNode(batch [][]byte, h, oldRoot []byte, height int) {
 		// Cache the shortcut node if it's height is over CacheHeightLimit
 		if height >= s.CacheHeightLimit {
 			s.db.liveMux.Lock()
-			s.db.liveCache[node] = batch
+			s.db.liveCache[node] = ownBatch(batch)
 			s.db.liveMux.Unlock()
 		}
 		s.deleteOldNode(oldRoot, height, false)
@@ -568,7 +609,7 @@ func (s *Trie) interiorHash(left, right, oldRoot []byte, batch [][]byte, iBatch,
 	batch[2*iBatch+2] = right
 	batch[2*iBatch+1] = left
 	if height%4 == 0 {
-		batch[0] = []byte{0}
+		batch[0] = defaultBatchFlag
 		s.storeNode(batch, h, oldRoot, height)
 	}
 	return h
@@ -36,28 +36,65 @@ type CacheDB struct {
 	Store db.DB
 }
 
+// defaultBatchFlag and shortcutBatchFlag are the first item of a batch, which tells if the batch root is a shortcut.
+// They are shared by all batches and must not be modified.
+var (
+	defaultBatchFlag  = []byte{0}
+	shortcutBatchFlag = []byte{1}
+)
+
 // commit adds updatedNodes to the given database transaction.
+// Keys and serialized batches are carved from a single buffer, since the transaction holds all of them until it is written.
 func (c *CacheDB) commit(txn *DbTx) {
 	c.updatedMux.Lock()
 	defer c.updatedMux.Unlock()
+	size := 0
+	for _, batch := range c.updatedNodes {
+		size += HashLength + serializedBatchSize(batch)
+	}
+	buf := make([]byte, 0, size)
 	for key, batch := range c.updatedNodes {
-		var node []byte
-		(*txn).Set(append(node, key[:]...), c.serializeBatch(batch))
+		start := len(buf)
+		buf = append(buf, key[:]...)
+		node := buf[start:len(buf):len(buf)]
+		start = len(buf)
+		buf = appendBatch(buf, batch)
+		(*txn).Set(node, buf[start:len(buf):len(buf)])
 	}
 }
 
 // serializeBatch serialises the 2D [][]byte into a []byte for db
 func (c *CacheDB) serializeBatch(batch [][]byte) []byte {
-	serialized := make([]byte, 4) //, 30*33)
+	return appendBatch(make([]byte, 0, serializedBatchSize(batch)), batch)
+}
+
+// serializedBatchSize returns the length of serialized batch: 4 bytes of bitmap and non default nodes
+func serializedBatchSize(batch [][]byte) int {
+	size := 4
+	for i := 1; i < 31; i++ {
+		size += len(batch[i])
+	}
+	return size
+}
+
+// appendBatch appends the serialized batch to buf. The bitmap has a bit for each non default node,
+// and the last bit of it is set if the batch root is a shortcut.
+func appendBatch(buf []byte, batch [][]byte) []byte {
+	var bitmap [4]byte
 	if batch[0][0] == 1 {
 		// the batch node is a shortcut
-		bitSet(serialized, 31)
+		bitSet(bitmap[:], 31)
+	}
+	for i := 1; i < 31; i++ {
+		if len(batch[i]) != 0 {
+			bitSet(bitmap[:], i-1)
+		}
 	}
+	buf = append(buf, bitmap[:]...)
 	for i := 1; i < 31; i++ {
 		if len(batch[i]) != 0 {
-			bitSet(serialized, i-1)
-			serialized = append(serialized, batch[i]...)
+			buf = append(buf, batch[i]...)
 		}
 	}
-	return serialized
+	return buf
 }
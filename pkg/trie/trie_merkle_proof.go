@@ -208,3 +208,211 @@ func (s *Trie) VerifyNonInclusionC(ap [][]byte, length int, bitmap, key, value,
 	// return true because we verified another leaf is on the key path
 	return true
 }
+
+// MultiProof is a merkle proof of several keys in a single audit path. Sibling nodes are
+// only included once for the common path of keys, and not at all where the paths of keys split.
+type MultiProof struct {
+	// Bitmap has a bit for each sibling node in depth first order, which is set if the sibling is not default
+	Bitmap []byte
+	// AuditPath is the non default sibling nodes in depth first order
+	AuditPath [][]byte
+	// Leaves are the proofs of each key at the end of its path, in the same order as keys
+	Leaves []MultiProofLeaf
+
+	siblings int
+}
+
+// MultiProofLeaf is the end of the path of a key in a MultiProof.
+// (ProofKey, ProofVal) can be 1- (nil, value), value of the included key, 2- the kv of a LeafNode
+// on the path of the non-included key, 3- (nil, nil) for a non-included key
+// with a DefaultLeaf on the path
+type MultiProofLeaf struct {
+	// Height is the depth of the leaf node, which is the length of the audit path of the key
+	Height   int
+	Included bool
+	ProofKey []byte
+	ProofVal []byte
+}
+
+func (mp *MultiProof) addSibling(node []byte) {
+	if mp.siblings/8 == len(mp.Bitmap) {
+		mp.Bitmap = append(mp.Bitmap, 0)
+	}
+	if len(node) != 0 {
+		bitSet(mp.Bitmap, mp.siblings)
+		mp.AuditPath = append(mp.AuditPath, node[:HashLength])
+	}
+	mp.siblings++
+}
+
+// MerkleMultiProof generates a Merkle proof of inclusion or non-inclusion
+// of sorted keys for the current trie root
+func (s *Trie) MerkleMultiProof(keys [][]byte) (*MultiProof, error) {
+	return s.MerkleMultiProofR(keys, s.Root)
+}
+
+// MerkleMultiProofR generates a Merkle proof of inclusion or non-inclusion
+// of sorted keys for a given trie root
+func (s *Trie) MerkleMultiProofR(keys [][]byte, root []byte) (*MultiProof, error) {
+	s.lock.RLock()
+	defer s.lock.RUnlock()
+	s.atomicUpdate = false // so loadChildren doesnt return a copy
+	mp := &MultiProof{Leaves: make([]MultiProofLeaf, len(keys))}
+	if err := s.merkleMultiProof(root, keys, mp.Leaves, nil, s.TrieHeight, 0, mp); err != nil {
+		return nil, err
+	}
+	return mp, nil
+}
+
+// merkleMultiProof walks the paths of keys together, and splits them where they diverge.
+func (s *Trie) merkleMultiProof(root []byte, keys [][]byte, leaves []MultiProofLeaf, batch [][]byte, height, iBatch int, mp *MultiProof) error {
+	depth := s.TrieHeight - height
+	if len(root) == 0 {
+		// proove that an empty subtree is on the path of the keys
+		for i := range keys {
+			leaves[i] = MultiProofLeaf{Height: depth}
+		}
+		return nil
+	}
+	// Fetch the children of the node
+	batch, iBatch, lnode, rnode, isShortcut, err := s.loadChildren(root, height, iBatch, batch)
+	if err != nil {
+		return err
+	}
+	if isShortcut || height == 0 {
+		for i, key := range keys {
+			if bytes.Equal(lnode[:HashLength], key) {
+				leaves[i] = MultiProofLeaf{Height: depth, Included: true, ProofVal: rnode[:HashLength]}
+			} else {
+				leaves[i] = MultiProofLeaf{Height: depth, ProofKey: lnode[:HashLength], ProofVal: rnode[:HashLength]}
+			}
+		}
+		return nil
+	}
+
+	lkeys, rkeys := s.splitKeys(keys, depth)
+	switch {
+	case len(rkeys) == 0:
+		mp.addSibling(rnode)
+		return s.merkleMultiProof(lnode, keys, leaves, batch, height-1, 2*iBatch+1, mp)
+	case len(lkeys) == 0:
+		mp.addSibling(lnode)
+		return s.merkleMultiProof(rnode, keys, leaves, batch, height-1, 2*iBatch+2, mp)
+	default:
+		if err := s.merkleMultiProof(lnode, lkeys, leaves[:len(lkeys)], batch, height-1, 2*iBatch+1, mp); err != nil {
+			return err
+		}
+		return s.merkleMultiProof(rnode, rkeys, leaves[len(lkeys):], batch, height-1, 2*iBatch+2, mp)
+	}
+}
+
+// VerifyMultiProof verifies inclusion or non-inclusion of sorted keys in the trie with latest root.
+// The value of an included key is the ProofVal of its leaf.
+func (s *Trie) VerifyMultiProof(mp *MultiProof, keys [][]byte) bool {
+	if mp == nil || len(keys) == 0 || len(keys) != len(mp.Leaves) {
+		return false
+	}
+	for i := 1; i < len(keys); i++ {
+		if bytes.Compare(keys[i-1], keys[i]) >= 0 {
+			return false
+		}
+	}
+	return s.verifyMultiProofRoot(mp, keys, nil)
+}
+
+// verifyMultiProofRoot checks the multi proof of sorted keys hashes to the latest root. Non default siblings must
+// be out of bounds if bounds is not nil.
+func (s *Trie) verifyMultiProofRoot(mp *MultiProof, keys [][]byte, bounds *rangeBounds) bool {
+	var siblings, apIndex int
+	root, ok := s.verifyMultiProof(mp, keys, mp.Leaves, 0, &siblings, &apIndex, bounds)
+	return ok && apIndex == len(mp.AuditPath) && bytes.Equal(s.Root, root)
+}
+
+// verifyMultiProof returns the merkle root of the subtree of keys by hashing the multi proof items
+func (s *Trie) verifyMultiProof(mp *MultiProof, keys [][]byte, leaves []MultiProofLeaf, depth int, siblings, apIndex *int, bounds *rangeBounds) ([]byte, bool) {
+	if leaves[0].Height == depth {
+		return s.verifyMultiProofLeaf(keys, leaves, depth)
+	}
+	if depth >= s.TrieHeight {
+		return nil, false
+	}
+	for _, leaf := range leaves {
+		if leaf.Height <= depth {
+			// keys in a subtree must end at the same leaf node
+			return nil, false
+		}
+	}
+	lkeys, rkeys := s.splitKeys(keys, depth)
+	if len(lkeys) != 0 && len(rkeys) != 0 {
+		left, ok := s.verifyMultiProof(mp, lkeys, leaves[:len(lkeys)], depth+1, siblings, apIndex, bounds)
+		if !ok {
+			return nil, false
+		}
+		right, ok := s.verifyMultiProof(mp, rkeys, leaves[len(lkeys):], depth+1, siblings, apIndex, bounds)
+		if !ok {
+			return nil, false
+		}
+		return s.hash(left, right), true
+	}
+
+	// read the sibling before the subtree, in the order they were added
+	if *siblings/8 >= len(mp.Bitmap) {
+		return nil, false
+	}
+	sibling := DefaultLeaf
+	if bitIsSet(mp.Bitmap, *siblings) {
+		if *apIndex >= len(mp.AuditPath) {
+			return nil, false
+		}
+		if bounds != nil && !bounds.siblingOutside(keys[0], depth) {
+			return nil, false
+		}
+		sibling = mp.AuditPath[*apIndex]
+		*apIndex++
+	}
+	*siblings++
+	node, ok := s.verifyMultiProof(mp, keys, leaves, depth+1, siblings, apIndex, bounds)
+	if !ok {
+		return nil, false
+	}
+	if len(rkeys) == 0 {
+		return s.hash(node, sibling), true
+	}
+	return s.hash(sibling, node), true
+}
+
+// verifyMultiProofLeaf returns the hash of the leaf node at the end of the path of keys.
+// All the keys must be proven by the same leaf node, which is on the path of the keys.
+func (s *Trie) verifyMultiProofLeaf(keys [][]byte, leaves []MultiProofLeaf, depth int) ([]byte, bool) {
+	var leafKey, leafVal []byte
+	for i, leaf := range leaves {
+		if leaf.Height != depth {
+			return nil, false
+		}
+		key, val := leaf.ProofKey, leaf.ProofVal
+		if leaf.Included {
+			key = keys[i]
+		} else if bytes.Equal(key, keys[i]) {
+			return nil, false
+		}
+		if i == 0 {
+			leafKey, leafVal = key, val
+		} else if !bytes.Equal(leafKey, key) || !bytes.Equal(leafVal, val) {
+			return nil, false
+		}
+	}
+	if len(leafKey) == 0 {
+		// an empty subtree is on the path of keys
+		if len(leafVal) != 0 {
+			return nil, false
+		}
+		return DefaultLeaf, true
+	}
+	// Check the leaf is on the path of the keys
+	for b := 0; b < depth; b++ {
+		if bitIsSet(keys[0], b) != bitIsSet(leafKey, b) {
+			return nil, false
+		}
+	}
+	return s.hash(leafKey, leafVal, []byte{byte(s.TrieHeight - depth)}), true
+}
@@ -0,0 +1,93 @@
+/**
+ *  @file
+ *  @copyright defined in aergo/LICENSE.txt
+ */
+
+package trie
+
+import (
+	"sync"
+	"sync/atomic"
+
+	"github.com/hashicorp/golang-lru/simplelru"
+)
+
+// minNodeSize is the size of the smallest serialized batch node, a bitmap and a shortcut node
+const minNodeSize = 4 + 2*(HashLength+1)
+
+// NodeCache is a memory bounded LRU cache of serialized batch nodes loaded from disk db.
+// The nodes are keyed by their hash, so a NodeCache can be shared by tries of different roots,
+// such as storage tries of contracts.
+type NodeCache struct {
+	lock     sync.Mutex
+	lru      *simplelru.LRU
+	maxBytes int
+	bytes    int
+
+	hits   uint64
+	misses uint64
+}
+
+// NewNodeCache creates a NodeCache which holds nodes at most maxBytes in total.
+func NewNodeCache(maxBytes int) *NodeCache {
+	c := &NodeCache{maxBytes: maxBytes}
+	// the real bound is maxBytes, which is checked at add
+	c.lru, _ = simplelru.NewLRU(maxBytes/minNodeSize+1, func(key interface{}, value interface{}) {
+		c.bytes -= len(value.([]byte))
+	})
+	return c
+}
+
+// get returns the serialized node. The returned slice must not be modified.
+func (c *NodeCache) get(node Hash) ([]byte, bool) {
+	c.lock.Lock()
+	val, exists := c.lru.Get(node)
+	c.lock.Unlock()
+	if !exists {
+		atomic.AddUint64(&c.misses, 1)
+		return nil, false
+	}
+	atomic.AddUint64(&c.hits, 1)
+	return val.([]byte), true
+}
+
+// add stores the serialized node. The node must not be modified after added.
+func (c *NodeCache) add(node Hash, val []byte) {
+	if len(val) > c.maxBytes {
+		return
+	}
+	c.lock.Lock()
+	defer c.lock.Unlock()
+	if c.lru.Contains(node) {
+		return
+	}
+	c.lru.Add(node, val)
+	c.bytes += len(val)
+	for c.bytes > c.maxBytes {
+		c.lru.RemoveOldest()
+	}
+}
+
+// Hits returns the number of lookups which found the node in cache.
+func (c *NodeCache) Hits() uint64 {
+	return atomic.LoadUint64(&c.hits)
+}
+
+// Misses returns the number of lookups which had to read the node from disk db.
+func (c *NodeCache) Misses() uint64 {
+	return atomic.LoadUint64(&c.misses)
+}
+
+// Len returns the number of cached nodes.
+func (c *NodeCache) Len() int {
+	c.lock.Lock()
+	defer c.lock.Unlock()
+	return c.lru.Len()
+}
+
+// Bytes returns the total size of cached nodes.
+func (c *NodeCache) Bytes() int {
+	c.lock.Lock()
+	defer c.lock.Unlock()
+	return c.bytes
+}
@@ -0,0 +1,97 @@
+/**
+ *  @file
+ *  @copyright defined in aergo/LICENSE.txt
+ */
+
+package trie
+
+import (
+	"bytes"
+	"os"
+	"path"
+	"testing"
+
+	"github.com/aergoio/aergo-lib/db"
+	"github.com/aergoio/aergo/internal/common"
+)
+
+func TestTrieNodeCache(t *testing.T) {
+	dbPath := path.Join(".aergo", "db")
+	if _, err := os.Stat(dbPath); os.IsNotExist(err) {
+		_ = os.MkdirAll(dbPath, 0711)
+	}
+	st := db.NewDB(db.BadgerImpl, dbPath)
+
+	smt := NewTrie(nil, common.Hasher, st)
+	keys := getFreshData(100, 32)
+	values := getFreshData(100, 32)
+	smt.Update(keys, values)
+	smt.Commit()
+
+	cache := NewNodeCache(1 << 20)
+	// first trie reads nodes from db and fills cache
+	smt1 := NewTrie(smt.Root, common.Hasher, st)
+	smt1.SetNodeCache(cache)
+	for i, key := range keys {
+		value, _ := smt1.Get(key)
+		if !bytes.Equal(value, values[i]) {
+			t.Fatal("failed to get value with node cache")
+		}
+	}
+	if cache.Hits() == 0 || cache.Misses() == 0 || cache.Len() == 0 {
+		t.Fatal("node cache is not filled", cache.Hits(), cache.Misses(), cache.Len())
+	}
+
+	// other trie of same root shares the cached nodes, and doesn't read db.
+	misses := cache.Misses()
+	smt2 := NewTrie(smt.Root, common.Hasher, nil)
+	smt2.SetNodeCache(cache)
+	for i, key := range keys {
+		value, err := smt2.Get(key)
+		if err != nil || !bytes.Equal(value, values[i]) {
+			t.Fatal("failed to get value from shared node cache", err)
+		}
+	}
+	if cache.Misses() != misses {
+		t.Fatal("nodes should be found in cache")
+	}
+
+	// updating a trie doesn't change the cached nodes of other tries
+	newValues := getFreshData(100, 32)
+	smt2.Update(keys, newValues)
+	for i, key := range keys {
+		value, _ := smt1.Get(key)
+		if !bytes.Equal(value, values[i]) {
+			t.Fatal("cached node is modified by other trie")
+		}
+	}
+	st.Close()
+	os.RemoveAll(".aergo")
+}
+
+func TestNodeCacheBound(t *testing.T) {
+	maxBytes := 10 * minNodeSize
+	cache := NewNodeCache(maxBytes)
+	for i := 0; i < 100; i++ {
+		var node Hash
+		node[0] = byte(i)
+		cache.add(node, make([]byte, minNodeSize+i%3))
+		if cache.Bytes() > maxBytes {
+			t.Fatal("node cache exceeds size limit", cache.Bytes())
+		}
+	}
+	// the oldest node is evicted
+	if _, exists := cache.get(Hash{}); exists {
+		t.Fatal("the oldest node should be evicted")
+	}
+	var latest Hash
+	latest[0] = 99
+	if _, exists := cache.get(latest); !exists {
+		t.Fatal("the latest node should be cached")
+	}
+	// too big node is not cached
+	cache.add(Hash{1, 1}, make([]byte, maxBytes+1))
+	if _, exists := cache.get(Hash{1, 1}); exists {
+		t.Fatal("too big node should not be cached")
+	}
+}
@@ -0,0 +1,209 @@
+/**
+ *  @file
+ *  @copyright defined in aergo/LICENSE.txt
+ */
+
+package trie
+
+import (
+	"bytes"
+	"fmt"
+	"sort"
+)
+
+// rangeReader collects leaves in a key range
+type rangeReader struct {
+	start, end []byte
+	limit      int
+	keys       [][]byte
+	values     [][]byte
+}
+
+// GetRange returns up to limit leaves of the trie at root whose keys are in [start, end), in key order.
+// next is the key of the first leaf after them in the range, or nil if no leaf is left.
+// nil start or end means the range is not bounded on that side.
+// It is used to read a trie by chunks, like to transfer it to another node.
+func (s *Trie) GetRange(root, start, end []byte, limit int) (keys, values [][]byte, next []byte, err error) {
+	s.lock.RLock()
+	defer s.lock.RUnlock()
+
+	r := &rangeReader{start: start, end: end, limit: limit + 1}
+	if err := s.getRange(root, nil, 0, s.TrieHeight, len(start) != 0, len(end) != 0, r); err != nil {
+		return nil, nil, nil, err
+	}
+	if len(r.keys) > limit {
+		return r.keys[:limit], r.values[:limit], r.keys[limit], nil
+	}
+	return r.keys, r.values, nil, nil
+}
+
+// getRange walks the subtree at root in key order. lowBound and highBound are true if the path to root is the same
+// as the prefix of start or end, so the subtree may have keys out of range.
+func (s *Trie) getRange(root []byte, batch [][]byte, iBatch, height int, lowBound, highBound bool, r *rangeReader) error {
+	if len(root) == 0 || len(r.keys) >= r.limit {
+		return nil
+	}
+	batch, iBatch, lnode, rnode, isShortcut, err := s.loadChildren(root, height, iBatch, batch)
+	if err != nil {
+		return err
+	}
+	if isShortcut {
+		key := lnode[:HashLength]
+		if (len(r.start) == 0 || bytes.Compare(key, r.start) >= 0) && (len(r.end) == 0 || bytes.Compare(key, r.end) < 0) {
+			r.keys = append(r.keys, append([]byte(nil), key...))
+			r.values = append(r.values, append([]byte(nil), rnode[:HashLength]...))
+		}
+		return nil
+	}
+	if height == 0 {
+		return nil
+	}
+
+	bit := s.TrieHeight - height
+	// the left subtree is skipped if start is in the right one, and the right subtree if end is in the left one
+	if !lowBound || !boundBitIsSet(r.start, bit) {
+		if err := s.getRange(lnode, batch, 2*iBatch+1, height-1, lowBound, highBound && !boundBitIsSet(r.end, bit), r); err != nil {
+			return err
+		}
+	}
+	if !highBound || boundBitIsSet(r.end, bit) {
+		if err := s.getRange(rnode, batch, 2*iBatch+2, height-1, lowBound && boundBitIsSet(r.start, bit), highBound, r); err != nil {
+			return err
+		}
+	}
+	return nil
+}
+
+// boundBitIsSet is bitIsSet for range bounds, which may be shorter than keys. missing bits are 0.
+func boundBitIsSet(bound []byte, i int) bool {
+	return i/8 < len(bound) && bitIsSet(bound, i)
+}
+
+// MerkleRangeProof generates a multi proof that keys are all the leaves of the trie at root in [start, end), so a
+// chunk read by GetRange can be verified on its own. end is the next key returned by GetRange if the range is read
+// partially. The values of keys are left out of the proof, since they are sent with keys.
+func (s *Trie) MerkleRangeProof(root, start, end []byte, keys [][]byte) (*MultiProof, error) {
+	if len(start) > HashLength || len(end) > HashLength {
+		return nil, fmt.Errorf("range bound is longer than key")
+	}
+	proofKeys := rangeProofKeys(rangeBound(start), rangeBound(end), keys)
+	mp, err := s.MerkleMultiProofR(proofKeys, root)
+	if err != nil {
+		return nil, err
+	}
+	j := 0
+	for i, key := range proofKeys {
+		if j < len(keys) && bytes.Equal(key, keys[j]) {
+			if mp.Leaves[i].Included {
+				mp.Leaves[i].ProofVal = nil
+			}
+			j++
+		}
+	}
+	return mp, nil
+}
+
+// VerifyRangeProof verifies that sorted keys with values are all the leaves in [start, end) of the trie with
+// latest root. A non default sibling on the paths of the bounds and keys must be out of the range, since its
+// leaves are not proven.
+func (s *Trie) VerifyRangeProof(mp *MultiProof, start, end []byte, keys, values [][]byte) bool {
+	if len(keys) != len(values) || len(start) > HashLength || len(end) > HashLength {
+		return false
+	}
+	if len(s.Root) == 0 {
+		return len(keys) == 0
+	}
+	bounds := &rangeBounds{lo: rangeBound(start), hi: rangeBound(end)}
+	proofKeys := rangeProofKeys(bounds.lo, bounds.hi, keys)
+	if mp == nil || len(proofKeys) == 0 || len(proofKeys) != len(mp.Leaves) {
+		return false
+	}
+	for i, key := range proofKeys {
+		if len(key) != HashLength || i > 0 && bytes.Compare(proofKeys[i-1], key) >= 0 {
+			return false
+		}
+	}
+
+	// keys must be included with the given values, and the other leaves found must be out of the range
+	isKey := func(key []byte) bool {
+		i := sort.Search(len(keys), func(i int) bool { return bytes.Compare(keys[i], key) >= 0 })
+		return i < len(keys) && bytes.Equal(keys[i], key)
+	}
+	proof := *mp
+	proof.Leaves = append([]MultiProofLeaf(nil), mp.Leaves...)
+	j := 0
+	for i, key := range proofKeys {
+		leaf := &proof.Leaves[i]
+		if j < len(keys) && bytes.Equal(key, keys[j]) {
+			if !leaf.Included || len(leaf.ProofVal) != 0 && !bytes.Equal(leaf.ProofVal, values[j]) {
+				return false
+			}
+			leaf.ProofVal = values[j]
+			j++
+			continue
+		}
+		if leaf.Included && bounds.contains(key) ||
+			!leaf.Included && len(leaf.ProofKey) != 0 && bounds.contains(leaf.ProofKey) && !isKey(leaf.ProofKey) {
+			return false
+		}
+	}
+	return s.verifyMultiProofRoot(&proof, proofKeys, bounds)
+}
+
+// rangeBounds are the bounds of a range proof padded to the length of keys. nil means the range is not bounded.
+type rangeBounds struct {
+	lo, hi []byte
+}
+
+func (r *rangeBounds) contains(key []byte) bool {
+	return (len(r.lo) == 0 || bytes.Compare(key, r.lo) >= 0) && (len(r.hi) == 0 || bytes.Compare(key, r.hi) < 0)
+}
+
+// siblingOutside returns true if the sibling of the path of key at depth has no key in the range.
+func (r *rangeBounds) siblingOutside(key []byte, depth int) bool {
+	bound := make([]byte, HashLength)
+	copy(bound, key)
+	if bitIsSet(key, depth) {
+		// the last key of the left sibling must be before lo
+		if len(r.lo) == 0 {
+			return false
+		}
+		bitUnset(bound, depth)
+		for i := depth + 1; i < HashLength*8; i++ {
+			bitSet(bound, i)
+		}
+		return bytes.Compare(bound, r.lo) < 0
+	}
+	// the first key of the right sibling must not be before hi
+	if len(r.hi) == 0 {
+		return false
+	}
+	bitSet(bound, depth)
+	for i := depth + 1; i < HashLength*8; i++ {
+		bitUnset(bound, i)
+	}
+	return bytes.Compare(bound, r.hi) >= 0
+}
+
+// rangeBound pads a range bound with zeros, which is the first key not before the bound
+func rangeBound(bound []byte) []byte {
+	if len(bound) == 0 {
+		return nil
+	}
+	padded := make([]byte, HashLength)
+	copy(padded, bound)
+	return padded
+}
+
+// rangeProofKeys returns the keys proven by a range proof, which are the keys in the range with the bounds
+func rangeProofKeys(lo, hi []byte, keys [][]byte) [][]byte {
+	proofKeys := make([][]byte, 0, len(keys)+2)
+	if len(lo) != 0 && (len(keys) == 0 || !bytes.Equal(lo, keys[0])) {
+		proofKeys = append(proofKeys, lo)
+	}
+	proofKeys = append(proofKeys, keys...)
+	if len(hi) != 0 {
+		proofKeys = append(proofKeys, hi)
+	}
+	return proofKeys
+}
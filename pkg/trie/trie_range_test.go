@@ -0,0 +1,161 @@
+/**
+ *  @file
+ *  @copyright defined in aergo/LICENSE.txt
+ */
+
+package trie
+
+import (
+	"bytes"
+	"os"
+	"path"
+	"testing"
+
+	"github.com/aergoio/aergo-lib/db"
+	"github.com/aergoio/aergo/internal/common"
+)
+
+func TestTrieGetRange(t *testing.T) {
+	dbPath := path.Join(".aergo", "db")
+	if _, err := os.Stat(dbPath); os.IsNotExist(err) {
+		_ = os.MkdirAll(dbPath, 0711)
+	}
+	st := db.NewDB(db.BadgerImpl, dbPath)
+	defer func() {
+		st.Close()
+		os.RemoveAll(".aergo")
+	}()
+
+	smt := NewTrie(nil, common.Hasher, st)
+	keys := getFreshData(500, 32)
+	values := getFreshData(500, 32)
+	smt.Update(keys, values)
+	smt.Commit()
+
+	// the whole trie is read by chunks from a trie loaded from db
+	smt2 := NewTrie(smt.Root, common.Hasher, st)
+	var readKeys, readValues [][]byte
+	var start []byte
+	for {
+		k, v, next, err := smt2.GetRange(smt2.Root, start, nil, 33)
+		if err != nil {
+			t.Fatal(err)
+		}
+		if next == nil && len(k) > 33 || next != nil && len(k) != 33 {
+			t.Fatal("wrong chunk size")
+		}
+		readKeys = append(readKeys, k...)
+		readValues = append(readValues, v...)
+		if next == nil {
+			break
+		}
+		start = next
+	}
+	if len(readKeys) != len(keys) {
+		t.Fatalf("read %d keys, expected %d", len(readKeys), len(keys))
+	}
+	for i := range keys {
+		if !bytes.Equal(keys[i], readKeys[i]) || !bytes.Equal(values[i], readValues[i]) {
+			t.Fatalf("leaf %d mismatched", i)
+		}
+	}
+
+	// bounded range
+	k, _, next, _ := smt2.GetRange(smt2.Root, keys[100], keys[200], 1000)
+	if len(k) != 100 || !bytes.Equal(k[0], keys[100]) || !bytes.Equal(k[99], keys[199]) || next != nil {
+		t.Fatal("wrong bounded range")
+	}
+	// range by key prefix
+	k, _, _, _ = smt2.GetRange(smt2.Root, []byte{0x80}, []byte{0xc0}, 1000)
+	for _, key := range k {
+		if key[0] < 0x80 || key[0] >= 0xc0 {
+			t.Fatal("key out of range")
+		}
+	}
+	var expected int
+	for _, key := range keys {
+		if key[0] >= 0x80 && key[0] < 0xc0 {
+			expected++
+		}
+	}
+	if len(k) != expected {
+		t.Fatalf("read %d keys in prefix range, expected %d", len(k), expected)
+	}
+	k, _, _, _ = smt2.GetRange(nil, nil, nil, 10)
+	if len(k) != 0 {
+		t.Fatal("empty trie has leaves")
+	}
+}
+
+func TestTrieMerkleRangeProof(t *testing.T) {
+	smt := NewTrie(nil, common.Hasher, nil)
+	keys := getFreshData(500, 32)
+	values := getFreshData(500, 32)
+	smt.Update(keys, values)
+	verifier := NewTrie(smt.Root, common.Hasher, nil)
+
+	// every chunk of the trie is proven on its own
+	var start []byte
+	for {
+		k, v, next, err := smt.GetRange(smt.Root, start, nil, 33)
+		if err != nil {
+			t.Fatal(err)
+		}
+		mp, err := smt.MerkleRangeProof(smt.Root, start, next, k)
+		if err != nil {
+			t.Fatal(err)
+		}
+		if !verifier.VerifyRangeProof(mp, start, next, k, v) {
+			t.Fatal("failed to verify range proof")
+		}
+		if next == nil {
+			break
+		}
+		start = next
+	}
+
+	// range by key prefix
+	lo, hi := []byte{0x80}, []byte{0xc0}
+	k, v, _, _ := smt.GetRange(smt.Root, lo, hi, 1000)
+	mp, _ := smt.MerkleRangeProof(smt.Root, lo, hi, k)
+	if !verifier.VerifyRangeProof(mp, lo, hi, k, v) {
+		t.Fatal("failed to verify range proof of prefix")
+	}
+	if verifier.VerifyRangeProof(mp, lo, nil, k, v) || verifier.VerifyRangeProof(mp, nil, hi, k, v) {
+		t.Fatal("verified range proof of wider range")
+	}
+
+	// a range without leaves
+	empty := append([]byte(nil), keys[5]...)
+	for i := len(empty) - 1; i >= 0; i-- {
+		if empty[i]++; empty[i] != 0 {
+			break
+		}
+	}
+	mp, _ = smt.MerkleRangeProof(smt.Root, empty, keys[6], nil)
+	if !verifier.VerifyRangeProof(mp, empty, keys[6], nil, nil) {
+		t.Fatal("failed to verify range proof without leaves")
+	}
+
+	// a missing leaf or a wrong value must fail
+	k, v, _, _ = smt.GetRange(smt.Root, keys[100], keys[200], 1000)
+	missing := append(append([][]byte(nil), k[:50]...), k[51:]...)
+	missingValues := append(append([][]byte(nil), v[:50]...), v[51:]...)
+	mp, _ = smt.MerkleRangeProof(smt.Root, keys[100], keys[200], missing)
+	if verifier.VerifyRangeProof(mp, keys[100], keys[200], missing, missingValues) {
+		t.Fatal("verified range proof with a missing leaf")
+	}
+	mp, _ = smt.MerkleRangeProof(smt.Root, keys[100], keys[200], k[1:])
+	if verifier.VerifyRangeProof(mp, keys[100], keys[200], k[1:], v[1:]) {
+		t.Fatal("verified range proof with a missing first leaf")
+	}
+	mp, _ = smt.MerkleRangeProof(smt.Root, keys[100], keys[200], k)
+	wrong := append([][]byte(nil), v...)
+	wrong[10] = common.Hasher(wrong[10])
+	if verifier.VerifyRangeProof(mp, keys[100], keys[200], k, wrong) {
+		t.Fatal("verified range proof with a wrong value")
+	}
+	if !verifier.VerifyRangeProof(mp, keys[100], keys[200], k, v) {
+		t.Fatal("failed to verify bounded range proof")
+	}
+}
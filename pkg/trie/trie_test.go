@@ -40,9 +40,7 @@ func TestTrieUpdateAndGet(t *testing.T) {
 	// Add data to empty trie
 	keys := getFreshData(10, 32)
 	values := getFreshData(10, 32)
-	ch := make(chan mresult, 1)
-	smt.update(smt.Root, keys, values, nil, 0, smt.TrieHeight, ch)
-	res := <-ch
+	res := smt.update(smt.Root, keys, values, nil, 0, smt.TrieHeight)
 	root := res.update
 
 	// Check all keys have been stored
@@ -56,9 +54,7 @@ func TestTrieUpdateAndGet(t *testing.T) {
 	// Append to the trie
 	newKeys := getFreshData(5, 32)
 	newValues := getFreshData(5, 32)
-	ch = make(chan mresult, 1)
-	smt.update(root, newKeys, newValues, nil, 0, smt.TrieHeight, ch)
-	res = <-ch
+	res = smt.update(root, newKeys, newValues, nil, 0, smt.TrieHeight)
 	newRoot := res.update
 	if bytes.Equal(root, newRoot) {
 		t.Fatal("trie not updated")
@@ -143,9 +139,7 @@ func TestTrieDelete(t *testing.T) {
 	// Add data to empty trie
 	keys := getFreshData(20, 32)
 	values := getFreshData(20, 32)
-	ch := make(chan mresult, 1)
-	smt.update(smt.Root, keys, values, nil, 0, smt.TrieHeight, ch)
-	result := <-ch
+	result := smt.update(smt.Root, keys, values, nil, 0, smt.TrieHeight)
 	root := result.update
 	value, _ := smt.get(root, keys[0], nil, 0, smt.TrieHeight)
 	if !bytes.Equal(values[0], value) {
@@ -154,9 +148,7 @@ func TestTrieDelete(t *testing.T) {
 
 	// Delete from trie
 	// To delete a key, just set it's value to Default leaf hash.
-	ch = make(chan mresult, 1)
-	smt.update(root, keys[0:1], [][]byte{DefaultLeaf}, nil, 0, smt.TrieHeight, ch)
-	result = <-ch
+	result = smt.update(root, keys[0:1], [][]byte{DefaultLeaf}, nil, 0, smt.TrieHeight)
 	updatedNb := len(smt.db.updatedNodes)
 	newRoot := result.update
 	newValue, _ := smt.get(newRoot, keys[0], nil, 0, smt.TrieHeight)
@@ -165,9 +157,7 @@ func TestTrieDelete(t *testing.T) {
 	}
 	// Remove deleted key from keys and check root with a clean trie.
 	smt2 := NewTrie(nil, common.Hasher, nil)
-	ch = make(chan mresult, 1)
-	smt2.update(smt.Root, keys[1:], values[1:], nil, 0, smt.TrieHeight, ch)
-	result = <-ch
+	result = smt2.update(smt.Root, keys[1:], values[1:], nil, 0, smt.TrieHeight)
 	cleanRoot := result.update
 	if !bytes.Equal(newRoot, cleanRoot) {
 		t.Fatal("roots mismatch")
@@ -182,9 +172,7 @@ func TestTrieDelete(t *testing.T) {
 	for i := 0; i < 20; i++ {
 		newValues = append(newValues, DefaultLeaf)
 	}
-	ch = make(chan mresult, 1)
-	smt.update(root, keys, newValues, nil, 0, smt.TrieHeight, ch)
-	result = <-ch
+	result = smt.update(root, keys, newValues, nil, 0, smt.TrieHeight)
 	root = result.update
 	//if !bytes.Equal(smt.DefaultHash(256), root) {
 	if len(root) != 0 {
@@ -240,6 +228,48 @@ func TestTrieUpdateAndDelete(t *testing.T) {
 	}
 }
 
+func TestTrieSerializedBatch(t *testing.T) {
+	dbPath := path.Join(".aergo", "db")
+	if _, err := os.Stat(dbPath); os.IsNotExist(err) {
+		_ = os.MkdirAll(dbPath, 0711)
+	}
+	st := db.NewDB(db.BadgerImpl, dbPath)
+	smt := NewTrie(nil, common.Hasher, st)
+	keys := getFreshData(100, 32)
+	values := getFreshData(100, 32)
+	smt.Update(keys, values)
+	var batches [][]byte
+	for _, batch := range smt.db.updatedNodes {
+		batches = append(batches, smt.db.serializeBatch(batch))
+	}
+	smt.Commit()
+
+	// nodes picked from serialized batch are same as decoded
+	for _, val := range batches {
+		batch := smt.parseBatch(val)
+		for i := 1; i < 31; i++ {
+			if !bytes.Equal(batch[i], batchNode(val, i)) {
+				t.Fatalf("node %d of serialized batch mismatched", i)
+			}
+		}
+	}
+
+	// keys are read from serialized batches of a new trie
+	smt2 := NewTrie(smt.Root, common.Hasher, st)
+	for i, key := range keys {
+		value, _ := smt2.Get(key)
+		if !bytes.Equal(values[i], value) {
+			t.Fatal("value not read from serialized batch")
+		}
+	}
+	value, _ := smt2.Get(common.Hasher([]byte("non-member")))
+	if value != nil {
+		t.Fatal("non member key is read")
+	}
+	st.Close()
+	os.RemoveAll(".aergo")
+}
+
 func TestTrieMerkleProof(t *testing.T) {
 	smt := NewTrie(nil, common.Hasher, nil)
 	// Add data to empty trie
@@ -292,6 +322,78 @@ func TestTrieMerkleProofCompressed(t *testing.T) {
 	}
 }
 
+func TestTrieMerkleMultiProof(t *testing.T) {
+	smt := NewTrie(nil, common.Hasher, nil)
+	// Add data to empty trie
+	keys := getFreshData(100, 32)
+	values := getFreshData(100, 32)
+	smt.Update(keys, values)
+
+	// members and non members are proven together
+	var proofKeys [][]byte
+	for i := 0; i < len(keys); i += 7 {
+		proofKeys = append(proofKeys, keys[i])
+	}
+	proofKeys = append(proofKeys, getFreshData(20, 32)...)
+	sort.Sort(DataArray(proofKeys))
+
+	mp, err := smt.MerkleMultiProof(proofKeys)
+	if err != nil {
+		t.Fatal(err)
+	}
+	for i, key := range proofKeys {
+		value, _ := smt.Get(key)
+		leaf := mp.Leaves[i]
+		if leaf.Included != (value != nil) {
+			t.Fatalf("multi proof didnt return the inclusion of key")
+		}
+		if leaf.Included && !bytes.Equal(value, leaf.ProofVal) {
+			t.Fatalf("multi proof didnt return the correct value")
+		}
+	}
+	if !smt.VerifyMultiProof(mp, proofKeys) {
+		t.Fatalf("failed to verify multi proof")
+	}
+	var singleSize int
+	for _, key := range proofKeys {
+		_, ap, _, _, _, _, _ := smt.MerkleProofCompressed(key)
+		singleSize += len(ap)
+	}
+	if len(mp.AuditPath) >= singleSize {
+		t.Fatalf("multi proof is not smaller than single proofs : %d >= %d", len(mp.AuditPath), singleSize)
+	}
+
+	// tampered proofs must fail
+	if smt.VerifyMultiProof(mp, proofKeys[1:]) {
+		t.Fatalf("verified multi proof with wrong keys")
+	}
+	mp.AuditPath[0] = common.Hasher(mp.AuditPath[0])
+	if smt.VerifyMultiProof(mp, proofKeys) {
+		t.Fatalf("verified multi proof with wrong audit path")
+	}
+	mp, _ = smt.MerkleMultiProof(proofKeys)
+	for i := range mp.Leaves {
+		if mp.Leaves[i].Included {
+			mp.Leaves[i].ProofVal = common.Hasher(mp.Leaves[i].ProofVal)
+			break
+		}
+	}
+	if smt.VerifyMultiProof(mp, proofKeys) {
+		t.Fatalf("verified multi proof with wrong value")
+	}
+	mp, _ = smt.MerkleMultiProof(proofKeys)
+	mp.AuditPath = mp.AuditPath[:len(mp.AuditPath)-1]
+	if smt.VerifyMultiProof(mp, proofKeys) {
+		t.Fatalf("verified multi proof with short audit path")
+	}
+
+	// a client knowing only the root can verify the proof
+	mp, _ = smt.MerkleMultiProofR(proofKeys, smt.Root)
+	if !NewTrie(smt.Root, common.Hasher, nil).VerifyMultiProof(mp, proofKeys) {
+		t.Fatalf("failed to verify multi proof with root")
+	}
+}
+
 func TestTrieCommit(t *testing.T) {
 	dbPath := path.Join(".aergo", "db")
 	if _, err := os.Stat(dbPath); os.IsNotExist(err) {
@@ -710,6 +812,98 @@ func BenchmarkCacheHeightLimit245(b *testing.B) {
 	os.RemoveAll(".aergo")
 }
 
+//go test -run=xxx -bench=BenchmarkTrieUpdate -benchmem
+func BenchmarkTrieUpdate(b *testing.B) {
+	for _, size := range []int{1000, 10000, 100000} {
+		keys := getFreshData(size, 32)
+		values := getFreshData(size, 32)
+		b.Run(fmt.Sprintf("keys%d", size), func(b *testing.B) {
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				smt := NewTrie(nil, common.Hasher, nil)
+				if _, err := smt.Update(keys, values); err != nil {
+					b.Fatal(err)
+				}
+			}
+		})
+	}
+}
+
+//go test -run=xxx -bench=BenchmarkMerkleMultiProof -benchmem
+func BenchmarkMerkleMultiProof(b *testing.B) {
+	smt := NewTrie(nil, common.Hasher, nil)
+	smt.Update(getFreshData(100000, 32), getFreshData(100000, 32))
+	for _, size := range []int{10, 50, 200} {
+		keys := getFreshData(size, 32)
+		b.Run(fmt.Sprintf("single%d", size), func(b *testing.B) {
+			b.ReportAllocs()
+			var apLen int
+			for i := 0; i < b.N; i++ {
+				apLen = 0
+				for _, key := range keys {
+					_, ap, _, _, _, _, _ := smt.MerkleProofCompressed(key)
+					apLen += len(ap)
+				}
+			}
+			b.Logf("audit path : %d nodes", apLen)
+		})
+		b.Run(fmt.Sprintf("multi%d", size), func(b *testing.B) {
+			b.ReportAllocs()
+			var apLen int
+			for i := 0; i < b.N; i++ {
+				mp, _ := smt.MerkleMultiProof(keys)
+				apLen = len(mp.AuditPath)
+			}
+			b.Logf("audit path : %d nodes", apLen)
+		})
+	}
+}
+
+//go test -run=xxx -bench=BenchmarkTrieGet -benchmem
+func BenchmarkTrieGet(b *testing.B) {
+	dbPath := path.Join(".aergo", "db")
+	if _, err := os.Stat(dbPath); os.IsNotExist(err) {
+		_ = os.MkdirAll(dbPath, 0711)
+	}
+	st := db.NewDB(db.BadgerImpl, dbPath)
+	smt := NewTrie(nil, common.Hasher, st)
+	keys := getFreshData(10000, 32)
+	smt.Update(keys, getFreshData(10000, 32))
+	smt.Commit()
+
+	smt = NewTrie(smt.Root, common.Hasher, st)
+	b.ReportAllocs()
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		if _, err := smt.Get(keys[i%len(keys)]); err != nil {
+			b.Fatal(err)
+		}
+	}
+	b.StopTimer()
+	st.Close()
+	os.RemoveAll(".aergo")
+}
+
+//go test -run=xxx -bench=BenchmarkTrieCommit -benchmem
+func BenchmarkTrieCommit(b *testing.B) {
+	dbPath := path.Join(".aergo", "db")
+	if _, err := os.Stat(dbPath); os.IsNotExist(err) {
+		_ = os.MkdirAll(dbPath, 0711)
+	}
+	st := db.NewDB(db.BadgerImpl, dbPath)
+	smt := NewTrie(nil, common.Hasher, st)
+	b.ReportAllocs()
+	for i := 0; i < b.N; i++ {
+		b.StopTimer()
+		smt.Update(getFreshData(1000, 32), getFreshData(1000, 32))
+		b.StartTimer()
+		smt.Commit()
+	}
+	b.StopTimer()
+	st.Close()
+	os.RemoveAll(".aergo")
+}
+
 func getFreshData(size, length int) [][]byte {
 	var data [][]byte
 	for i := 0; i < size; i++ {
@@ -44,7 +44,7 @@ func (s *Trie) loadCache(root []byte, batch [][]byte, iBatch, height int, ch cha
 		//Store node in cache.
 		var node Hash
 		copy(node[:], root)
-		batch = s.parseBatch(dbval)
+		batch = ownBatch(s.parseBatch(dbval))
 		s.db.liveMux.Lock()
 		s.db.liveCache[node] = batch
 		s.db.liveMux.Unlock()
@@ -92,10 +92,26 @@ func (s *Trie) get(root, key []byte, batch [][]byte, iBatch, height int) ([]byte
 		// the trie does not contain the key
 		return nil, nil
 	}
-	// Fetch the children of the node
-	batch, iBatch, lnode, rnode, isShortcut, err := s.loadChildren(root, height, iBatch, batch)
-	if err != nil {
-		return nil, err
+	var lnode, rnode []byte
+	var isShortcut bool
+	if height%4 == 0 {
+		// a batch which is not cached is read without decoding
+		cached, val, err := s.loadBatchOrBytes(root)
+		if err != nil {
+			return nil, err
+		}
+		if cached == nil {
+			return s.getSerialized(val, key, height)
+		}
+		batch, iBatch = cached, 0
+		lnode, rnode, isShortcut = batch[1], batch[2], batch[0][0] == 1
+	} else {
+		// Fetch the children of the node
+		var err error
+		batch, iBatch, lnode, rnode, isShortcut, err = s.loadChildren(root, height, iBatch, batch)
+		if err != nil {
+			return nil, err
+		}
 	}
 	if isShortcut {
 		if bytes.Equal(lnode[:HashLength], key) {
@@ -110,6 +126,38 @@ func (s *Trie) get(root, key []byte, batch [][]byte, iBatch, height int) ([]byte
 	return s.get(lnode, key, batch, 2*iBatch+1, height-1)
 }
 
+// getSerialized fetches the value of a key in the subtree of a serialized batch.
+// It picks nodes on the path of the key from the serialized batch, so the batch doesn't have to be decoded.
+func (s *Trie) getSerialized(val, key []byte, height int) ([]byte, error) {
+	iBatch := 0
+	isShortcut := bitIsSet(val, 31)
+	for {
+		lnode, rnode := batchNode(val, 2*iBatch+1), batchNode(val, 2*iBatch+2)
+		if isShortcut {
+			if len(lnode) != 0 && bytes.Equal(lnode[:HashLength], key) {
+				return rnode[:HashLength], nil
+			}
+			return nil, nil
+		}
+		node := lnode
+		iBatch = 2*iBatch + 1
+		if bitIsSet(key, s.TrieHeight-height) {
+			node = rnode
+			iBatch++
+		}
+		height--
+		if len(node) == 0 {
+			// the trie does not contain the key
+			return nil, nil
+		}
+		if height%4 == 0 {
+			// the node is the root of the next batch
+			return s.get(node, key, nil, 0, height)
+		}
+		isShortcut = node[HashLength] == 1
+	}
+}
+
 // TrieRootExists returns true if the root exists in Database.
 func (s *Trie) TrieRootExists(root []byte) bool {
 	s.db.lock.RLock()
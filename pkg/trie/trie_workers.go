@@ -0,0 +1,69 @@
+/**
+ *  @file
+ *  @copyright defined in aergo/LICENSE.txt
+ */
+
+package trie
+
+import (
+	"runtime"
+	"sync"
+)
+
+const (
+	// batchLen is the number of nodes stored in a batch: a subtree of height 4 and a flag
+	batchLen = 31
+	// batchesPerSlab is the number of batches allocated at once
+	batchesPerSlab = 16
+	// minParallelUpdateKeys is the minimum number of keys of a subtree to update its sides in different goroutines.
+	// smaller subtrees are updated faster in a single goroutine than paying for goroutine creation and join.
+	minParallelUpdateKeys = 64
+)
+
+// updateWorkers limits the number of extra goroutines updating subtrees, which is shared by all tries.
+var updateWorkers = make(chan struct{}, runtime.NumCPU())
+
+// acquireUpdateWorker returns true if an update worker is available. It never blocks, so the caller can update
+// the subtree by itself if all the workers are busy.
+func acquireUpdateWorker() bool {
+	select {
+	case updateWorkers <- struct{}{}:
+		return true
+	default:
+		return false
+	}
+}
+
+func releaseUpdateWorker() {
+	<-updateWorkers
+}
+
+// batchSlabPool keeps the remainder of slabs which batches are carved from.
+var batchSlabPool = sync.Pool{
+	New: func() interface{} {
+		slab := make([][]byte, 0)
+		return &slab
+	},
+}
+
+// newBatch returns an empty batch. Batches are carved from a bigger slab to reduce allocations of
+// updating many nodes. The capacity of a batch is limited, so that appending to it never overwrites neighbours.
+func newBatch() [][]byte {
+	slabp := batchSlabPool.Get().(*[][]byte)
+	slab := *slabp
+	if len(slab) < batchLen {
+		slab = make([][]byte, batchLen*batchesPerSlab)
+	}
+	batch := slab[:batchLen:batchLen]
+	*slabp = slab[batchLen:]
+	batchSlabPool.Put(slabp)
+	return batch
+}
+
+// ownBatch returns a copy of batch in its own allocation. Batches kept in a long-lived cache are copied, since a
+// batch carved from a slab keeps the whole slab alive as long as it is referenced.
+func ownBatch(batch [][]byte) [][]byte {
+	own := make([][]byte, batchLen)
+	copy(own, batch)
+	return own
+}
@@ -27,6 +27,9 @@ func bitIsSet(bits []byte, i int) bool {
 func bitSet(bits []byte, i int) {
 	bits[i/8] |= 1 << uint(7-i%8)
 }
+func bitUnset(bits []byte, i int) {
+	bits[i/8] &^= 1 << uint(7-i%8)
+}
 
 // for sorting test data
 type DataArray [][]byte
@@ -11,6 +11,7 @@ import (
 	"encoding/binary"
 	"encoding/json"
 	"errors"
+	"io"
 	"reflect"
 	"strings"
 	"sync"
@@ -28,6 +29,7 @@ import (
 	"github.com/aergoio/aergo/pkg/component"
 	"github.com/aergoio/aergo/types"
 	"github.com/golang/protobuf/ptypes/timestamp"
+	"google.golang.org/grpc"
 	"google.golang.org/grpc/codes"
 	"google.golang.org/grpc/status"
 )
@@ -45,6 +47,7 @@ var (
 type EventStream struct {
 	filter *types.FilterInfo
 	stream types.AergoRPCService_ListEventStreamServer
+	*streamSubscriber
 }
 
 // AergoRPCService implements GRPC server which is defined in rpc.proto
@@ -56,9 +59,12 @@ type AergoRPCService struct {
 
 	streamID                uint32
 	blockStreamLock         sync.RWMutex
-	blockStream             map[uint32]types.AergoRPCService_ListBlockStreamServer
+	blockStream             map[uint32]*streamSubscriber
 	blockMetadataStreamLock sync.RWMutex
-	blockMetadataStream     map[uint32]types.AergoRPCService_ListBlockMetadataStreamServer
+	blockMetadataStream     map[uint32]*streamSubscriber
+	// streamQueueSize and streamMaxDrops are the queue size and the drop limit of subscribers of streams
+	streamQueueSize int
+	streamMaxDrops  int
 
 	eventStreamLock sync.RWMutex
 	eventStream     map[*EventStream]*EventStream
@@ -335,77 +341,81 @@ func (rpc *AergoRPCService) getBlocks(ctx context.Context, in *types.ListParams)
 	return blocks, err
 }
 
+func (rpc *AergoRPCService) newStreamSubscriber(stream grpc.ServerStream) *streamSubscriber {
+	return newStreamSubscriber(stream, rpc.streamQueueSize, rpc.streamMaxDrops)
+}
+
+// BroadcastToListBlockStream queues block to all block streams. block is marshaled once for all streams.
 func (rpc *AergoRPCService) BroadcastToListBlockStream(block *types.Block) {
-	var err error
 	rpc.blockStreamLock.RLock()
 	defer rpc.blockStreamLock.RUnlock()
-	for _, stream := range rpc.blockStream {
-		if stream != nil {
-			rpc.blockStreamLock.RUnlock()
-			err = stream.Send(block)
-			if err != nil {
-				logger.Warn().Err(err).Msg("failed to broadcast block stream")
-			}
-			rpc.blockStreamLock.RLock()
-		}
+	if len(rpc.blockStream) == 0 {
+		return
+	}
+
+	msg, err := newPreparedMsg(block)
+	if err != nil {
+		logger.Warn().Err(err).Msg("failed to broadcast block stream")
+		return
+	}
+	for _, subscriber := range rpc.blockStream {
+		subscriber.push(msg)
 	}
 }
 
+// BroadcastToListBlockMetadataStream queues meta to all block metadata streams. meta is marshaled once for all
+// streams.
 func (rpc *AergoRPCService) BroadcastToListBlockMetadataStream(meta *types.BlockMetadata) {
-	var err error
 	rpc.blockMetadataStreamLock.RLock()
 	defer rpc.blockMetadataStreamLock.RUnlock()
+	if len(rpc.blockMetadataStream) == 0 {
+		return
+	}
 
-	for _, stream := range rpc.blockMetadataStream {
-		if stream != nil {
-			rpc.blockMetadataStreamLock.RUnlock()
-			err = stream.Send(meta)
-			if err != nil {
-				logger.Warn().Err(err).Msg("failed to broadcast block meta stream")
-			}
-			rpc.blockMetadataStreamLock.RLock()
-		}
+	msg, err := newPreparedMsg(meta)
+	if err != nil {
+		logger.Warn().Err(err).Msg("failed to broadcast block meta stream")
+		return
+	}
+	for _, subscriber := range rpc.blockMetadataStream {
+		subscriber.push(msg)
 	}
 }
 
 // ListBlockStream starts a stream of new blocks
 func (rpc *AergoRPCService) ListBlockStream(in *types.Empty, stream types.AergoRPCService_ListBlockStreamServer) error {
 	streamId := atomic.AddUint32(&rpc.streamID, 1)
+	subscriber := rpc.newStreamSubscriber(stream)
 	rpc.blockStreamLock.Lock()
-	rpc.blockStream[streamId] = stream
+	rpc.blockStream[streamId] = subscriber
 	rpc.blockStreamLock.Unlock()
 	logger.Debug().Uint32("id", streamId).Msg("block stream added")
 
-	for {
-		select {
-		case <-stream.Context().Done():
-			rpc.blockStreamLock.Lock()
-			delete(rpc.blockStream, streamId)
-			rpc.blockStreamLock.Unlock()
-			logger.Debug().Uint32("id", streamId).Msg("block stream deleted")
-			return nil
-		}
-	}
+	err := subscriber.run()
+
+	rpc.blockStreamLock.Lock()
+	delete(rpc.blockStream, streamId)
+	rpc.blockStreamLock.Unlock()
+	logger.Debug().Err(err).Uint32("id", streamId).Msg("block stream deleted")
+	return err
 }
 
 // ListBlockMetadataStream starts a stream of new blocks' metadata
 func (rpc *AergoRPCService) ListBlockMetadataStream(in *types.Empty, stream types.AergoRPCService_ListBlockMetadataStreamServer) error {
 	streamID := atomic.AddUint32(&rpc.streamID, 1)
+	subscriber := rpc.newStreamSubscriber(stream)
 	rpc.blockMetadataStreamLock.Lock()
-	rpc.blockMetadataStream[streamID] = stream
+	rpc.blockMetadataStream[streamID] = subscriber
 	rpc.blockMetadataStreamLock.Unlock()
 	logger.Debug().Uint32("id", streamID).Msg("block meta stream added")
 
-	for {
-		select {
-		case <-stream.Context().Done():
-			rpc.blockMetadataStreamLock.Lock()
-			delete(rpc.blockMetadataStream, streamID)
-			rpc.blockMetadataStreamLock.Unlock()
-			logger.Debug().Uint32("id", streamID).Msg("block meta stream deleted")
-			return nil
-		}
-	}
+	err := subscriber.run()
+
+	rpc.blockMetadataStreamLock.Lock()
+	delete(rpc.blockMetadataStream, streamID)
+	rpc.blockMetadataStreamLock.Unlock()
+	logger.Debug().Err(err).Uint32("id", streamID).Msg("block meta stream deleted")
+	return err
 }
 
 func extractBlockFromFuture(future *actor.Future) (*types.Block, error) {
@@ -648,6 +658,49 @@ func (rpc *AergoRPCService) CommitTX(ctx context.Context, in *types.TxList) (*ty
 	}
 }
 
+// CommitTXStream commits batches of signed transactions sent through a stream. Each batch is put into the mempool
+// by a single request, and the results of batches are sent back in order while the following batches are received.
+func (rpc *AergoRPCService) CommitTXStream(stream types.AergoRPCService_CommitTXStreamServer) error {
+	ctx := stream.Context()
+	if err := rpc.checkAuth(ctx, WriteBlockChain); err != nil {
+		return err
+	}
+
+	pending := make(chan *txBatch, maxPendingTxBatches)
+	recvErr := make(chan error, 1)
+	go func() {
+		defer close(pending)
+		for {
+			in, err := stream.Recv()
+			if err == io.EOF {
+				recvErr <- nil
+				return
+			} else if err != nil {
+				recvErr <- err
+				return
+			}
+			if len(in.Txs) > maxTxBatchSize {
+				recvErr <- status.Errorf(codes.InvalidArgument, "too many txs in a batch: %d > %d", len(in.Txs), maxTxBatchSize)
+				return
+			}
+			batch := putTxBatch(rpc.hub, in.Txs, defaultActorTimeout<<2)
+			select {
+			case pending <- batch:
+			case <-ctx.Done():
+				recvErr <- ctx.Err()
+				return
+			}
+		}
+	}()
+
+	for batch := range pending {
+		if err := stream.Send(batch.results()); err != nil {
+			return err
+		}
+	}
+	return <-recvErr
+}
+
 // GetState handle rpc request getstate
 func (rpc *AergoRPCService) GetState(ctx context.Context, in *types.SingleBytes) (*types.State, error) {
 	if err := rpc.checkAuth(ctx, ReadBlockChain); err != nil {
@@ -1073,7 +1126,7 @@ func (rpc *AergoRPCService) QueryContractState(ctx context.Context, in *types.St
 		return nil, err
 	}
 	result, err := rpc.hub.RequestFuture(message.ChainSvc,
-		&message.GetStateQuery{ContractAddress: in.ContractAddress, StorageKeys: in.StorageKeys, Root: in.Root, Compressed: in.Compressed}, defaultActorTimeout, "rpc.(*AergoRPCService).GetStateQuery").Result()
+		&message.GetStateQuery{ContractAddress: in.ContractAddress, StorageKeys: in.StorageKeys, Root: in.Root, Compressed: in.Compressed, MultiProof: in.MultiProof}, defaultActorTimeout, "rpc.(*AergoRPCService).GetStateQuery").Result()
 	if err != nil {
 		return nil, err
 	}
@@ -1104,41 +1157,44 @@ func (rpc *AergoRPCService) ListEventStream(in *types.FilterInfo, stream types.A
 		return err
 	}
 
-	eventStream := &EventStream{in, stream}
+	eventStream := &EventStream{in, stream, rpc.newStreamSubscriber(stream)}
 	rpc.eventStreamLock.Lock()
 	rpc.eventStream[eventStream] = eventStream
 	rpc.eventStreamLock.Unlock()
 
-	for {
-		select {
-		case <-eventStream.stream.Context().Done():
-			rpc.eventStreamLock.Lock()
-			delete(rpc.eventStream, eventStream)
-			rpc.eventStreamLock.Unlock()
-			return nil
-		}
-	}
+	err = eventStream.run()
+
+	rpc.eventStreamLock.Lock()
+	delete(rpc.eventStream, eventStream)
+	rpc.eventStreamLock.Unlock()
+	return err
 }
 
+// BroadcastToEventStream queues events to the event streams whose filters match them. Each event is marshaled
+// once for all streams.
 func (rpc *AergoRPCService) BroadcastToEventStream(events []*types.Event) error {
-	var err error
 	rpc.eventStreamLock.RLock()
 	defer rpc.eventStreamLock.RUnlock()
+	if len(rpc.eventStream) == 0 {
+		return nil
+	}
 
+	msgs := make([]*preparedMsg, len(events))
 	for _, es := range rpc.eventStream {
-		if es != nil {
-			rpc.eventStreamLock.RUnlock()
-			argFilter, _ := es.filter.GetExArgFilter()
-			for _, event := range events {
-				if event.Filter(es.filter, argFilter) {
-					err = es.stream.Send(event)
-					if err != nil {
-						logger.Warn().Err(err).Msg("failed to broadcast block stream")
-						break
-					}
+		argFilter, _ := es.filter.GetExArgFilter()
+		for i, event := range events {
+			if !event.Filter(es.filter, argFilter) {
+				continue
+			}
+			if msgs[i] == nil {
+				msg, err := newPreparedMsg(event)
+				if err != nil {
+					logger.Warn().Err(err).Msg("failed to broadcast event stream")
+					continue
 				}
+				msgs[i] = msg
 			}
-			rpc.eventStreamLock.RLock()
+			es.push(msgs[i])
 		}
 	}
 	return nil
@@ -60,14 +60,18 @@ type RPC struct {
 func NewRPC(cfg *config.Config, chainAccessor types.ChainAccessor, version string) *RPC {
 	actualServer := &AergoRPCService{
 		msgHelper:           message.GetHelper(),
-		blockStream:         map[uint32]types.AergoRPCService_ListBlockStreamServer{},
-		blockMetadataStream: map[uint32]types.AergoRPCService_ListBlockMetadataStreamServer{},
+		blockStream:         map[uint32]*streamSubscriber{},
+		blockMetadataStream: map[uint32]*streamSubscriber{},
+		streamQueueSize:     cfg.RPC.StreamQueueSize,
+		streamMaxDrops:      cfg.RPC.StreamMaxDrops,
 		eventStream:         make(map[*EventStream]*EventStream),
 	}
 
 	tracer := opentracing.GlobalTracer()
 
 	opts := make([]grpc.ServerOption, 0)
+	// broadcast messages of streams are marshaled once for all clients
+	opts = append(opts, grpc.CustomCodec(newStreamCodec()))
 
 	if cfg.RPC.NetServiceTrace {
 		opts = append(opts, grpc.UnaryInterceptor(otgrpc.OpenTracingServerInterceptor(tracer)))
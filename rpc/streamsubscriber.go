@@ -0,0 +1,118 @@
+/**
+ *  @file
+ *  @copyright defined in aergo/LICENSE.txt
+ */
+
+package rpc
+
+import (
+	"sync"
+
+	"github.com/golang/protobuf/proto"
+	"google.golang.org/grpc"
+	"google.golang.org/grpc/codes"
+	"google.golang.org/grpc/encoding"
+	"google.golang.org/grpc/status"
+)
+
+const (
+	defaultStreamQueueSize = 128
+)
+
+var (
+	ErrSlowStream = status.Error(codes.ResourceExhausted, "stream is closed since the client is too slow to receive")
+)
+
+// streamSubscriber relays broadcast messages to the stream of a client. Messages are queued in a bounded queue and
+// sent by the goroutine serving the stream, so that a slow client delays neither the broadcaster nor other clients.
+type streamSubscriber struct {
+	stream grpc.ServerStream
+
+	sendCh    chan interface{}
+	closeCh   chan struct{}
+	closeOnce sync.Once
+
+	// drops is the number of messages dropped in a row. It is accessed only by the broadcaster.
+	drops    int
+	maxDrops int
+}
+
+func newStreamSubscriber(stream grpc.ServerStream, queueSize, maxDrops int) *streamSubscriber {
+	if queueSize <= 0 {
+		queueSize = defaultStreamQueueSize
+	}
+	return &streamSubscriber{
+		stream:   stream,
+		sendCh:   make(chan interface{}, queueSize),
+		closeCh:  make(chan struct{}),
+		maxDrops: maxDrops,
+	}
+}
+
+// push queues msg without blocking. msg is dropped if the queue is full, and the stream is closed if more than
+// maxDrops messages are dropped in a row, so that the client can subscribe again and catch up.
+func (s *streamSubscriber) push(msg interface{}) {
+	select {
+	case s.sendCh <- msg:
+		s.drops = 0
+	default:
+		s.drops++
+		if s.drops > s.maxDrops {
+			s.closeOnce.Do(func() { close(s.closeCh) })
+		}
+	}
+}
+
+// run sends queued messages to the stream until the client leaves or the stream is closed by push.
+func (s *streamSubscriber) run() error {
+	for {
+		select {
+		case msg := <-s.sendCh:
+			if err := s.stream.SendMsg(msg); err != nil {
+				return err
+			}
+		case <-s.closeCh:
+			return ErrSlowStream
+		case <-s.stream.Context().Done():
+			return nil
+		}
+	}
+}
+
+// preparedMsg is a message marshaled once to be sent to many streams. streamCodec sends its bytes as they are.
+type preparedMsg struct {
+	data []byte
+}
+
+func newPreparedMsg(msg proto.Message) (*preparedMsg, error) {
+	data, err := proto.Marshal(msg)
+	if err != nil {
+		return nil, err
+	}
+	return &preparedMsg{data: data}, nil
+}
+
+// streamCodec is the codec of the grpc server. It is the proto codec of grpc, except that it doesn't marshal
+// preparedMsg again.
+type streamCodec struct {
+	proto encoding.Codec
+}
+
+func newStreamCodec() *streamCodec {
+	return &streamCodec{proto: encoding.GetCodec("proto")}
+}
+
+func (c *streamCodec) Marshal(v interface{}) ([]byte, error) {
+	if msg, ok := v.(*preparedMsg); ok {
+		return msg.data, nil
+	}
+	return c.proto.Marshal(v)
+}
+
+func (c *streamCodec) Unmarshal(data []byte, v interface{}) error {
+	return c.proto.Unmarshal(data, v)
+}
+
+func (c *streamCodec) String() string {
+	return c.proto.Name()
+}
@@ -0,0 +1,82 @@
+/**
+ *  @file
+ *  @copyright defined in aergo/LICENSE.txt
+ */
+package rpc
+
+import (
+	"context"
+	"testing"
+
+	"github.com/aergoio/aergo/types"
+	"github.com/golang/protobuf/proto"
+	"github.com/stretchr/testify/assert"
+	"google.golang.org/grpc/metadata"
+)
+
+type fakeServerStream struct {
+	ctx  context.Context
+	sent []interface{}
+}
+
+func (s *fakeServerStream) SetHeader(metadata.MD) error  { return nil }
+func (s *fakeServerStream) SendHeader(metadata.MD) error { return nil }
+func (s *fakeServerStream) SetTrailer(metadata.MD)       {}
+func (s *fakeServerStream) Context() context.Context     { return s.ctx }
+func (s *fakeServerStream) SendMsg(m interface{}) error {
+	s.sent = append(s.sent, m)
+	return nil
+}
+func (s *fakeServerStream) RecvMsg(m interface{}) error { return nil }
+
+func TestStreamSubscriber(t *testing.T) {
+	ctx, cancel := context.WithCancel(context.Background())
+	defer cancel()
+	stream := &fakeServerStream{ctx: ctx}
+	s := newStreamSubscriber(stream, 2, 1)
+
+	s.push(1)
+	s.push(2)
+	// a full queue drops messages, and closes the stream if too many are dropped in a row
+	s.push(3)
+	assert.Equal(t, 1, s.drops)
+	s.push(4)
+
+	select {
+	case <-s.closeCh:
+	default:
+		t.Fatal("slow stream is not closed")
+	}
+	err := s.run()
+	assert.Equal(t, ErrSlowStream, err)
+	assert.Subset(t, []interface{}{1, 2}, stream.sent)
+
+	// a client leaving ends the stream without error
+	stream = &fakeServerStream{ctx: ctx}
+	s = newStreamSubscriber(stream, 2, 1)
+	cancel()
+	assert.NoError(t, s.run())
+}
+
+func TestStreamCodec(t *testing.T) {
+	codec := newStreamCodec()
+	block := types.NewBlock(&types.BlockHeaderInfo{No: 10}, nil, nil, nil, nil, nil)
+	expected, err := proto.Marshal(block)
+	assert.NoError(t, err)
+
+	msg, err := newPreparedMsg(block)
+	assert.NoError(t, err)
+	data, err := codec.Marshal(msg)
+	assert.NoError(t, err)
+	assert.Equal(t, expected, data)
+
+	// other messages are marshaled by the proto codec
+	data, err = codec.Marshal(block)
+	assert.NoError(t, err)
+	assert.Equal(t, expected, data)
+
+	decoded := &types.Block{}
+	assert.NoError(t, codec.Unmarshal(data, decoded))
+	assert.Equal(t, block.BlockHash(), decoded.BlockHash())
+	assert.Equal(t, "proto", codec.String())
+}
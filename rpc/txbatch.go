@@ -0,0 +1,89 @@
+/**
+ *  @file
+ *  @copyright defined in aergo/LICENSE.txt
+ */
+
+package rpc
+
+import (
+	"bytes"
+	"reflect"
+	"time"
+
+	"github.com/aergoio/aergo-actor/actor"
+	"github.com/aergoio/aergo/message"
+	"github.com/aergoio/aergo/pkg/component"
+	"github.com/aergoio/aergo/types"
+	"google.golang.org/grpc/codes"
+	"google.golang.org/grpc/status"
+)
+
+const (
+	// maxPendingTxBatches is the number of batches of a tx stream which are put into the mempool while their
+	// results are not sent yet.
+	maxPendingTxBatches = 8
+	// maxTxBatchSize is the maximum number of txs in a batch of a tx stream.
+	maxTxBatchSize = 10000
+)
+
+// txBatch is a batch of txs received from a tx stream, which is put into the mempool by a single request.
+type txBatch struct {
+	rs []*types.CommitResult
+	// idx is the indexes of txs requested to the mempool in rs
+	idx    []int
+	future *actor.Future
+}
+
+// putTxBatch checks the hashes of txs and requests the mempool to put the txs having valid hashes, without waiting
+// for the result.
+func putTxBatch(hub component.ICompSyncRequester, txs []*types.Tx, timeout time.Duration) *txBatch {
+	b := &txBatch{
+		rs:  make([]*types.CommitResult, len(txs)),
+		idx: make([]int, 0, len(txs)),
+	}
+	toPut := make([]*types.Tx, 0, len(txs))
+	for i, tx := range txs {
+		b.rs[i] = &types.CommitResult{Hash: tx.GetHash()}
+		if !bytes.Equal(tx.GetHash(), tx.CalculateTxHash()) {
+			b.rs[i].Error = types.CommitStatus_TX_INVALID_HASH
+			continue
+		}
+		b.idx = append(b.idx, i)
+		toPut = append(toPut, tx)
+	}
+	if len(toPut) > 0 {
+		b.future = hub.RequestFuture(message.MemPoolSvc, &message.MemPoolPutTxs{Txs: toPut}, timeout,
+			"rpc.(*AergoRPCService).CommitTXStream")
+	}
+	return b
+}
+
+// results waits for the mempool to put the batch, and returns the result of each tx in order.
+func (b *txBatch) results() *types.CommitResultList {
+	if b.future == nil {
+		return &types.CommitResultList{Results: b.rs}
+	}
+
+	var errs []error
+	result, err := b.future.Result()
+	if err == nil {
+		rsp, ok := result.(*message.MemPoolPutTxsRsp)
+		if !ok || len(rsp.Errs) != len(b.idx) {
+			err = status.Errorf(codes.Internal, "internal type (%v) error", reflect.TypeOf(result))
+		} else {
+			errs = rsp.Errs
+		}
+	}
+	for n, i := range b.idx {
+		if err == nil {
+			b.rs[i].Error = convertError(errs[n])
+			if errs[n] != nil {
+				b.rs[i].Detail = errs[n].Error()
+			}
+		} else {
+			b.rs[i].Error = types.CommitStatus_TX_INTERNAL_ERROR
+			b.rs[i].Detail = err.Error()
+		}
+	}
+	return &types.CommitResultList{Results: b.rs}
+}
@@ -0,0 +1,309 @@
+package rpc
+
+import (
+	"context"
+	"io"
+	"io/ioutil"
+	"math/big"
+	"net"
+	"os"
+	"path/filepath"
+	"testing"
+	"time"
+
+	"github.com/aergoio/aergo-actor/actor"
+	"github.com/aergoio/aergo-lib/db"
+	"github.com/aergoio/aergo/account/key"
+	crypto "github.com/aergoio/aergo/account/key/crypto"
+	"github.com/aergoio/aergo/chain"
+	"github.com/aergoio/aergo/config"
+	"github.com/aergoio/aergo/internal/common"
+	"github.com/aergoio/aergo/mempool"
+	"github.com/aergoio/aergo/message"
+	"github.com/aergoio/aergo/pkg/component"
+	"github.com/aergoio/aergo/types"
+	"github.com/btcsuite/btcd/btcec"
+	"github.com/stretchr/testify/assert"
+	"google.golang.org/grpc"
+	"google.golang.org/grpc/codes"
+	"google.golang.org/grpc/status"
+)
+
+func newTxBatchSamples(offset, size int) []*types.Tx {
+	txs := make([]*types.Tx, size)
+	for i := 0; i < size; i++ {
+		tx := types.NewTx()
+		tx.Body.Nonce = uint64(offset + i + 1)
+		tx.Hash = tx.CalculateTxHash()
+		txs[i] = tx
+	}
+	return txs
+}
+
+func Test_putTxBatch(t *testing.T) {
+	hub := component.NewComponentHub()
+	stub := &MPStub{added: make(map[types.TxID]bool)}
+	stub.BaseComponent = component.NewBaseComponent(message.MemPoolSvc, stub, logger)
+	hub.Register(stub)
+	hub.Start()
+	defer hub.Stop()
+
+	txs := newTxBatchSamples(0, 10)
+	invalid := types.NewTx()
+	invalid.Hash = []byte("invalid hash")
+	txs = append(txs, invalid, txs[0])
+
+	rs := putTxBatch(hub, txs, time.Second).results().Results
+	assert.Equal(t, len(txs), len(rs))
+	for i := 0; i < 10; i++ {
+		assert.Equal(t, txs[i].Hash, rs[i].Hash)
+		assert.Equal(t, types.CommitStatus_TX_OK, rs[i].Error, "idx %d", i)
+	}
+	assert.Equal(t, types.CommitStatus_TX_INVALID_HASH, rs[10].Error)
+	assert.Equal(t, types.CommitStatus_TX_ALREADY_EXISTS, rs[11].Error)
+	assert.Equal(t, 10, len(stub.added))
+
+	// nothing is requested to mempool if no tx has valid hash
+	batch := putTxBatch(hub, []*types.Tx{invalid}, time.Second)
+	assert.Nil(t, batch.future)
+	assert.Equal(t, types.CommitStatus_TX_INVALID_HASH, batch.results().Results[0].Error)
+}
+
+// delayedMPStub answers batches in the reverse order of requests, within each group of pipelined batches
+type delayedMPStub struct {
+	*component.BaseComponent
+	count int
+}
+
+func (a *delayedMPStub) Receive(context actor.Context) {
+	switch msg := context.Message().(type) {
+	case *message.MemPoolPutTxs:
+		sender := context.Sender()
+		delay := time.Duration(maxPendingTxBatches-a.count%maxPendingTxBatches) * 10 * time.Millisecond
+		a.count++
+		go func() {
+			time.Sleep(delay)
+			sender.Tell(&message.MemPoolPutTxsRsp{Errs: make([]error, len(msg.Txs))})
+		}()
+	}
+}
+func (a *delayedMPStub) BeforeStart() {}
+func (a *delayedMPStub) AfterStart()  {}
+func (a *delayedMPStub) BeforeStop()  {}
+func (a *delayedMPStub) Statistics() *map[string]interface{} {
+	return &map[string]interface{}{}
+}
+
+// fakeTxStream is the server side of CommitTXStream. It receives batches from in until in is closed, and keeps
+// the sent results.
+type fakeTxStream struct {
+	fakeServerStream
+	in   chan *types.TxList
+	sent []*types.CommitResultList
+}
+
+func (s *fakeTxStream) Recv() (*types.TxList, error) {
+	select {
+	case txs, ok := <-s.in:
+		if !ok {
+			return nil, io.EOF
+		}
+		return txs, nil
+	case <-s.ctx.Done():
+		return nil, s.ctx.Err()
+	}
+}
+
+func (s *fakeTxStream) Send(rs *types.CommitResultList) error {
+	s.sent = append(s.sent, rs)
+	return nil
+}
+
+func TestAergoRPCService_CommitTXStream(t *testing.T) {
+	hub := component.NewComponentHub()
+	stub := &delayedMPStub{}
+	stub.BaseComponent = component.NewBaseComponent(message.MemPoolSvc, stub, logger)
+	hub.Register(stub)
+	hub.Start()
+	defer hub.Stop()
+	rpc := &AergoRPCService{hub: hub}
+
+	// results are sent in the order of batches, while the mempool answers the pipelined batches in reverse
+	stream := &fakeTxStream{fakeServerStream: fakeServerStream{ctx: context.Background()},
+		in: make(chan *types.TxList, maxPendingTxBatches)}
+	batches := make([][]*types.Tx, maxPendingTxBatches)
+	for i := range batches {
+		batches[i] = newTxBatchSamples(i*10, 10)
+		stream.in <- &types.TxList{Txs: batches[i]}
+	}
+	close(stream.in)
+	assert.NoError(t, rpc.CommitTXStream(stream))
+	assert.Equal(t, len(batches), len(stream.sent))
+	for i, rs := range stream.sent {
+		for j, r := range rs.Results {
+			assert.Equal(t, batches[i][j].Hash, r.Hash, "batch %d, tx %d", i, j)
+			assert.Equal(t, types.CommitStatus_TX_OK, r.Error)
+		}
+	}
+
+	// an oversized batch ends the stream after the results of preceding batches
+	stream = &fakeTxStream{fakeServerStream: fakeServerStream{ctx: context.Background()}, in: make(chan *types.TxList, 2)}
+	stream.in <- &types.TxList{Txs: newTxBatchSamples(100, 10)}
+	stream.in <- &types.TxList{Txs: make([]*types.Tx, maxTxBatchSize+1)}
+	err := rpc.CommitTXStream(stream)
+	assert.Equal(t, codes.InvalidArgument, status.Code(err))
+	assert.Equal(t, 1, len(stream.sent))
+
+	// the stream ends when the client cancels it
+	ctx, cancel := context.WithCancel(context.Background())
+	stream = &fakeTxStream{fakeServerStream: fakeServerStream{ctx: ctx}, in: make(chan *types.TxList)}
+	done := make(chan error, 1)
+	go func() {
+		done <- rpc.CommitTXStream(stream)
+	}()
+	stream.in <- &types.TxList{Txs: newTxBatchSamples(200, 10)}
+	cancel()
+	select {
+	case err := <-done:
+		// the receiving goroutine is done too, since it closes pending batches which the handler waits for
+		assert.Equal(t, context.Canceled, err)
+	case <-time.After(time.Second * 5):
+		t.Fatal("stream is not ended by cancel")
+	}
+}
+
+// svcStub answers the best block to a mempool, and drops other messages such as notices of new txs
+type svcStub struct {
+	*component.BaseComponent
+	best *types.Block
+}
+
+func (a *svcStub) Receive(context actor.Context) {
+	switch context.Message().(type) {
+	case *message.GetBestBlock:
+		context.Respond(message.GetBestBlockRsp{Block: a.best})
+	}
+}
+func (a *svcStub) BeforeStart() {}
+func (a *svcStub) AfterStart()  {}
+func (a *svcStub) BeforeStop()  {}
+func (a *svcStub) Statistics() *map[string]interface{} {
+	return &map[string]interface{}{}
+}
+
+// BenchmarkCommitTXStream is a load generator which streams signed txs through a grpc server to a mempool, which
+// verifies them as a node does. The client pipelines batches as well. The rate of txs per second is
+// accCount * txCount / (ns/op) * 1e9.
+func BenchmarkCommitTXStream(b *testing.B) {
+	const (
+		accCount  = 100
+		txCount   = 100
+		batchSize = 1000
+	)
+	dir, _ := ioutil.TempDir("", "txstream")
+	defer os.RemoveAll(dir)
+
+	keys := make([]*btcec.PrivateKey, accCount)
+	addrs := make([][]byte, accCount)
+	genesis := types.GetTestGenesis()
+	genesis.Balance = make(map[string]string)
+	for i := range keys {
+		keys[i], _ = btcec.NewPrivateKey(btcec.S256())
+		addrs[i] = crypto.GenerateAddress(&keys[i].PublicKey)
+		genesis.Balance[types.EncodeAddress(addrs[i])] = "1000000000000000000000000000"
+	}
+	core, err := chain.NewCore(string(db.BadgerImpl), dir, false, 0)
+	if err != nil {
+		b.Fatalf("failed to init chain (%s)", err)
+	}
+	defer core.Close()
+	if err = core.InitGenesisBlock(genesis, false); err != nil {
+		b.Fatalf("failed to init genesis (%s)", err)
+	}
+
+	cfg := config.NewServerContext("", "").GetDefaultConfig().(*config.Config)
+	cfg.Mempool.DumpFilePath = filepath.Join(dir, "mempool.dump")
+	mp := mempool.NewMemPoolService(cfg, &chain.ChainService{Core: core})
+	chainStub := &svcStub{best: genesis.Block()}
+	chainStub.BaseComponent = component.NewBaseComponent(message.ChainSvc, chainStub, logger)
+	p2pStub := &svcStub{}
+	p2pStub.BaseComponent = component.NewBaseComponent(message.P2PSvc, p2pStub, logger)
+	hub := component.NewComponentHub()
+	hub.Register(mp, chainStub, p2pStub)
+	hub.Start()
+	defer hub.Stop()
+
+	server := grpc.NewServer(grpc.CustomCodec(newStreamCodec()))
+	types.RegisterAergoRPCServiceServer(server, &AergoRPCService{hub: hub})
+	l, err := net.Listen("tcp", "127.0.0.1:0")
+	if err != nil {
+		b.Fatalf("failed to listen (%s)", err)
+	}
+	go server.Serve(l) // nolint: errcheck
+	defer server.Stop()
+	conn, err := grpc.Dial(l.Addr().String(), grpc.WithInsecure())
+	if err != nil {
+		b.Fatalf("failed to dial (%s)", err)
+	}
+	defer conn.Close()
+	client := types.NewAergoRPCServiceClient(conn)
+
+	// txs of each iteration continue the nonces of accounts
+	chainIdHash := common.Hasher(types.MakeChainId(genesis.Block().GetHeader().GetChainID(), cfg.Hardfork.Version(1)))
+	newBatches := func(n int) []*types.TxList {
+		var batches []*types.TxList
+		batch := &types.TxList{}
+		for j := 0; j < txCount; j++ {
+			for i := 0; i < accCount; i++ {
+				tx := &types.Tx{
+					Body: &types.TxBody{
+						Nonce:       uint64(n*txCount + j + 1),
+						Account:     addrs[i],
+						Recipient:   addrs[(i+1)%accCount],
+						Amount:      big.NewInt(1).Bytes(),
+						Type:        types.TxType_TRANSFER,
+						ChainIdHash: chainIdHash,
+					},
+				}
+				_ = key.SignTx(tx, keys[i])
+				batch.Txs = append(batch.Txs, tx)
+				if len(batch.Txs) == batchSize {
+					batches = append(batches, batch)
+					batch = &types.TxList{}
+				}
+			}
+		}
+		return batches
+	}
+
+	b.ResetTimer()
+	for n := 0; n < b.N; n++ {
+		b.StopTimer()
+		batches := newBatches(n)
+		b.StartTimer()
+
+		stream, err := client.CommitTXStream(context.Background())
+		if err != nil {
+			b.Fatalf("failed to open stream (%s)", err)
+		}
+		go func() {
+			for _, batch := range batches {
+				if stream.Send(batch) != nil {
+					return
+				}
+			}
+			_ = stream.CloseSend()
+		}()
+		for range batches {
+			rs, err := stream.Recv()
+			if err != nil {
+				b.Fatalf("failed to receive results (%s)", err)
+			}
+			for _, r := range rs.Results {
+				if r.Error != types.CommitStatus_TX_OK {
+					b.Fatalf("tx is not put: %s %s", r.Error, r.Detail)
+				}
+			}
+		}
+	}
+}
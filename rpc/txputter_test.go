@@ -221,6 +221,16 @@ func (a *MPStub) Receive(context actor.Context) {
 		} else {
 			context.Respond(&message.MemPoolPutRsp{Err:types.ErrTxAlreadyInMempool})
 		}
+	case *message.MemPoolPutTxs:
+		errs := make([]error, len(msg.Txs))
+		for i, tx := range msg.Txs {
+			id := types.ToTxID(tx.Hash)
+			if _,exist := a.added[id]; exist {
+				errs[i] = types.ErrTxAlreadyInMempool
+			}
+			a.added[id] = true
+		}
+		context.Respond(&message.MemPoolPutTxsRsp{Errs:errs})
 	}
 }
 func (a *MPStub)  BeforeStart() {}
@@ -0,0 +1,210 @@
+package state
+
+import (
+	"bytes"
+	"errors"
+	"sort"
+
+	"github.com/aergoio/aergo/internal/common"
+	"github.com/aergoio/aergo/types"
+)
+
+var (
+	// ErrDiffSQLChanged means that the block changed SQL databases of contracts, which are not included in a diff.
+	ErrDiffSQLChanged = errors.New("state diff can't include changes of contract SQL databases")
+
+	errInvalidDiff = errors.New("invalid state diff: no receipts")
+)
+
+// BlockDiff is the changes of states made by executing the txs of a block. A node which produced the block can ship
+// it with the block, so that nodes trusting the producer connect the block by applying the diff instead of executing
+// the txs again. The state root and the receipts root of the block are still verified after applying it.
+type BlockDiff struct {
+	Accounts []AccountDiff
+	Storages []StorageDiff
+	// Codes are contract codes deployed by the block
+	Codes    [][]byte
+	Receipts []byte
+}
+
+// AccountDiff is the state of an account after the block.
+type AccountDiff struct {
+	ID      types.AccountID
+	State   []byte
+	Deleted bool
+}
+
+// StorageDiff is the changed variables of a contract storage.
+type StorageDiff struct {
+	Account types.AccountID
+	Entries []StorageEntry
+}
+
+type StorageEntry struct {
+	Key     types.HashID
+	Value   []byte
+	Deleted bool
+}
+
+// Encode returns the binary of diff to be shipped with the block.
+func (diff *BlockDiff) Encode() ([]byte, error) {
+	return common.GobEncode(diff)
+}
+
+// DecodeBlockDiff decodes the binary written by BlockDiff.Encode.
+func DecodeBlockDiff(data []byte) (*BlockDiff, error) {
+	diff := &BlockDiff{}
+	if err := common.GobDecode(data, diff); err != nil {
+		return nil, err
+	}
+	return diff, nil
+}
+
+// ExportDiff returns the changes of states made by the block. It must be called after Update and before Commit. It
+// returns ErrDiffSQLChanged if a contract changed its SQL database, since the database is not the part of states.
+func (bs *BlockState) ExportDiff() (*BlockDiff, error) {
+	diff, err := bs.StateDB.exportDiff()
+	if err != nil {
+		return nil, err
+	}
+	if diff.Receipts, err = bs.receipts.MarshalBinary(); err != nil {
+		return nil, err
+	}
+	return diff, nil
+}
+
+// ApplyDiff puts the changes of states in diff into the block state, and updates the trie as executing the txs of
+// the block does. The receipts hardfork of the block state must be set before.
+func (bs *BlockState) ApplyDiff(diff *BlockDiff) error {
+	if len(diff.Receipts) == 0 {
+		return errInvalidDiff
+	}
+	if err := bs.StateDB.applyDiff(diff); err != nil {
+		return err
+	}
+	if err := bs.StateDB.Update(); err != nil {
+		return err
+	}
+	return bs.receipts.UnmarshalBinary(diff.Receipts)
+}
+
+func (states *StateDB) exportDiff() (*BlockDiff, error) {
+	states.lock.RLock()
+	defer states.lock.RUnlock()
+
+	accounts, err := states.buffer.exportAccounts()
+	if err != nil {
+		return nil, err
+	}
+
+	// the states before the block are compared to find deployed codes and changed SQL databases
+	prev := NewStateDB(states.store, states.snapRoot, states.testmode)
+	prev.snap = states.snap
+
+	diff := &BlockDiff{Accounts: make([]AccountDiff, 0, len(accounts))}
+	for id, value := range accounts {
+		if value == nil {
+			diff.Accounts = append(diff.Accounts, AccountDiff{ID: id, Deleted: true})
+			continue
+		}
+		diff.Accounts = append(diff.Accounts, AccountDiff{ID: id, State: value})
+
+		st, err := unmarshalState(value)
+		if err != nil {
+			return nil, err
+		}
+		prevSt, err := prev.getTrieState(id)
+		if err != nil {
+			return nil, err
+		}
+		// a new contract starts with the recovery point 1 before it opens its database
+		if st.SqlRecoveryPoint != prevSt.GetSqlRecoveryPoint() && (prevSt != nil || st.SqlRecoveryPoint > 1) {
+			return nil, ErrDiffSQLChanged
+		}
+		if len(st.CodeHash) != 0 && !bytes.Equal(st.CodeHash, prevSt.GetCodeHash()) {
+			var code []byte
+			if err := loadData(states.store, st.CodeHash, &code); err != nil {
+				return nil, err
+			}
+			diff.Codes = append(diff.Codes, code)
+		}
+	}
+	sort.Slice(diff.Accounts, func(i, j int) bool {
+		return bytes.Compare(diff.Accounts[i].ID[:], diff.Accounts[j].ID[:]) < 0
+	})
+
+	for id, storage := range states.cache.storages {
+		sd := StorageDiff{Account: id}
+		for key, v := range storage.buffer.indexes {
+			et := storage.buffer.entries[v.peek()]
+			if _, ok := et.(*metaEntry); ok {
+				continue
+			}
+			if et.Value() == nil {
+				sd.Entries = append(sd.Entries, StorageEntry{Key: key, Deleted: true})
+				continue
+			}
+			value, err := marshal(et.Value())
+			if err != nil {
+				return nil, err
+			}
+			sd.Entries = append(sd.Entries, StorageEntry{Key: key, Value: value})
+		}
+		if len(sd.Entries) == 0 {
+			continue
+		}
+		sort.Slice(sd.Entries, func(i, j int) bool {
+			return sd.Entries[i].Key.Compare(sd.Entries[j].Key) < 0
+		})
+		diff.Storages = append(diff.Storages, sd)
+	}
+	sort.Slice(diff.Storages, func(i, j int) bool {
+		return bytes.Compare(diff.Storages[i].Account[:], diff.Storages[j].Account[:]) < 0
+	})
+
+	return diff, nil
+}
+
+func (states *StateDB) applyDiff(diff *BlockDiff) error {
+	states.lock.Lock()
+	defer states.lock.Unlock()
+
+	for _, code := range diff.Codes {
+		if err := saveData(states.store, common.Hasher(code), code); err != nil {
+			return err
+		}
+	}
+
+	// storages are opened on the roots before the block, and the roots after are calculated by update
+	for _, sd := range diff.Storages {
+		storage := states.cache.get(sd.Account)
+		if storage == nil {
+			st, err := states.getTrieState(sd.Account)
+			if err != nil {
+				return err
+			}
+			storage = newBufferedStorage(common.Compactz(st.GetStorageRoot()), states.store)
+		}
+		for _, e := range sd.Entries {
+			if e.Deleted {
+				storage.put(newValueEntryDelete(e.Key))
+			} else {
+				storage.put(newValueEntry(e.Key, e.Value))
+			}
+		}
+		states.cache.put(sd.Account, storage)
+	}
+
+	for _, ad := range diff.Accounts {
+		if ad.Deleted {
+			states.buffer.put(newValueEntryDelete(types.HashID(ad.ID)))
+			continue
+		}
+		st, err := unmarshalState(ad.State)
+		if err != nil {
+			return err
+		}
+		states.buffer.put(newValueEntry(types.HashID(ad.ID), st))
+	}
+	return nil
+}
@@ -0,0 +1,76 @@
+package state
+
+import (
+	"testing"
+
+	"github.com/aergoio/aergo/types"
+	"github.com/stretchr/testify/assert"
+)
+
+func TestBlockDiff(t *testing.T) {
+	initTest(t)
+	defer deinitTest()
+
+	root := chainStateDB.GetRoot()
+	contractID := types.ToAccountID([]byte("contract"))
+
+	// execute a block on the leader
+	leader := chainStateDB.NewBlockState(root)
+	leader.Receipts().SetHardFork(types.DummyBlockVersionner(2), 1)
+	assert.NoError(t, leader.PutState(testAccount, &testStates[0]))
+	contract, err := leader.OpenContractStateAccount(contractID)
+	assert.NoError(t, err)
+	assert.NoError(t, contract.SetCode([]byte("code")))
+	assert.NoError(t, contract.SetData([]byte("key1"), []byte("value1")))
+	assert.NoError(t, contract.SetData([]byte("key2"), []byte("value2")))
+	assert.NoError(t, contract.DeleteData([]byte("key2")))
+	assert.NoError(t, leader.PutState(contractID, contract.State))
+	assert.NoError(t, leader.StageContractState(contract))
+	assert.NoError(t, leader.AddReceipt(&types.Receipt{ContractAddress: types.AddressPadding([]byte("contract")), Status: "SUCCESS", TxHash: make([]byte, 32)}))
+	assert.NoError(t, leader.Update())
+
+	diff, err := leader.ExportDiff()
+	assert.NoError(t, err)
+	assert.Equal(t, 2, len(diff.Accounts))
+	assert.Equal(t, 1, len(diff.Storages))
+	assert.Equal(t, 2, len(diff.Storages[0].Entries))
+	assert.Equal(t, [][]byte{[]byte("code")}, diff.Codes)
+
+	data, err := diff.Encode()
+	assert.NoError(t, err)
+	decoded, err := DecodeBlockDiff(data)
+	assert.NoError(t, err)
+
+	// apply the diff on a follower
+	follower := chainStateDB.NewBlockState(root)
+	follower.Receipts().SetHardFork(types.DummyBlockVersionner(2), 1)
+	assert.NoError(t, follower.ApplyDiff(decoded))
+	assert.Equal(t, leader.GetRoot(), follower.GetRoot())
+	assert.Equal(t, leader.Receipts().MerkleRoot(), follower.Receipts().MerkleRoot())
+
+	assert.NoError(t, follower.Commit())
+	assert.NoError(t, chainStateDB.UpdateRoot(follower))
+	applied, err := chainStateDB.GetStateDB().OpenContractStateAccount(contractID)
+	assert.NoError(t, err)
+	value, err := applied.GetData([]byte("key1"))
+	assert.NoError(t, err)
+	assert.Equal(t, []byte("value1"), value)
+	value, err = applied.GetData([]byte("key2"))
+	assert.NoError(t, err)
+	assert.Nil(t, value)
+	code, err := applied.GetCode()
+	assert.NoError(t, err)
+	assert.Equal(t, []byte("code"), code)
+
+	// changes of SQL databases can't be exported
+	next := chainStateDB.NewBlockState(chainStateDB.GetRoot())
+	next.Receipts().SetHardFork(types.DummyBlockVersionner(2), 1)
+	st, err := next.GetAccountState(contractID)
+	assert.NoError(t, err)
+	changed := types.State(*st)
+	changed.SqlRecoveryPoint = st.SqlRecoveryPoint + 1
+	assert.NoError(t, next.PutState(contractID, &changed))
+	assert.NoError(t, next.Update())
+	_, err = next.ExportDiff()
+	assert.Equal(t, ErrDiffSQLChanged, err)
+}
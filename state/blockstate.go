@@ -52,6 +52,13 @@ func SetGasPrice(gasPrice *big.Int) BlockStateOptFn {
 	}
 }
 
+// RecordAccess makes block state record read and write sets of txs on account states and contract storage.
+func RecordAccess() BlockStateOptFn {
+	return func(s *BlockState) {
+		s.access = newAccessRecorder()
+	}
+}
+
 // NewBlockState create new blockState contains blockInfo, account states and undo states
 func NewBlockState(states *StateDB, options ...BlockStateOptFn) *BlockState {
 	b := &BlockState{
@@ -127,6 +134,49 @@ func (bs *BlockState) PrevBlockHash() []byte {
 	return bs.prevBlockHash
 }
 
+// BeginTxAccess starts recording accesses of tx at txIdx in block. It does nothing if block state doesn't record access.
+func (bs *BlockState) BeginTxAccess(txIdx int) {
+	if bs.access != nil {
+		bs.access.beginTx(txIdx)
+	}
+}
+
+// EndTxAccess finishes recording accesses of the current tx. Items written by the tx become the versions which
+// txs after it read.
+func (bs *BlockState) EndTxAccess() {
+	if bs.access != nil {
+		bs.access.endTx()
+	}
+}
+
+// TxAccessSets returns recorded read and write sets of txs in the order of execution.
+func (bs *BlockState) TxAccessSets() []*TxAccessSet {
+	if bs.access == nil {
+		return nil
+	}
+	bs.access.lock.Lock()
+	defer bs.access.lock.Unlock()
+	return bs.access.sets
+}
+
+// AccessVersions returns the multi-version store of items written by recorded txs. It is nil if block state
+// doesn't record access.
+func (bs *BlockState) AccessVersions() *MVStore {
+	if bs.access == nil {
+		return nil
+	}
+	return bs.access.mv
+}
+
+// AccessStats returns access pattern of recorded txs. It is nil if block state doesn't record access.
+func (bs *BlockState) AccessStats() *AccessStats {
+	if bs.access == nil {
+		return nil
+	}
+	stats := bs.access.stats()
+	return &stats
+}
+
 func (bs *BlockState) GetCode(key types.AccountID) []byte {
 	if bs == nil {
 		return nil
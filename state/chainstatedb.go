@@ -17,6 +17,8 @@ type ChainStateDB struct {
 	states   *StateDB
 	store    db.DB
 	testmode bool
+	// snapshot keeps recent account states in flat layers, which is shared by statedbs opened from this
+	snapshot *snapshotTree
 }
 
 // NewChainStateDB creates instance of ChainStateDB
@@ -30,8 +32,9 @@ func (sdb *ChainStateDB) Clone() *ChainStateDB {
 	defer sdb.Unlock()
 
 	newSdb := &ChainStateDB{
-		store:  sdb.store,
-		states: sdb.GetStateDB().Clone(),
+		store:    sdb.store,
+		states:   sdb.GetStateDB().Clone(),
+		snapshot: sdb.snapshot,
 	}
 	return newSdb
 }
@@ -55,7 +58,9 @@ func (sdb *ChainStateDB) Init(dbType string, dataDir string, bestBlock *types.Bl
 			sroot = bestBlock.GetHeader().GetBlocksRootHash()
 		}
 
+		sdb.snapshot = newSnapshotTree(sroot)
 		sdb.states = NewStateDB(sdb.store, sroot, sdb.testmode)
+		sdb.states.snap = sdb.snapshot
 	}
 	return nil
 }
@@ -72,6 +77,28 @@ func (sdb *ChainStateDB) Close() error {
 	return nil
 }
 
+// EnablePipelinedCommit makes commits of states return before they are written to disk. A commit is flushed
+// in background while the next block is executed, and it waits for the flush of the previous commit.
+// It must be called after Init, before states are opened from this.
+func (sdb *ChainStateDB) EnablePipelinedCommit() {
+	sdb.Lock()
+	defer sdb.Unlock()
+
+	if _, ok := sdb.store.(*pipelinedStore); ok {
+		return
+	}
+	sdb.store = newPipelinedStore(sdb.store)
+	sdb.states = NewStateDB(sdb.store, sdb.states.GetRoot(), sdb.testmode)
+	sdb.states.snap = sdb.snapshot
+}
+
+// WaitCommit blocks until all committed states are written to disk.
+func (sdb *ChainStateDB) WaitCommit() {
+	if ps, ok := sdb.store.(*pipelinedStore); ok {
+		ps.Wait()
+	}
+}
+
 // GetStateDB returns statedb stores account states
 func (sdb *ChainStateDB) GetStateDB() *StateDB {
 	return sdb.states
@@ -84,7 +111,17 @@ func (sdb *ChainStateDB) GetSystemAccountState() (*ContractState, error) {
 
 // OpenNewStateDB returns new instance of statedb given state root hash
 func (sdb *ChainStateDB) OpenNewStateDB(root []byte) *StateDB {
-	return NewStateDB(sdb.store, root, sdb.testmode)
+	states := NewStateDB(sdb.store, root, sdb.testmode)
+	states.snap = sdb.snapshot
+	return states
+}
+
+// SnapshotStats returns statistics of the account state snapshot
+func (sdb *ChainStateDB) SnapshotStats() map[string]interface{} {
+	if sdb.snapshot == nil {
+		return nil
+	}
+	return sdb.snapshot.Stats()
 }
 
 func (sdb *ChainStateDB) SetGenesis(genesis *types.Genesis, bpInit func(*StateDB, *types.Genesis) error) error {
@@ -0,0 +1,159 @@
+/**
+ *  @file
+ *  @copyright defined in aergo/LICENSE.txt
+ */
+
+package state
+
+import (
+	"sync"
+
+	"github.com/aergoio/aergo-lib/db"
+)
+
+// pipelinedStore is the state store whose bulks are flushed in a background goroutine, so that the next block
+// can be executed while trie nodes of the previous block are written to disk. Values of a bulk which is not
+// flushed yet are read from memory. Up to one bulk is flushed at a time: flushing a bulk waits until the
+// previous one is durable.
+//
+// State keys written in bulks are hashes of their values, except for markers, so a pending value is never
+// stale. Iterators and transactions of the underlying db don't see pending values.
+type pipelinedStore struct {
+	db.DB
+
+	lock    sync.RWMutex
+	pending map[string]pendingValue
+	// flushed is closed when the last flush is done
+	flushed chan struct{}
+	// flushLock serializes flushes
+	flushLock sync.Mutex
+}
+
+type pendingValue struct {
+	value   []byte
+	deleted bool
+}
+
+func newPipelinedStore(store db.DB) *pipelinedStore {
+	return &pipelinedStore{
+		DB:      store,
+		pending: map[string]pendingValue{},
+	}
+}
+
+func (s *pipelinedStore) Get(key []byte) []byte {
+	s.lock.RLock()
+	v, ok := s.pending[string(key)]
+	s.lock.RUnlock()
+	if ok {
+		return v.value
+	}
+	return s.DB.Get(key)
+}
+
+func (s *pipelinedStore) Exist(key []byte) bool {
+	s.lock.RLock()
+	v, ok := s.pending[string(key)]
+	s.lock.RUnlock()
+	if ok {
+		return !v.deleted
+	}
+	return s.DB.Exist(key)
+}
+
+func (s *pipelinedStore) Set(key, value []byte) {
+	s.lock.Lock()
+	delete(s.pending, string(key))
+	s.lock.Unlock()
+	s.DB.Set(key, value)
+}
+
+func (s *pipelinedStore) Delete(key []byte) {
+	s.lock.Lock()
+	delete(s.pending, string(key))
+	s.lock.Unlock()
+	s.DB.Delete(key)
+}
+
+func (s *pipelinedStore) NewBulk() db.Bulk {
+	return &pipelinedBulk{
+		Bulk:   s.DB.NewBulk(),
+		store:  s,
+		writes: map[string]pendingValue{},
+	}
+}
+
+// Wait blocks until all bulks flushed before are written to the underlying db.
+func (s *pipelinedStore) Wait() {
+	s.lock.RLock()
+	flushed := s.flushed
+	s.lock.RUnlock()
+	if flushed != nil {
+		<-flushed
+	}
+}
+
+func (s *pipelinedStore) Close() {
+	s.Wait()
+	s.DB.Close()
+}
+
+// flush makes writes of bulk readable from memory, and writes the bulk in background.
+func (s *pipelinedStore) flush(bulk db.Bulk, writes map[string]pendingValue) {
+	s.flushLock.Lock()
+	defer s.flushLock.Unlock()
+	s.Wait()
+
+	flushed := make(chan struct{})
+	s.lock.Lock()
+	for k, v := range writes {
+		s.pending[k] = v
+	}
+	s.flushed = flushed
+	s.lock.Unlock()
+
+	go func() {
+		defer close(flushed)
+		bulk.Flush()
+
+		s.lock.Lock()
+		for k := range writes {
+			delete(s.pending, k)
+		}
+		s.lock.Unlock()
+	}()
+}
+
+// pipelinedBulk keeps writes to be pending in the store until they are flushed.
+type pipelinedBulk struct {
+	db.Bulk
+	store  *pipelinedStore
+	writes map[string]pendingValue
+}
+
+func (b *pipelinedBulk) Set(key, value []byte) {
+	b.Bulk.Set(key, value)
+	b.writes[string(key)] = pendingValue{value: value}
+}
+
+func (b *pipelinedBulk) Delete(key []byte) {
+	b.Bulk.Delete(key)
+	b.writes[string(key)] = pendingValue{deleted: true}
+}
+
+func (b *pipelinedBulk) Flush() {
+	if b.writes == nil {
+		return
+	}
+	writes := b.writes
+	b.writes = nil
+	b.store.flush(b.Bulk, writes)
+}
+
+func (b *pipelinedBulk) DiscardLast() {
+	if b.writes == nil {
+		return
+	}
+	b.Bulk.DiscardLast()
+	b.writes = nil
+}
@@ -0,0 +1,105 @@
+package state
+
+import (
+	"fmt"
+	"io/ioutil"
+	"os"
+	"testing"
+
+	"github.com/aergoio/aergo-lib/db"
+	"github.com/aergoio/aergo/types"
+	"github.com/stretchr/testify/assert"
+)
+
+// gatedBulk holds flush until gate is closed
+type gatedBulk struct {
+	db.Bulk
+	gate chan struct{}
+}
+
+func (b *gatedBulk) Flush() {
+	<-b.gate
+	b.Bulk.Flush()
+}
+
+func TestPipelinedStore(t *testing.T) {
+	tmpdir, _ := ioutil.TempDir("", "pipeline")
+	defer os.RemoveAll(tmpdir)
+	raw := db.NewDB(db.BadgerImpl, tmpdir)
+	store := newPipelinedStore(raw)
+	defer store.Close()
+
+	raw.Set([]byte("deleted"), []byte("old"))
+	bulk := store.NewBulk().(*pipelinedBulk)
+	bulk.Bulk = &gatedBulk{Bulk: bulk.Bulk, gate: make(chan struct{})}
+	bulk.Set([]byte("key"), []byte("value"))
+	bulk.Delete([]byte("deleted"))
+	bulk.Flush()
+	// discarding after flush is ignored, like deferred DiscardLast
+	bulk.DiscardLast()
+
+	// pending writes are read from memory
+	assert.Equal(t, []byte("value"), store.Get([]byte("key")))
+	assert.True(t, store.Exist([]byte("key")))
+	assert.False(t, store.Exist([]byte("deleted")))
+	assert.Nil(t, raw.Get([]byte("key")))
+
+	close(bulk.Bulk.(*gatedBulk).gate)
+	store.Wait()
+	assert.Equal(t, []byte("value"), raw.Get([]byte("key")))
+	assert.False(t, raw.Exist([]byte("deleted")))
+	assert.Empty(t, store.pending)
+}
+
+func TestPipelinedCommit(t *testing.T) {
+	initTest(t)
+	defer deinitTest()
+	chainStateDB.EnablePipelinedCommit()
+	stateDB = chainStateDB.GetStateDB()
+
+	for i := range testStates {
+		assert.NoError(t, stateDB.PutState(testAccount, &testStates[i]))
+		assert.NoError(t, stateDB.Update())
+		assert.NoError(t, stateDB.Commit())
+		root := stateDB.GetRoot()
+
+		// states opened on the committed root can be read before flush is done
+		states := chainStateDB.OpenNewStateDB(root)
+		read, err := states.GetAccountState(testAccount)
+		assert.NoError(t, err)
+		assert.True(t, stateEquals(&testStates[i], read))
+		assert.True(t, states.HasMarker(root))
+	}
+	chainStateDB.WaitCommit()
+	assert.True(t, stateDB.HasMarker(stateDB.GetRoot()))
+}
+
+func benchmarkCommit(b *testing.B, pipelined bool) {
+	tmpdir, _ := ioutil.TempDir("", "pipeline")
+	defer os.RemoveAll(tmpdir)
+	sdb := NewChainStateDB()
+	_ = sdb.Init(string(db.BadgerImpl), tmpdir, nil, false)
+	defer sdb.Close()
+	if pipelined {
+		sdb.EnablePipelinedCommit()
+	}
+	states := sdb.GetStateDB()
+
+	b.ReportAllocs()
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		// execution of a block updating accounts
+		for j := 0; j < 1000; j++ {
+			id := types.ToAccountID([]byte(fmt.Sprintf("account%d", j)))
+			_ = states.PutState(id, &types.State{Nonce: uint64(i), Balance: []byte{byte(j)}})
+		}
+		_ = states.Update()
+		_ = states.Commit()
+	}
+	sdb.WaitCommit()
+}
+
+func BenchmarkCommit(b *testing.B) {
+	b.Run("sync", func(b *testing.B) { benchmarkCommit(b, false) })
+	b.Run("pipelined", func(b *testing.B) { benchmarkCommit(b, true) })
+}
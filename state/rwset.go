@@ -0,0 +1,242 @@
+/**
+ *  @file
+ *  @copyright defined in aergo/LICENSE.txt
+ */
+
+package state
+
+import (
+	"sort"
+	"sync"
+
+	"github.com/aergoio/aergo/types"
+)
+
+// BaseVersion is the version of state items which are not written by any tx in block, i.e. read from the state of
+// the previous block.
+const BaseVersion = -1
+
+// AccessKey identifies a state item accessed by tx. It is the account state of Account if Storage is empty,
+// or else the storage key Storage of contract Account.
+type AccessKey struct {
+	Account types.AccountID
+	Storage types.HashID
+}
+
+// IsStorage returns true if the key is a storage key of contract.
+func (key AccessKey) IsStorage() bool {
+	return key.Storage != emptyHashID
+}
+
+// TxAccessSet is the read set and write set of a tx in block. Reads keep the version of each item when tx read it,
+// that is the index of the last tx in block which wrote it before, or BaseVersion.
+// Items which tx read after writing them by itself are not in Reads.
+type TxAccessSet struct {
+	TxIdx  int
+	Reads  map[AccessKey]int
+	Writes map[AccessKey]struct{}
+}
+
+func newTxAccessSet(txIdx int) *TxAccessSet {
+	return &TxAccessSet{
+		TxIdx:  txIdx,
+		Reads:  map[AccessKey]int{},
+		Writes: map[AccessKey]struct{}{},
+	}
+}
+
+type mvVersion struct {
+	txIdx int
+	value interface{}
+}
+
+// MVStore is a multi-version store of state items written by txs in block. Each item keeps one version per
+// writing tx, so that a tx at index i reads the version of the last writer before i. It is the data structure
+// to detect conflicts of txs executed speculatively in parallel: a tx must be re-executed if a version
+// it read is not the version it would read now.
+type MVStore struct {
+	lock     sync.RWMutex
+	versions map[AccessKey][]mvVersion // ordered by txIdx
+}
+
+// NewMVStore returns an empty multi-version store
+func NewMVStore() *MVStore {
+	return &MVStore{versions: map[AccessKey][]mvVersion{}}
+}
+
+// Write sets the version of key written by tx at txIdx.
+func (mv *MVStore) Write(key AccessKey, txIdx int, value interface{}) {
+	mv.lock.Lock()
+	defer mv.lock.Unlock()
+	vs := mv.versions[key]
+	i := sort.Search(len(vs), func(i int) bool { return vs[i].txIdx >= txIdx })
+	if i < len(vs) && vs[i].txIdx == txIdx {
+		vs[i].value = value
+		return
+	}
+	vs = append(vs, mvVersion{})
+	copy(vs[i+1:], vs[i:])
+	vs[i] = mvVersion{txIdx: txIdx, value: value}
+	mv.versions[key] = vs
+}
+
+// Delete removes the version of key written by tx at txIdx, like when the tx is aborted to be re-executed.
+func (mv *MVStore) Delete(key AccessKey, txIdx int) {
+	mv.lock.Lock()
+	defer mv.lock.Unlock()
+	vs := mv.versions[key]
+	i := sort.Search(len(vs), func(i int) bool { return vs[i].txIdx >= txIdx })
+	if i == len(vs) || vs[i].txIdx != txIdx {
+		return
+	}
+	if len(vs) == 1 {
+		delete(mv.versions, key)
+		return
+	}
+	mv.versions[key] = append(vs[:i], vs[i+1:]...)
+}
+
+// Read returns the value and version of key which tx at txIdx reads. version is BaseVersion and value is nil
+// if no tx before txIdx wrote it.
+func (mv *MVStore) Read(key AccessKey, txIdx int) (value interface{}, version int) {
+	mv.lock.RLock()
+	defer mv.lock.RUnlock()
+	vs := mv.versions[key]
+	i := sort.Search(len(vs), func(i int) bool { return vs[i].txIdx >= txIdx })
+	if i == 0 {
+		return nil, BaseVersion
+	}
+	return vs[i-1].value, vs[i-1].txIdx
+}
+
+// Validate returns false if any item in the read set of tx has another version than the tx read.
+func (mv *MVStore) Validate(set *TxAccessSet) bool {
+	for key, version := range set.Reads {
+		if _, current := mv.Read(key, set.TxIdx); current != version {
+			return false
+		}
+	}
+	return true
+}
+
+// AccessStats is the access pattern of txs in block.
+type AccessStats struct {
+	Txs int `json:"txs"`
+	// Reads and Writes are the number of items read or written, counted per tx
+	Reads  int `json:"reads"`
+	Writes int `json:"writes"`
+	// distinct items accessed in block
+	Accounts    int `json:"accounts"`
+	StorageKeys int `json:"storageKeys"`
+	// DependentTxs is the number of txs which read an item written by a former tx in block. They can't be
+	// executed in parallel with the writer.
+	DependentTxs int `json:"dependentTxs"`
+	// MaxWriters is the largest number of txs which wrote the same item
+	MaxWriters int `json:"maxWriters"`
+}
+
+// accessRecorder records the read and write sets of txs executed on a block state. Accesses made out of
+// BeginTx and EndTx, like block reward, are not recorded. Preloading of the next tx is attributed to the
+// current tx, which may only cause false conflicts.
+type accessRecorder struct {
+	lock    sync.Mutex
+	mv      *MVStore
+	sets    []*TxAccessSet
+	current *TxAccessSet
+}
+
+func newAccessRecorder() *accessRecorder {
+	return &accessRecorder{mv: NewMVStore()}
+}
+
+func (r *accessRecorder) beginTx(txIdx int) {
+	r.lock.Lock()
+	defer r.lock.Unlock()
+	r.current = newTxAccessSet(txIdx)
+}
+
+func (r *accessRecorder) endTx() {
+	r.lock.Lock()
+	defer r.lock.Unlock()
+	if r.current == nil {
+		return
+	}
+	for key := range r.current.Writes {
+		r.mv.Write(key, r.current.TxIdx, nil)
+	}
+	r.sets = append(r.sets, r.current)
+	r.current = nil
+}
+
+func (r *accessRecorder) read(key AccessKey) {
+	if r == nil {
+		return
+	}
+	r.lock.Lock()
+	defer r.lock.Unlock()
+	if r.current == nil {
+		return
+	}
+	if _, written := r.current.Writes[key]; written {
+		return
+	}
+	if _, exist := r.current.Reads[key]; !exist {
+		_, r.current.Reads[key] = r.mv.Read(key, r.current.TxIdx)
+	}
+}
+
+func (r *accessRecorder) write(key AccessKey) {
+	if r == nil {
+		return
+	}
+	r.lock.Lock()
+	defer r.lock.Unlock()
+	if r.current != nil {
+		r.current.Writes[key] = struct{}{}
+	}
+}
+
+func (r *accessRecorder) readAccount(id types.AccountID) {
+	r.read(AccessKey{Account: id})
+}
+
+func (r *accessRecorder) writeAccount(id types.AccountID) {
+	r.write(AccessKey{Account: id})
+}
+
+func (r *accessRecorder) stats() AccessStats {
+	r.lock.Lock()
+	defer r.lock.Unlock()
+	stats := AccessStats{Txs: len(r.sets)}
+	keys := map[AccessKey]int{}
+	for _, set := range r.sets {
+		stats.Reads += len(set.Reads)
+		stats.Writes += len(set.Writes)
+		dependent := false
+		for key, version := range set.Reads {
+			if _, exist := keys[key]; !exist {
+				keys[key] = 0
+			}
+			if version != BaseVersion {
+				dependent = true
+			}
+		}
+		if dependent {
+			stats.DependentTxs++
+		}
+		for key := range set.Writes {
+			keys[key]++
+		}
+	}
+	for key, writers := range keys {
+		if key.IsStorage() {
+			stats.StorageKeys++
+		} else {
+			stats.Accounts++
+		}
+		if writers > stats.MaxWriters {
+			stats.MaxWriters = writers
+		}
+	}
+	return stats
+}
@@ -0,0 +1,81 @@
+package state
+
+import (
+	"testing"
+
+	"github.com/aergoio/aergo/types"
+	"github.com/stretchr/testify/assert"
+)
+
+func TestMVStore(t *testing.T) {
+	key := AccessKey{Account: testAccount}
+	mv := NewMVStore()
+
+	_, version := mv.Read(key, 3)
+	assert.Equal(t, BaseVersion, version)
+
+	mv.Write(key, 5, "v5")
+	mv.Write(key, 1, "v1")
+	mv.Write(key, 3, "v3")
+	for _, tt := range []struct {
+		txIdx   int
+		value   interface{}
+		version int
+	}{
+		{0, nil, BaseVersion}, {1, nil, BaseVersion}, {2, "v1", 1}, {3, "v1", 1}, {4, "v3", 3}, {9, "v5", 5},
+	} {
+		value, version := mv.Read(key, tt.txIdx)
+		assert.Equal(t, tt.value, value, "txIdx=%d", tt.txIdx)
+		assert.Equal(t, tt.version, version, "txIdx=%d", tt.txIdx)
+	}
+
+	set := &TxAccessSet{TxIdx: 4, Reads: map[AccessKey]int{key: 3}}
+	assert.True(t, mv.Validate(set))
+	// tx 3 is aborted, so tx 4 read a wrong version
+	mv.Delete(key, 3)
+	assert.False(t, mv.Validate(set))
+	set.Reads[key] = 1
+	assert.True(t, mv.Validate(set))
+}
+
+func TestBlockStateRecordAccess(t *testing.T) {
+	initTest(t)
+	defer deinitTest()
+
+	other := types.ToAccountID([]byte("other"))
+	bs := NewBlockState(stateDB, RecordAccess())
+
+	// tx 0 writes account and storage of contract
+	bs.BeginTxAccess(0)
+	_, _ = bs.GetAccountState(testAccount)
+	_ = bs.PutState(testAccount, &testStates[0])
+	cs, err := bs.OpenContractStateAccount(testAccount)
+	assert.NoError(t, err)
+	_ = cs.SetData([]byte("key"), []byte("value"))
+	bs.EndTxAccess()
+
+	// tx 1 reads them, and the other account
+	bs.BeginTxAccess(1)
+	_, _ = bs.GetAccountState(testAccount)
+	_, _ = bs.GetAccountState(other)
+	cs, _ = bs.OpenContractStateAccount(testAccount)
+	_, _ = cs.GetData([]byte("key"))
+	bs.EndTxAccess()
+
+	// accesses out of tx are not recorded
+	_ = bs.PutState(other, &testStates[1])
+
+	sets := bs.TxAccessSets()
+	assert.Equal(t, 2, len(sets))
+	storageKey := AccessKey{Account: testAccount, Storage: types.GetHashID([]byte("key"))}
+	assert.Equal(t, map[AccessKey]int{{Account: testAccount}: BaseVersion}, sets[0].Reads)
+	assert.Equal(t, 2, len(sets[0].Writes))
+	assert.Equal(t, map[AccessKey]int{{Account: testAccount}: 0, {Account: other}: BaseVersion, storageKey: 0}, sets[1].Reads)
+	assert.Empty(t, sets[1].Writes)
+	assert.True(t, bs.AccessVersions().Validate(sets[1]))
+
+	stats := bs.AccessStats()
+	assert.Equal(t, AccessStats{Txs: 2, Reads: 4, Writes: 2, Accounts: 2, StorageKeys: 1, DependentTxs: 1, MaxWriters: 1}, *stats)
+
+	assert.Nil(t, NewBlockState(stateDB).AccessStats())
+}
@@ -0,0 +1,177 @@
+/**
+ *  @file
+ *  @copyright defined in aergo/LICENSE.txt
+ */
+
+package state
+
+import (
+	"sync"
+	"sync/atomic"
+
+	"github.com/aergoio/aergo/types"
+	lru "github.com/hashicorp/golang-lru"
+)
+
+const (
+	// maxSnapshotLayers is the number of recent state roots whose changes are kept in diff layers.
+	// Changes of older roots are flattened into the base layer.
+	maxSnapshotLayers = 128
+	// snapshotBaseSize is the number of account states kept in the base layer
+	snapshotBaseSize = 1 << 17
+)
+
+// snapshotLayer is the account states changed by a committed state root.
+type snapshotLayer struct {
+	root types.HashID
+	// parent is nil if the layer is on top of the base layer
+	parent   *snapshotLayer
+	depth    int
+	accounts map[types.AccountID][]byte
+}
+
+// snapshotTree is a flat account id -> marshaled account state view of recently committed state roots,
+// so that reading an account state doesn't need to traverse the state trie.
+// The base layer caches account states at baseRoot, and diff layers on it keep the changes
+// of each committed state root, including roots of side branches for reorganization.
+// A nil value means that the account doesn't exist.
+type snapshotTree struct {
+	lock     sync.RWMutex
+	baseRoot types.HashID
+	base     *lru.Cache
+	layers   map[types.HashID]*snapshotLayer
+
+	hits   uint64
+	misses uint64
+}
+
+func newSnapshotTree(root []byte) *snapshotTree {
+	base, _ := lru.New(snapshotBaseSize)
+	return &snapshotTree{
+		baseRoot: types.ToHashID(root),
+		base:     base,
+		layers:   map[types.HashID]*snapshotLayer{},
+	}
+}
+
+// get returns the marshaled account state at the state root. found is false if the snapshot doesn't know it.
+func (t *snapshotTree) get(root []byte, id types.AccountID) (value []byte, found bool) {
+	t.lock.RLock()
+	defer t.lock.RUnlock()
+	if value, found = t.lookup(types.ToHashID(root), id); found {
+		atomic.AddUint64(&t.hits, 1)
+	} else {
+		atomic.AddUint64(&t.misses, 1)
+	}
+	return
+}
+
+// lookup must be called with lock
+func (t *snapshotTree) lookup(root types.HashID, id types.AccountID) ([]byte, bool) {
+	if root != t.baseRoot {
+		layer, exist := t.layers[root]
+		if !exist {
+			return nil, false
+		}
+		for ; layer != nil; layer = layer.parent {
+			if value, changed := layer.accounts[id]; changed {
+				return value, true
+			}
+		}
+	}
+	if value, cached := t.base.Get(id); cached {
+		return value.([]byte), true
+	}
+	return nil, false
+}
+
+// fill caches the account state read from the state trie at root. It is ignored if root is unknown, or the
+// account state is changed in diff layers of root.
+func (t *snapshotTree) fill(root []byte, id types.AccountID, value []byte) {
+	t.lock.Lock()
+	defer t.lock.Unlock()
+	rid := types.ToHashID(root)
+	if rid != t.baseRoot {
+		layer, exist := t.layers[rid]
+		if !exist {
+			return
+		}
+		for ; layer != nil; layer = layer.parent {
+			if _, changed := layer.accounts[id]; changed {
+				return
+			}
+		}
+	}
+	t.base.Add(id, value)
+}
+
+// add pushes a diff layer of a committed state root on its parent root. The snapshot is rebuilt from root if
+// parent is unknown, like after a reorganization deeper than maxSnapshotLayers.
+func (t *snapshotTree) add(parent, root []byte, accounts map[types.AccountID][]byte) {
+	t.lock.Lock()
+	defer t.lock.Unlock()
+	pid, rid := types.ToHashID(parent), types.ToHashID(root)
+	if pid == rid {
+		return
+	}
+	layer := &snapshotLayer{root: rid, depth: 1, accounts: accounts}
+	if pid != t.baseRoot {
+		parentLayer, exist := t.layers[pid]
+		if !exist {
+			logger.Debug().Str("parent", pid.String()).Str("root", rid.String()).Msg("reset state snapshot")
+			t.base.Purge()
+			t.baseRoot = pid
+			t.layers = map[types.HashID]*snapshotLayer{}
+		} else {
+			layer.parent = parentLayer
+			layer.depth = parentLayer.depth + 1
+		}
+	}
+	t.layers[rid] = layer
+	if layer.depth > maxSnapshotLayers {
+		t.flatten(layer)
+	}
+}
+
+// flatten merges the bottom diff layer under top into the base layer, and drops diff layers of
+// the other branches. it must be called with lock.
+func (t *snapshotTree) flatten(top *snapshotLayer) {
+	bottom := top
+	for bottom.parent != nil {
+		bottom = bottom.parent
+	}
+	for id, value := range bottom.accounts {
+		t.base.Add(id, value)
+	}
+	t.baseRoot = bottom.root
+	delete(t.layers, bottom.root)
+
+	for rid, layer := range t.layers {
+		l := layer
+		for l.parent != nil && l.parent != bottom {
+			l = l.parent
+		}
+		if l.parent == nil {
+			// layer is on the other branch of the old base
+			delete(t.layers, rid)
+		}
+	}
+	for _, layer := range t.layers {
+		if layer.parent == bottom {
+			layer.parent = nil
+		}
+		layer.depth--
+	}
+}
+
+// Stats returns hit and miss counters of the snapshot and the number of layers
+func (t *snapshotTree) Stats() map[string]interface{} {
+	t.lock.RLock()
+	defer t.lock.RUnlock()
+	return map[string]interface{}{
+		"hits":     atomic.LoadUint64(&t.hits),
+		"misses":   atomic.LoadUint64(&t.misses),
+		"layers":   len(t.layers),
+		"accounts": t.base.Len(),
+	}
+}
@@ -0,0 +1,122 @@
+package state
+
+import (
+	"fmt"
+	"testing"
+
+	"github.com/aergoio/aergo/internal/common"
+	"github.com/aergoio/aergo/types"
+	"github.com/stretchr/testify/assert"
+)
+
+func testSnapshotRoot(i int) []byte {
+	return common.Hasher([]byte(fmt.Sprintf("root%d", i)))
+}
+
+func TestSnapshotTreeLayers(t *testing.T) {
+	accountA := types.ToAccountID([]byte("accountA"))
+	accountB := types.ToAccountID([]byte("accountB"))
+	base := testSnapshotRoot(0)
+	tree := newSnapshotTree(base)
+
+	// unknown accounts are read from trie and filled in base
+	_, found := tree.get(base, accountA)
+	assert.False(t, found)
+	tree.fill(base, accountA, []byte("a0"))
+	value, found := tree.get(base, accountA)
+	assert.True(t, found)
+	assert.Equal(t, []byte("a0"), value)
+
+	// diff layers
+	tree.add(base, testSnapshotRoot(1), map[types.AccountID][]byte{accountA: []byte("a1")})
+	tree.add(testSnapshotRoot(1), testSnapshotRoot(2), map[types.AccountID][]byte{accountB: []byte("b2")})
+	// side branch on root1
+	tree.add(testSnapshotRoot(1), testSnapshotRoot(102), map[types.AccountID][]byte{accountA: nil})
+
+	value, _ = tree.get(testSnapshotRoot(2), accountA)
+	assert.Equal(t, []byte("a1"), value)
+	value, _ = tree.get(testSnapshotRoot(2), accountB)
+	assert.Equal(t, []byte("b2"), value)
+	value, found = tree.get(testSnapshotRoot(102), accountA)
+	assert.True(t, found)
+	assert.Nil(t, value)
+	value, _ = tree.get(base, accountA)
+	assert.Equal(t, []byte("a0"), value)
+
+	// changed account in diff layers is not filled in base
+	tree.fill(testSnapshotRoot(2), accountA, []byte("wrong"))
+	value, _ = tree.get(base, accountA)
+	assert.Equal(t, []byte("a0"), value)
+	// unknown root is not filled
+	tree.fill(testSnapshotRoot(999), accountB, []byte("wrong"))
+	_, found = tree.get(base, accountB)
+	assert.False(t, found)
+}
+
+func TestSnapshotTreeFlatten(t *testing.T) {
+	accountA := types.ToAccountID([]byte("accountA"))
+	tree := newSnapshotTree(testSnapshotRoot(0))
+	// side branch of the first root
+	tree.add(testSnapshotRoot(0), testSnapshotRoot(-1), map[types.AccountID][]byte{accountA: []byte("side")})
+	for i := 1; i <= maxSnapshotLayers+10; i++ {
+		tree.add(testSnapshotRoot(i-1), testSnapshotRoot(i), map[types.AccountID][]byte{accountA: []byte(fmt.Sprint(i))})
+	}
+	assert.Equal(t, maxSnapshotLayers, len(tree.layers))
+	assert.Equal(t, types.ToHashID(testSnapshotRoot(10)), tree.baseRoot)
+	_, found := tree.get(testSnapshotRoot(-1), accountA)
+	assert.False(t, found)
+	for i := 10; i <= maxSnapshotLayers+10; i++ {
+		value, found := tree.get(testSnapshotRoot(i), accountA)
+		assert.True(t, found)
+		assert.Equal(t, []byte(fmt.Sprint(i)), value)
+	}
+
+	// parent is unknown after deep reorganization
+	tree.add(testSnapshotRoot(5), testSnapshotRoot(1005), map[types.AccountID][]byte{accountA: []byte("reorg")})
+	assert.Equal(t, 1, len(tree.layers))
+	_, found = tree.get(testSnapshotRoot(5), accountA)
+	assert.False(t, found)
+	value, _ := tree.get(testSnapshotRoot(1005), accountA)
+	assert.Equal(t, []byte("reorg"), value)
+}
+
+func TestStateDBSnapshot(t *testing.T) {
+	initTest(t)
+	defer deinitTest()
+
+	for _, v := range testStates {
+		_ = stateDB.PutState(testAccount, &v)
+	}
+	_ = stateDB.Update()
+	_ = stateDB.Commit()
+	for _, v := range testSecondStates {
+		_ = stateDB.PutState(testAccount, &v)
+	}
+	_ = stateDB.Update()
+	_ = stateDB.Commit()
+
+	// states of both roots are read from snapshot without trie
+	hits := chainStateDB.snapshot.hits
+	anotherStateDB := chainStateDB.OpenNewStateDB(testRoot)
+	st, err := anotherStateDB.GetAccountState(testAccount)
+	assert.NoError(t, err)
+	assert.True(t, stateEquals(&testStates[4], st))
+	st, err = stateDB.GetAccountState(testAccount)
+	assert.NoError(t, err)
+	assert.True(t, stateEquals(&testSecondStates[2], st))
+	assert.Equal(t, hits+2, chainStateDB.snapshot.hits)
+
+	// modifying returned state doesn't change snapshot
+	st.Nonce = 100
+	st, _ = stateDB.GetAccountState(testAccount)
+	assert.True(t, stateEquals(&testSecondStates[2], st))
+
+	// non existing account is cached after reading trie
+	unknown := types.ToAccountID([]byte("unknown"))
+	st, err = stateDB.GetState(unknown)
+	assert.NoError(t, err)
+	assert.Nil(t, st)
+	value, found := chainStateDB.snapshot.get(testSecondRoot, unknown)
+	assert.True(t, found)
+	assert.Nil(t, value)
+}
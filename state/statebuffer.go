@@ -196,6 +196,27 @@ func (buffer *stateBuffer) stage(txn trie.DbTx) error {
 	return nil
 }
 
+// exportAccounts returns marshaled latest account states in buffer. nil value means that the account is deleted.
+func (buffer *stateBuffer) exportAccounts() (map[types.AccountID][]byte, error) {
+	accounts := make(map[types.AccountID][]byte, len(buffer.indexes))
+	for key, v := range buffer.indexes {
+		et := buffer.entries[v.peek()]
+		if et.Value() == nil {
+			accounts[types.AccountID(key)] = nil
+			continue
+		}
+		buf, err := marshal(et.Value())
+		if err != nil {
+			return nil, err
+		}
+		if buf == nil {
+			buf = []byte{}
+		}
+		accounts[types.AccountID(key)] = buf
+	}
+	return accounts, nil
+}
+
 func marshal(data interface{}) ([]byte, error) {
 	switch data.(type) {
 	case ([]byte):
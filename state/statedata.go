@@ -62,6 +62,14 @@ func loadData(store db.DB, key []byte, data interface{}) error {
 	return err
 }
 
+func unmarshalState(value []byte) (*types.State, error) {
+	data := &types.State{}
+	if err := proto.Unmarshal(value, data); err != nil {
+		return nil, err
+	}
+	return data, nil
+}
+
 func (states *StateDB) loadStateData(key []byte) (*types.State, error) {
 	if len(key) == 0 {
 		return nil, errLoadStateData
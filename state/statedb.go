@@ -10,6 +10,7 @@ import (
 	"errors"
 	"fmt"
 	"math/big"
+	"sort"
 	"sync"
 
 	"github.com/aergoio/aergo-lib/db"
@@ -64,6 +65,12 @@ type StateDB struct {
 	store    db.DB
 	batchtx  db.Transaction
 	testmode bool
+	// snap is the flat view of recent account states shared by statedbs of a chain. It can be nil.
+	snap *snapshotTree
+	// snapRoot is the last committed root, which is the parent of the diff layer of next commit
+	snapRoot []byte
+	// access records read and write sets of txs if it is not nil
+	access *accessRecorder
 }
 
 // NewStateDB craete StateDB instance
@@ -74,6 +81,7 @@ func NewStateDB(dbstore db.DB, root []byte, test bool) *StateDB {
 		trie:     trie.NewTrie(root, common.Hasher, dbstore),
 		store:    dbstore,
 		testmode: test,
+		snapRoot: root,
 	}
 	return &sdb
 }
@@ -83,7 +91,9 @@ func (states *StateDB) Clone() *StateDB {
 	states.lock.RLock()
 	defer states.lock.RUnlock()
 
-	return NewStateDB(states.store, states.GetRoot(), states.testmode)
+	sdb := NewStateDB(states.store, states.GetRoot(), states.testmode)
+	sdb.snap = states.snap
+	return sdb
 }
 
 // GetRoot returns root hash of trie
@@ -99,6 +109,7 @@ func (states *StateDB) SetRoot(root []byte) error {
 	defer states.lock.Unlock()
 	// update root node
 	states.trie.Root = root
+	states.snapRoot = root
 	// reset buffer
 	return states.buffer.reset()
 }
@@ -113,6 +124,7 @@ func (states *StateDB) LoadCache(root []byte) error {
 	if err != nil {
 		return err
 	}
+	states.snapRoot = root
 	// reset buffer
 	return states.buffer.reset()
 }
@@ -134,6 +146,7 @@ func (states *StateDB) Revert(root types.HashID) error {
 	// just update root node as targetRoot.
 	// revert trie consumes unnecessarily long time.
 	states.trie.Root = root.Bytes()
+	states.snapRoot = states.trie.Root
 
 	// reset buffer
 	return states.buffer.reset()
@@ -146,6 +159,7 @@ func (states *StateDB) PutState(id types.AccountID, state *types.State) error {
 	if id == emptyAccountID {
 		return errPutState
 	}
+	states.access.writeAccount(id)
 	states.buffer.put(newValueEntry(types.HashID(id), state))
 	return nil
 }
@@ -317,6 +331,7 @@ func (states *StateDB) GetState(id types.AccountID) (*types.State, error) {
 	if id == emptyAccountID {
 		return nil, errGetState
 	}
+	states.access.readAccount(id)
 	return states.getState(id)
 }
 
@@ -331,17 +346,40 @@ func (states *StateDB) getState(id types.AccountID) (*types.State, error) {
 	return states.getTrieState(id)
 }
 
-// getTrieState gets state of account id from trie.
+// getTrieState gets state of account id from snapshot or trie.
 // nil value is returned when there is no state corresponding to account id.
 func (states *StateDB) getTrieState(id types.AccountID) (*types.State, error) {
+	if states.snap != nil {
+		if value, found := states.snap.get(states.trie.Root, id); found {
+			if value == nil {
+				return nil, nil
+			}
+			return unmarshalState(value)
+		}
+	}
 	key, err := states.trie.Get(id[:])
 	if err != nil {
 		return nil, err
 	}
 	if key == nil || len(key) == 0 {
+		if states.snap != nil {
+			states.snap.fill(states.trie.Root, id, nil)
+		}
 		return nil, nil
 	}
-	return states.loadStateData(key)
+	if states.snap == nil {
+		return states.loadStateData(key)
+	}
+	value := states.store.Get(key)
+	if value == nil {
+		value = []byte{}
+	}
+	st, err := unmarshalState(value)
+	if err != nil {
+		return nil, err
+	}
+	states.snap.fill(states.trie.Root, id, value)
+	return st, nil
 }
 
 func (states *StateDB) TrieQuery(id []byte, root []byte, compressed bool) ([]byte, [][]byte, int, bool, []byte, []byte, error) {
@@ -402,6 +440,51 @@ func (states *StateDB) GetVarAndProof(id []byte, root []byte, compressed bool) (
 
 }
 
+// GetVarsAndMultiProof gets the values of variables in the given contract trie root, and a proof of them
+// which shares the audit path. The proofs of variables are sorted by key, and duplicated keys are removed.
+func (states *StateDB) GetVarsAndMultiProof(ids [][]byte, root []byte) (*types.ContractVarMultiProof, error) {
+	keys := append([][]byte(nil), ids...)
+	sort.Sort(trie.DataArray(keys))
+	uniqueKeys := keys[:0]
+	for i, key := range keys {
+		if i == 0 || !bytes.Equal(keys[i-1], key) {
+			uniqueKeys = append(uniqueKeys, key)
+		}
+	}
+
+	states.lock.RLock()
+	defer states.lock.RUnlock()
+	if len(root) == 0 {
+		root = states.trie.Root
+	}
+	mp, err := states.trie.MerkleMultiProofR(uniqueKeys, root)
+	if err != nil {
+		return nil, err
+	}
+	varProofs := make([]*types.ContractVarProof, len(uniqueKeys))
+	for i, leaf := range mp.Leaves {
+		varProof := &types.ContractVarProof{
+			Key:       uniqueKeys[i],
+			Inclusion: leaf.Included,
+			ProofKey:  leaf.ProofKey,
+			ProofVal:  leaf.ProofVal,
+			Height:    uint32(leaf.Height),
+		}
+		if leaf.Included {
+			value := []byte{}
+			if err := loadData(states.store, leaf.ProofVal, &value); err != nil {
+				return nil, err
+			}
+			// proofVal is only not nil for prooving exclusion with another leaf on the path
+			varProof.Value = value
+			varProof.ProofVal = nil
+		}
+		varProofs[i] = varProof
+	}
+	logger.Debug().Str("contract root : ", enc.ToString(root)).Int("vars", len(varProofs)).Msg("Get contract variables and multi proof")
+	return &types.ContractVarMultiProof{Bitmap: mp.Bitmap, AuditPath: mp.AuditPath, VarProofs: varProofs}, nil
+}
+
 // GetAccountAndProof gets the state and associated proof of an account
 // in the given trie root. If the account doesnt exist, a proof of
 // non existence is returned.
@@ -502,6 +585,14 @@ func (states *StateDB) Commit() error {
 	states.lock.Lock()
 	defer states.lock.Unlock()
 
+	var accounts map[types.AccountID][]byte
+	if states.snap != nil {
+		// export changes before staging resets buffer
+		var err error
+		if accounts, err = states.buffer.exportAccounts(); err != nil {
+			return err
+		}
+	}
 	bulk := states.store.NewBulk()
 	for _, storage := range states.cache.storages {
 		// stage changes
@@ -515,6 +606,10 @@ func (states *StateDB) Commit() error {
 		return err
 	}
 	bulk.Flush()
+	if states.snap != nil {
+		states.snap.add(states.snapRoot, states.trie.Root, accounts)
+	}
+	states.snapRoot = states.trie.Root
 	return nil
 }
 
@@ -0,0 +1,299 @@
+/**
+ *  @file
+ *  @copyright defined in aergo/LICENSE.txt
+ */
+
+package state
+
+import (
+	"bytes"
+	"errors"
+	"fmt"
+	"sync"
+
+	"github.com/aergoio/aergo/internal/common"
+	"github.com/aergoio/aergo/internal/enc"
+	"github.com/aergoio/aergo/pkg/trie"
+	"github.com/aergoio/aergo/types"
+)
+
+// State sync transfers the state of a block from other nodes by chunks of trie leaves, instead of replaying all
+// blocks from genesis. A chunk has the raw values of leaves and a range proof against the trusted root, which
+// proves the leaves are all the leaves of the trie in the range of the chunk. So a forged chunk is rejected when it
+// is received, and the trie rebuilt from chunks is compared with the root at last only to check nothing is missed.
+// Sql databases of contracts are out of the trie, so they are listed by the importer to be transferred as files.
+var (
+	ErrStateChunkOrder  = errors.New("keys of state chunk are not in order or out of range")
+	ErrStateChunkValue  = errors.New("value of state chunk doesn't match its hash")
+	ErrStateChunkProof  = errors.New("range proof of state chunk is invalid")
+	ErrStateChunkCode   = errors.New("contract code of state chunk is missing or doesn't match its hash")
+	ErrStateRootNotSame = errors.New("root of imported state is different from the requested root")
+)
+
+// StateChunk is a range of leaves of a state trie with their values
+type StateChunk struct {
+	Keys [][]byte
+	// Values are marshaled account states of the account trie, or contract variables of a storage trie.
+	Values [][]byte
+	// Codes are contract codes of accounts in the chunk of the account trie
+	Codes [][]byte
+	// Next is the first key after the chunk in the requested range, or nil if the range is done
+	Next []byte
+	// Proof is the range proof of the keys from the start of the requested range to Next, or the end of the range
+	// if Next is nil. The values of keys are left out of it.
+	Proof *types.ContractVarMultiProof
+}
+
+// GetStateChunk reads up to limit leaves of the trie at root in [start, end). accounts must be true if root is the
+// root of accounts, to add contract codes to the chunk.
+func (sdb *ChainStateDB) GetStateChunk(root, start, end []byte, limit int, accounts bool) (*StateChunk, error) {
+	tr := trie.NewTrie(root, common.Hasher, sdb.store)
+	keys, hashes, next, err := tr.GetRange(root, start, end, limit)
+	if err != nil {
+		return nil, err
+	}
+	mp, err := tr.MerkleRangeProof(root, start, chunkEnd(end, next), keys)
+	if err != nil {
+		return nil, err
+	}
+
+	chunk := &StateChunk{Keys: keys, Values: make([][]byte, len(hashes)), Next: next, Proof: rangeProofToPb(mp)}
+	codes := make(map[string]bool)
+	for i, hash := range hashes {
+		value := sdb.store.Get(hash)
+		if value == nil {
+			return nil, fmt.Errorf("value of state is not found: key=%s", enc.ToString(keys[i]))
+		}
+		chunk.Values[i] = value
+		if !accounts {
+			continue
+		}
+
+		st, err := unmarshalState(value)
+		if err != nil {
+			return nil, err
+		}
+		if len(st.CodeHash) == 0 || codes[string(st.CodeHash)] {
+			continue
+		}
+		code := sdb.store.Get(st.CodeHash)
+		if code == nil {
+			return nil, fmt.Errorf("contract code is not found: key=%s", enc.ToString(keys[i]))
+		}
+		codes[string(st.CodeHash)] = true
+		chunk.Codes = append(chunk.Codes, code)
+	}
+	return chunk, nil
+}
+
+// chunkEnd returns the end of the range proven by a chunk
+func chunkEnd(end, next []byte) []byte {
+	if len(next) != 0 {
+		return next
+	}
+	return end
+}
+
+func rangeProofToPb(mp *trie.MultiProof) *types.ContractVarMultiProof {
+	proofs := make([]*types.ContractVarProof, len(mp.Leaves))
+	for i, leaf := range mp.Leaves {
+		proofs[i] = &types.ContractVarProof{
+			Inclusion: leaf.Included,
+			ProofKey:  leaf.ProofKey,
+			ProofVal:  leaf.ProofVal,
+			Height:    uint32(leaf.Height),
+		}
+	}
+	return &types.ContractVarMultiProof{Bitmap: mp.Bitmap, AuditPath: mp.AuditPath, VarProofs: proofs}
+}
+
+func rangeProofFromPb(proof *types.ContractVarMultiProof) *trie.MultiProof {
+	if proof == nil {
+		return nil
+	}
+	mp := &trie.MultiProof{Bitmap: proof.Bitmap, AuditPath: proof.AuditPath,
+		Leaves: make([]trie.MultiProofLeaf, len(proof.VarProofs))}
+	for i, leaf := range proof.VarProofs {
+		if leaf == nil {
+			return nil
+		}
+		mp.Leaves[i] = trie.MultiProofLeaf{
+			Height:   int(leaf.Height),
+			Included: leaf.Inclusion,
+			ProofKey: leaf.ProofKey,
+			ProofVal: leaf.ProofVal,
+		}
+	}
+	return mp
+}
+
+// ContractStorage is the storage trie of a contract account found in account chunks
+type ContractStorage struct {
+	// Account is the key of the contract in the account trie
+	Account []byte
+	Root    []byte
+}
+
+// ContractSQL is the sql database of a contract account found in account chunks. The database is kept out of the
+// state trie, and only its recovery point is in the account state.
+type ContractSQL struct {
+	// Account is the key of the contract in the account trie
+	Account       []byte
+	RecoveryPoint uint64
+}
+
+// StateImporter rebuilds a state trie of the given root from chunks. Chunks of different ranges can be added
+// concurrently and in any order.
+type StateImporter struct {
+	lock     sync.Mutex
+	sdb      *ChainStateDB
+	root     []byte
+	accounts bool
+	trie     *trie.Trie
+	// storages are contract storage tries found in account chunks
+	storages []ContractStorage
+	// sqls are sql databases of contracts found in account chunks
+	sqls   []ContractSQL
+	leaves int
+}
+
+// NewStateImporter returns the importer of the account trie if accounts is true, or a contract storage trie.
+func (sdb *ChainStateDB) NewStateImporter(root []byte, accounts bool) *StateImporter {
+	return &StateImporter{
+		sdb:      sdb,
+		root:     root,
+		accounts: accounts,
+		trie:     trie.NewTrie(nil, common.Hasher, sdb.store),
+	}
+}
+
+// Add verifies the chunk read from [start, end) by its range proof and writes it to the state db.
+func (im *StateImporter) Add(start, end []byte, chunk *StateChunk) error {
+	if len(chunk.Keys) != len(chunk.Values) {
+		return ErrStateChunkValue
+	}
+	hashes := make([][]byte, len(chunk.Values))
+	for i, key := range chunk.Keys {
+		if len(key) != trie.HashLength ||
+			(i == 0 && len(start) != 0 && bytes.Compare(key, start) < 0) ||
+			(i > 0 && bytes.Compare(chunk.Keys[i-1], key) >= 0) ||
+			(len(end) != 0 && bytes.Compare(key, end) >= 0) {
+			return ErrStateChunkOrder
+		}
+		hashes[i] = common.Hasher(chunk.Values[i])
+	}
+	// next must be after the chunk to continue the range
+	if len(chunk.Next) != 0 && (len(chunk.Keys) == 0 ||
+		bytes.Compare(chunk.Next, chunk.Keys[len(chunk.Keys)-1]) <= 0 ||
+		(len(end) != 0 && bytes.Compare(chunk.Next, end) >= 0)) {
+		return ErrStateChunkOrder
+	}
+	tr := trie.NewTrie(im.root, common.Hasher, nil)
+	if !tr.VerifyRangeProof(rangeProofFromPb(chunk.Proof), start, chunkEnd(end, chunk.Next), chunk.Keys, hashes) {
+		return ErrStateChunkProof
+	}
+
+	var storages []ContractStorage
+	var sqls []ContractSQL
+	if im.accounts {
+		codes := make(map[string][]byte, len(chunk.Codes))
+		for _, code := range chunk.Codes {
+			codes[string(common.Hasher(code))] = code
+		}
+		for i, value := range chunk.Values {
+			st, err := unmarshalState(value)
+			if err != nil {
+				return err
+			}
+			// a contract is deployed with the recovery point 1, and its database has nothing until it moves
+			if st.SqlRecoveryPoint > 1 {
+				sqls = append(sqls, ContractSQL{Account: chunk.Keys[i], RecoveryPoint: st.SqlRecoveryPoint})
+			}
+			if len(st.StorageRoot) != 0 {
+				storages = append(storages, ContractStorage{Account: chunk.Keys[i], Root: st.StorageRoot})
+			}
+			if len(st.CodeHash) != 0 && codes[string(st.CodeHash)] == nil && !im.sdb.store.Exist(st.CodeHash) {
+				return ErrStateChunkCode
+			}
+		}
+		for hash, code := range codes {
+			im.sdb.store.Set([]byte(hash), code)
+		}
+	}
+
+	bulk := im.sdb.store.NewBulk()
+	for i, value := range chunk.Values {
+		bulk.Set(hashes[i], value)
+	}
+	bulk.Flush()
+
+	im.lock.Lock()
+	defer im.lock.Unlock()
+	if len(chunk.Keys) > 0 {
+		if _, err := im.trie.Update(chunk.Keys, hashes); err != nil {
+			return err
+		}
+		if err := im.trie.Commit(); err != nil {
+			return err
+		}
+	}
+	im.storages = append(im.storages, storages...)
+	im.sqls = append(im.sqls, sqls...)
+	im.leaves += len(chunk.Keys)
+	return nil
+}
+
+// Storages returns contract storage tries in account chunks added so far
+func (im *StateImporter) Storages() []ContractStorage {
+	im.lock.Lock()
+	defer im.lock.Unlock()
+	return im.storages
+}
+
+// SQLs returns sql databases of contracts in account chunks added so far
+func (im *StateImporter) SQLs() []ContractSQL {
+	im.lock.Lock()
+	defer im.lock.Unlock()
+	return im.sqls
+}
+
+// Leaves returns the number of imported leaves
+func (im *StateImporter) Leaves() int {
+	im.lock.Lock()
+	defer im.lock.Unlock()
+	return im.leaves
+}
+
+// Finish checks that the imported trie is the same as the requested root, which means all chunks are added. The root of accounts is marked as finalized, so the state can be opened by the chain.
+// Storage tries must be finished and sql databases imported before accounts.
+func (im *StateImporter) Finish() error {
+	im.lock.Lock()
+	defer im.lock.Unlock()
+
+	if !bytes.Equal(im.trie.Root, im.root) {
+		logger.Error().Str("expected", enc.ToString(im.root)).Str("imported", enc.ToString(im.trie.Root)).
+			Msg("failed to import state")
+		return ErrStateRootNotSame
+	}
+	if im.accounts {
+		im.sdb.store.Set(common.Hasher(im.root), stateMarker)
+	}
+	return nil
+}
+
+// IsStateImported returns true if the whole state of root is in the state db
+func (sdb *ChainStateDB) IsStateImported(root []byte) bool {
+	return sdb.GetStateDB().HasMarker(root)
+}
+
+// IsStorageImported returns true if root is the storage root of the contract at key of the imported state of
+// stateRoot.
+func (sdb *ChainStateDB) IsStorageImported(stateRoot, key, root []byte) bool {
+	if len(key) != types.HashIDLength || !sdb.IsStateImported(stateRoot) {
+		return false
+	}
+	var id types.AccountID
+	copy(id[:], key)
+	st, err := sdb.OpenNewStateDB(stateRoot).GetState(id)
+	return err == nil && st != nil && len(root) != 0 && bytes.Equal(st.StorageRoot, root)
+}
@@ -0,0 +1,119 @@
+package state
+
+import (
+	"fmt"
+	"io/ioutil"
+	"os"
+	"testing"
+
+	"github.com/aergoio/aergo-lib/db"
+	"github.com/aergoio/aergo/internal/common"
+	"github.com/aergoio/aergo/types"
+	"github.com/stretchr/testify/assert"
+)
+
+// importRange adds all leaves in [start, end) of the trie at root by chunks of limit
+func importRange(t *testing.T, src *ChainStateDB, im *StateImporter, root, start, end []byte, limit int, accounts bool) {
+	for {
+		chunk, err := src.GetStateChunk(root, start, end, limit, accounts)
+		assert.NoError(t, err)
+		assert.True(t, len(chunk.Keys) <= limit)
+		assert.NoError(t, im.Add(start, end, chunk))
+		if chunk.Next == nil {
+			return
+		}
+		start = chunk.Next
+	}
+}
+
+func TestStateSync(t *testing.T) {
+	initTest(t)
+	defer deinitTest()
+
+	for i := 0; i < 100; i++ {
+		id := types.ToAccountID([]byte(fmt.Sprintf("account%d", i)))
+		assert.NoError(t, stateDB.PutState(id, &types.State{Nonce: uint64(i), Balance: []byte{byte(i)}}))
+	}
+	contractID := types.ToAccountID([]byte("contract"))
+	contract, err := stateDB.OpenContractStateAccount(contractID)
+	assert.NoError(t, err)
+	assert.NoError(t, contract.SetCode([]byte("code")))
+	for i := 0; i < 50; i++ {
+		assert.NoError(t, contract.SetData([]byte(fmt.Sprintf("key%d", i)), []byte(fmt.Sprintf("value%d", i))))
+	}
+	assert.NoError(t, stateDB.StageContractState(contract))
+	assert.NoError(t, stateDB.Update())
+	assert.NoError(t, stateDB.Commit())
+	root := stateDB.GetRoot()
+
+	tmpdir, _ := ioutil.TempDir("", "statesync")
+	defer os.RemoveAll(tmpdir)
+	dst := NewChainStateDB()
+	assert.NoError(t, dst.Init(string(db.BadgerImpl), tmpdir, nil, false))
+	defer dst.Close()
+
+	// ranges of accounts are imported in any order
+	accounts := dst.NewStateImporter(root, true)
+	importRange(t, chainStateDB, accounts, root, []byte{0x80}, nil, 16, true)
+	assert.Equal(t, ErrStateRootNotSame, accounts.Finish())
+	importRange(t, chainStateDB, accounts, root, nil, []byte{0x80}, 16, true)
+	all, err := chainStateDB.GetStateChunk(root, nil, nil, 1000, true)
+	assert.NoError(t, err)
+	assert.Equal(t, len(all.Keys), accounts.Leaves())
+
+	storages := accounts.Storages()
+	assert.NotEmpty(t, storages)
+	for _, s := range storages {
+		storage := dst.NewStateImporter(s.Root, false)
+		importRange(t, chainStateDB, storage, s.Root, nil, nil, 16, false)
+		assert.NoError(t, storage.Finish())
+	}
+	assert.False(t, dst.IsStorageImported(root, storages[0].Account, storages[0].Root))
+	assert.NoError(t, accounts.Finish())
+	assert.True(t, dst.IsStateImported(root))
+	assert.True(t, dst.IsStorageImported(root, storages[0].Account, storages[0].Root))
+	assert.False(t, dst.IsStorageImported(root, storages[0].Account, root))
+
+	states := dst.OpenNewStateDB(root)
+	st, err := states.GetAccountState(types.ToAccountID([]byte("account7")))
+	assert.NoError(t, err)
+	assert.Equal(t, uint64(7), st.Nonce)
+	imported, err := states.OpenContractStateAccount(contractID)
+	assert.NoError(t, err)
+	code, err := imported.GetCode()
+	assert.NoError(t, err)
+	assert.Equal(t, []byte("code"), code)
+	value, err := imported.GetData([]byte("key7"))
+	assert.NoError(t, err)
+	assert.Equal(t, []byte("value7"), value)
+
+	// a forged or missing value is rejected by the range proof
+	storageRoot := imported.StorageRoot
+	forged := dst.NewStateImporter(storageRoot, false)
+	chunk, _ := chainStateDB.GetStateChunk(storageRoot, nil, nil, 100, false)
+	chunk.Values[0] = []byte("forged")
+	assert.Equal(t, ErrStateChunkProof, forged.Add(nil, nil, chunk))
+	chunk, _ = chainStateDB.GetStateChunk(storageRoot, nil, nil, 100, false)
+	chunk.Keys, chunk.Values = chunk.Keys[1:], chunk.Values[1:]
+	assert.Equal(t, ErrStateChunkProof, forged.Add(nil, nil, chunk))
+	chunk, _ = chainStateDB.GetStateChunk(storageRoot, nil, nil, 10, false)
+	chunk.Next = nil
+	assert.Equal(t, ErrStateChunkProof, forged.Add(nil, nil, chunk), "the rest of the range is missing")
+	chunk.Proof = nil
+	assert.Equal(t, ErrStateChunkProof, forged.Add(nil, nil, chunk))
+	assert.Equal(t, 0, forged.Leaves())
+
+	// sql databases of contracts are found with their recovery points
+	sqlID := types.ToAccountID([]byte("sqlcontract"))
+	assert.NoError(t, stateDB.PutState(sqlID, &types.State{CodeHash: common.Hasher([]byte("code")), SqlRecoveryPoint: 3}))
+	assert.NoError(t, stateDB.Update())
+	assert.NoError(t, stateDB.Commit())
+	chunk, _ = chainStateDB.GetStateChunk(stateDB.GetRoot(), nil, nil, 1000, true)
+	sqls := dst.NewStateImporter(stateDB.GetRoot(), true)
+	assert.NoError(t, sqls.Add(nil, nil, chunk))
+	assert.Equal(t, []ContractSQL{{Account: sqlID[:], RecoveryPoint: 3}}, sqls.SQLs())
+
+	// keys out of the requested range are rejected
+	chunk, _ = chainStateDB.GetStateChunk(root, nil, nil, 10, true)
+	assert.Equal(t, ErrStateChunkOrder, dst.NewStateImporter(root, true).Add([]byte{0xff}, nil, chunk))
+}
@@ -15,6 +15,31 @@ var (
 	checkpointKey = types.ToHashID([]byte("checkpoint"))
 )
 
+// storageNodeCache is the node cache shared by storage tries of all contracts. It is nil if disabled.
+var storageNodeCache *trie.NodeCache
+
+// InitStorageNodeCache sets up the node cache of contract storage tries, bounded by sizeMB megabytes. 0 disables the cache.
+func InitStorageNodeCache(sizeMB int) {
+	if sizeMB <= 0 {
+		storageNodeCache = nil
+		return
+	}
+	storageNodeCache = trie.NewNodeCache(sizeMB << 20)
+}
+
+// StorageNodeCacheStats returns hit, miss counters and size of the node cache of contract storage tries.
+func StorageNodeCacheStats() map[string]interface{} {
+	if storageNodeCache == nil {
+		return nil
+	}
+	return map[string]interface{}{
+		"hits":   storageNodeCache.Hits(),
+		"misses": storageNodeCache.Misses(),
+		"nodes":  storageNodeCache.Len(),
+		"bytes":  storageNodeCache.Bytes(),
+	}
+}
+
 type storageCache struct {
 	lock     sync.RWMutex
 	storages map[types.AccountID]*bufferedStorage
@@ -47,9 +72,13 @@ type bufferedStorage struct {
 }
 
 func newBufferedStorage(root []byte, store db.DB) *bufferedStorage {
+	storageTrie := trie.NewTrie(root, common.Hasher, store)
+	if storageNodeCache != nil {
+		storageTrie.SetNodeCache(storageNodeCache)
+	}
 	return &bufferedStorage{
 		buffer: newStateBuffer(),
-		trie:   trie.NewTrie(root, common.Hasher, store),
+		trie:   storageTrie,
 		dirty:  false,
 	}
 }
@@ -11,6 +11,7 @@ import (
 	"sync/atomic"
 	"time"
 
+	"github.com/aergoio/aergo/chain"
 	"github.com/aergoio/aergo/internal/enc"
 	"github.com/aergoio/aergo/message"
 	"github.com/aergoio/aergo/pkg/component"
@@ -56,6 +57,13 @@ type BlockFetcher struct {
 type BlockFetcherStat struct {
 	maxRspBlock  atomic.Value
 	lastAddBlock atomic.Value
+
+	// throughput of each stage of sync pipeline
+	fetch   StageStat
+	verify  StageStat
+	connect StageStat
+
+	peers atomic.Value // []PeerFetchStat
 }
 
 type SyncPeer struct {
@@ -63,6 +71,13 @@ type SyncPeer struct {
 	ID      types.PeerID
 	FailCnt int
 	IsErr   bool
+
+	// moving averages of blocks per second and response time of finished tasks
+	rate    float64
+	rspTime time.Duration
+	blocks  int
+	tasks   int
+	stolen  int
 }
 
 type TaskQueue struct {
@@ -102,6 +117,12 @@ type FetchTask struct {
 
 	started time.Time
 	retry   int
+
+	// twin is the copy of task running on another peer. stolen is true if this is the copy.
+	twin   *FetchTask
+	stolen bool
+	// cancelled is true if the copy on another peer is finished first. The response of it is dropped.
+	cancelled bool
 }
 
 type PeerSet struct {
@@ -111,6 +132,8 @@ type PeerSet struct {
 
 	freePeers *list.List
 	badPeers  *list.List
+
+	all []*SyncPeer
 }
 
 var (
@@ -120,6 +143,7 @@ var (
 	MaxPeerFailCount     = 3
 	DfltBlockFetchTasks  = 5
 	MaxBlockPendingTasks = 10
+	DfltPreVerifyBlocks  = 200
 )
 
 var (
@@ -143,6 +167,11 @@ func newBlockFetcher(ctx *types.SyncContext, compRequester component.IComponentR
 
 	bf.blockProcessor.connQueue = make([]*ConnectTask, 0, 16)
 
+	if cfg.maxPreVerifyBlocks > 0 && ctx.CommonAncestor != nil {
+		bf.blockProcessor.preVerifier = newTxPreVerifier(ctx.CommonAncestor.BlockNo(), cfg.maxPreVerifyBlocks,
+			cfg.numPreVerifiers, &bf.stat.verify)
+	}
+
 	bf.runningQueue.Init()
 	bf.pendingQueue.Init()
 	bf.retryQueue.Init()
@@ -283,6 +312,9 @@ func (bf *BlockFetcher) schedule() error {
 		curRunning := bf.runningQueue.Len()
 		if curRunning >= bf.maxFetchTasks {
 			//logger.Debug().Int("runnig", curRunning).Int("pending", bf.pendingQueue.Len()).Msg("max running")
+			if bf.stealTask(time.Now()) {
+				continue
+			}
 			return nil
 		}
 
@@ -293,6 +325,9 @@ func (bf *BlockFetcher) schedule() error {
 			return err
 		}
 		if candTask == nil {
+			if bf.stealTask(time.Now()) {
+				continue
+			}
 			return nil
 		}
 
@@ -300,6 +335,10 @@ func (bf *BlockFetcher) schedule() error {
 		//	if next task is retry task, must run. it can be next block to connect
 		curPendingConn := len(bf.blockProcessor.connQueue)
 		if curPendingConn >= bf.maxPendingConn && candTask.retry <= 0 {
+			// connect may be waiting for a delayed task
+			if bf.stealTask(time.Now()) {
+				continue
+			}
 			return nil
 		}
 
@@ -312,13 +351,14 @@ func (bf *BlockFetcher) schedule() error {
 			panic("free peer can't be nil")
 		}
 
-		bf.popNextTask(candTask)
-		if candTask == nil {
-			panic("task can't be nil")
+		// task is cut to the size of the peer, and the rest remains in queue
+		task := bf.splitTask(candTask, freePeer.chunkSize(bf.maxFetchSize))
+		if task == candTask {
+			bf.popNextTask(candTask)
 		}
 
 		logger.Debug().Int("pendingConn", curPendingConn).Int("running", curRunning).Msg("schedule")
-		bf.runTask(candTask, freePeer)
+		bf.runTask(task, freePeer)
 	}
 
 	return nil
@@ -339,6 +379,11 @@ func (bf *BlockFetcher) checkTaskTimeout() error {
 
 		bf.runningQueue.Remove(e)
 
+		if task.cancelled {
+			bf.dropCancelledTask(task)
+			continue
+		}
+
 		if err := bf.processFailedTask(task, false); err != nil {
 			return err
 		}
@@ -366,6 +411,16 @@ func (bf *BlockFetcher) processFailedTask(task *FetchTask, isErr bool) error {
 	logBadPeer(failPeer, bf.peers, bf.cfg)
 
 	bf.peers.processPeerFail(failPeer, isErr)
+	bf.updatePeerStats()
+
+	// the copy of task running on another peer is not retried
+	if twin := task.twin; twin != nil {
+		task.twin, twin.twin = nil, nil
+		if bf.peers.isAllBad() {
+			return ErrAllPeerBad
+		}
+		return nil
+	}
 
 	task.retry++
 	task.syncPeer = nil
@@ -599,6 +654,11 @@ func (bf *BlockFetcher) stop() {
 		bf.waitGroup.Wait()
 		bf.isRunning = false
 	}
+
+	if bf.blockProcessor.preVerifier != nil {
+		bf.blockProcessor.preVerifier.stop()
+		chain.ResetPreVerifiedTxs()
+	}
 	logger.Info().Msg("BlockFetcher stopped")
 }
 
@@ -616,6 +676,14 @@ func (stat *BlockFetcherStat) setLastAddBlock(block *types.Block) {
 	logger.Debug().Uint64("no", block.GetHeader().BlockNo).Msg("last block add response")
 }
 
+func (stat *BlockFetcherStat) stages() map[string]interface{} {
+	return map[string]interface{}{
+		"fetch":   stat.fetch.Map(),
+		"verify":  stat.verify.Map(),
+		"connect": stat.connect.Map(),
+	}
+}
+
 func (stat *BlockFetcherStat) getMaxChunkRsp() *types.Block {
 	aopv := stat.maxRspBlock.Load()
 	if aopv != nil {
@@ -653,7 +721,9 @@ func (ps *PeerSet) isAllBad() bool {
 
 func (ps *PeerSet) addNew(peerID types.PeerID) {
 	peerno := ps.total
-	ps.pushFree(&SyncPeer{No: peerno, ID: peerID})
+	peer := &SyncPeer{No: peerno, ID: peerID}
+	ps.pushFree(peer)
+	ps.all = append(ps.all, peer)
 	ps.total++
 
 	logger.Info().Str("peer", p2putil.ShortForm(peerID)).Int("peerno", peerno).Int("no", ps.total).Msg("new peer added")
@@ -676,7 +746,18 @@ func (ps *PeerSet) popFree() (*SyncPeer, error) {
 		return nil, ErrAllPeerBad
 	}
 
-	elem := ps.freePeers.Front()
+	// peers not measured yet are tried first, and then the fastest one
+	var elem *list.Element
+	for e := ps.freePeers.Front(); e != nil; e = e.Next() {
+		peer := e.Value.(*SyncPeer)
+		if !peer.measured() {
+			elem = e
+			break
+		}
+		if elem == nil || peer.rate > elem.Value.(*SyncPeer).rate {
+			elem = e
+		}
+	}
 	if elem == nil {
 		return nil, nil
 	}
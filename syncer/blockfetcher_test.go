@@ -2,9 +2,11 @@ package syncer
 
 import (
 	"github.com/aergoio/aergo/chain"
+	"github.com/aergoio/aergo/message"
 	"github.com/aergoio/aergo/types"
 	"github.com/stretchr/testify/assert"
 	"testing"
+	"time"
 )
 
 // test blockfetcher without finder/hashfetcher
@@ -99,3 +101,64 @@ func TestBlockFetcher_SortedQueue(t *testing.T) {
 	}
 	assert.Equal(t, 0, squeue.Len())
 }
+
+func TestBlockFetcher_Adaptive(t *testing.T) {
+	bf := &BlockFetcher{ctx: &types.SyncContext{}, compRequester: NewStubRequester(), peers: newPeerSet(), maxFetchSize: 100}
+	bf.runningQueue.Init()
+	bf.pendingQueue.Init()
+	bf.retryQueue.Init()
+
+	bf.peers.addNew(types.PeerID("slow"))
+	bf.peers.addNew(types.PeerID("fast"))
+	slow, fast := bf.peers.all[0], bf.peers.all[1]
+	slow.addMeasure(20, 2*time.Second)
+	fast.addMeasure(100, time.Second)
+
+	// chunk is sized to be fetched in DfltFetchTaskTime
+	assert.Equal(t, 20, slow.chunkSize(bf.maxFetchSize))
+	assert.Equal(t, bf.maxFetchSize, fast.chunkSize(bf.maxFetchSize))
+	assert.Equal(t, bf.maxFetchSize, (&SyncPeer{}).chunkSize(bf.maxFetchSize))
+
+	// the fastest free peer is picked
+	peer, _ := bf.peers.popFree()
+	assert.Equal(t, fast, peer)
+	bf.peers.pushFree(peer)
+
+	task := &FetchTask{count: 50, hashes: make([]message.BlockHash, 50), startNo: 1}
+	front := bf.splitTask(task, slow.chunkSize(bf.maxFetchSize))
+	assert.Equal(t, 20, front.count)
+	assert.Equal(t, uint64(1), front.startNo)
+	assert.Equal(t, 30, task.count)
+	assert.Equal(t, uint64(21), task.startNo)
+
+	// delayed task is stolen by a free peer
+	bf.peers.freePeers.Init()
+	bf.peers.free = 0
+	bf.runTask(front, slow)
+	bf.peers.pushFree(fast)
+	assert.False(t, bf.stealTask(time.Now()))
+	front.started = time.Now().Add(-time.Minute)
+	assert.True(t, bf.stealTask(time.Now()))
+	assert.Equal(t, 2, bf.runningQueue.Len())
+	stolen := front.twin
+	assert.Equal(t, fast, stolen.syncPeer)
+	assert.False(t, bf.stealTask(time.Now()))
+
+	// the first response cancels the other, whose peer stays busy until its response arrives
+	bf.runningQueue.Remove(bf.runningQueue.Back())
+	bf.finishTask(stolen)
+	assert.True(t, front.cancelled)
+	assert.Equal(t, 1, bf.runningQueue.Len())
+	assert.Equal(t, 1, bf.peers.free)
+	assert.Equal(t, 1, fast.stolen)
+	assert.Equal(t, 2, len(bf.stat.PeerStats()))
+	assert.False(t, bf.stealTask(time.Now()))
+
+	// late error response of the cancelled task is consumed without blaming the peer
+	bproc := &BlockProcessor{blockFetcher: bf}
+	err := bproc.GetBlockChunkRspError(&message.GetBlockChunksRsp{ToWhom: slow.ID, Err: message.RemotePeerFailError}, message.RemotePeerFailError)
+	assert.NoError(t, err)
+	assert.Equal(t, 0, bf.runningQueue.Len())
+	assert.Equal(t, 2, bf.peers.free)
+	assert.Equal(t, 0, slow.FailCnt)
+}
@@ -6,6 +6,7 @@ import (
 	"github.com/aergoio/aergo/chain"
 	"github.com/aergoio/aergo/p2p/p2putil"
 	"sort"
+	"time"
 
 	"github.com/aergoio/aergo/internal/enc"
 	"github.com/aergoio/aergo/message"
@@ -24,6 +25,11 @@ type BlockProcessor struct {
 
 	prevBlock *types.Block
 	curBlock  *types.Block
+	// time when curBlock is requested to be connected
+	curStarted time.Time
+
+	// preVerifier verifies txs of blocks in connQueue while curBlock is connected
+	preVerifier *TxPreVerifier
 
 	targetBlockNo types.BlockNo
 	name          string
@@ -143,9 +149,15 @@ func (bproc *BlockProcessor) GetBlockChunkRsp(msg *message.GetBlockChunksRsp) er
 		return nil
 	}
 
-	bf.pushFreePeer(task.syncPeer)
+	if task.cancelled {
+		bf.dropCancelledTask(task)
+		return nil
+	}
+
+	bf.finishTask(task)
 
 	bf.stat.setMaxChunkRsp(msg.Blocks[len(msg.Blocks)-1])
+	bf.stat.fetch.add(len(msg.Blocks), countTxs(msg.Blocks), time.Since(task.started))
 
 	bproc.addConnectTask(msg)
 
@@ -164,6 +176,11 @@ func (bproc *BlockProcessor) GetBlockChunkRspError(msg *message.GetBlockChunksRs
 		return nil
 	}
 
+	if task.cancelled {
+		bf.dropCancelledTask(task)
+		return nil
+	}
+
 	if err := bf.processFailedTask(task, false); err != nil {
 		return err
 	}
@@ -191,6 +208,8 @@ func (bproc *BlockProcessor) AddBlockResponse(msg *message.AddBlockRsp) error {
 	logger.Info().Uint64("no", msg.BlockNo).Str("hash", enc.ToString(msg.BlockHash)).Msg("block connect succeed")
 
 	bproc.blockFetcher.stat.setLastAddBlock(curBlock)
+	bproc.blockFetcher.stat.connect.add(1, len(curBlock.GetBody().GetTxs()), time.Since(bproc.curStarted))
+	bproc.preVerifier.setConnected(curBlock.BlockNo())
 
 	if curBlock.BlockNo() == bproc.targetBlockNo {
 		logger.Info().Msg("succeed to add last block, request stopping syncer")
@@ -215,6 +234,7 @@ func (bproc *BlockProcessor) addConnectTask(msg *message.GetBlockChunksRsp) {
 	logger.Debug().Uint64("firstno", req.firstNo).Int("count", len(req.Blocks)).Msg("add connect task to queue")
 
 	bproc.pushToConnQueue(req)
+	bproc.preVerifier.push(req.Blocks)
 
 	block := bproc.getNextBlockToConnect()
 
@@ -270,9 +290,18 @@ func (bproc *BlockProcessor) connectBlock(block *types.Block) {
 		Str("hash", enc.ToString(block.GetHash())).
 		Msg("request connecting block to chainsvc")
 
+	bproc.curStarted = time.Now()
 	bproc.compRequester.RequestTo(message.ChainSvc, &message.AddBlock{PeerID: "", Block: block, Bstate: nil, IsSync: true})
 }
 
+func countTxs(blocks []*types.Block) int {
+	var count int
+	for _, block := range blocks {
+		count += len(block.GetBody().GetTxs())
+	}
+	return count
+}
+
 func (bproc *BlockProcessor) pushToConnQueue(newReq *ConnectTask) {
 	sortedList := bproc.connQueue
 
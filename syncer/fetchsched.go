@@ -0,0 +1,199 @@
+package syncer
+
+import (
+	"time"
+
+	"github.com/aergoio/aergo/internal/enc"
+	"github.com/aergoio/aergo/p2p/p2putil"
+)
+
+// Adaptive scheduling of FetchTasks. Each peer keeps its measured throughput and response time of finished tasks,
+// and a task is cut to the size which the peer is expected to deliver in DfltFetchTaskTime. Faster peers are
+// picked first, and a task running too long on a slow peer is requested again from an idle peer. The response
+// which arrives first is used and the other one is dropped when it arrives.
+var (
+	// DfltFetchTaskTime is the expected time to fetch a task. It is used to size the chunk of a peer.
+	DfltFetchTaskTime = time.Second * 2
+	MinBlockFetchSize = 10
+	// StealFactor is how many times longer than expected a task must be running to be stolen by an idle peer
+	StealFactor = 3
+	// MinStealWait is the minimum running time of a task to be stolen, for peers which are not measured yet
+	MinStealWait = time.Second * 5
+	// peerStatWeight is the weight of the latest measurement in moving averages of peer stats
+	peerStatWeight = 0.3
+)
+
+// PeerFetchStat is the measured fetch performance of a sync peer
+type PeerFetchStat struct {
+	Peer      string  `json:"peer"`
+	Blocks    int     `json:"blocks"`
+	Tasks     int     `json:"tasks"`
+	Stolen    int     `json:"stolen"`
+	Fails     int     `json:"fails"`
+	Bad       bool    `json:"bad"`
+	BlocksPs  float64 `json:"blocks_ps"`
+	RspTimeMs int64   `json:"rsptime_ms"`
+}
+
+func (peer *SyncPeer) measured() bool {
+	return peer.rate > 0
+}
+
+// addMeasure updates moving averages of throughput and response time by a finished task
+func (peer *SyncPeer) addMeasure(count int, elapsed time.Duration) {
+	if elapsed <= 0 {
+		elapsed = time.Millisecond
+	}
+	rate := float64(count) / elapsed.Seconds()
+	if !peer.measured() {
+		peer.rate = rate
+		peer.rspTime = elapsed
+	} else {
+		peer.rate = peer.rate*(1-peerStatWeight) + rate*peerStatWeight
+		peer.rspTime = time.Duration(float64(peer.rspTime)*(1-peerStatWeight) + float64(elapsed)*peerStatWeight)
+	}
+	peer.blocks += count
+	peer.tasks++
+}
+
+// chunkSize returns the number of blocks to request to the peer at once
+func (peer *SyncPeer) chunkSize(maxSize int) int {
+	if !peer.measured() {
+		return maxSize
+	}
+	size := int(peer.rate * DfltFetchTaskTime.Seconds())
+	if size < MinBlockFetchSize {
+		size = MinBlockFetchSize
+	}
+	if size > maxSize {
+		size = maxSize
+	}
+	return size
+}
+
+// expectedTime returns how long the peer is expected to take to fetch count blocks
+func (peer *SyncPeer) expectedTime(count int) time.Duration {
+	if !peer.measured() {
+		return MinStealWait
+	}
+	expected := time.Duration(float64(count)/peer.rate*float64(time.Second)) * time.Duration(StealFactor)
+	if expected < time.Second {
+		expected = time.Second
+	}
+	return expected
+}
+
+func (peer *SyncPeer) fetchStat() PeerFetchStat {
+	return PeerFetchStat{
+		Peer:      p2putil.ShortForm(peer.ID),
+		Blocks:    peer.blocks,
+		Tasks:     peer.tasks,
+		Stolen:    peer.stolen,
+		Fails:     peer.FailCnt,
+		Bad:       peer.IsErr || peer.FailCnt >= MaxPeerFailCount,
+		BlocksPs:  peer.rate,
+		RspTimeMs: int64(peer.rspTime / time.Millisecond),
+	}
+}
+
+// splitTask cuts the front of task to be fetched by the peer, and leaves the rest in task
+func (bf *BlockFetcher) splitTask(task *FetchTask, size int) *FetchTask {
+	if task.retry > 0 || size >= task.count {
+		return task
+	}
+
+	front := &FetchTask{count: size, hashes: task.hashes[:size], startNo: task.startNo}
+	task.count -= size
+	task.hashes = task.hashes[size:]
+	task.startNo += uint64(size)
+
+	logger.Debug().Uint64("StartNo", front.startNo).Int("count", size).Int("rest", task.count).Msg("split fetchtask for peer")
+	return front
+}
+
+// finishTask is called when task is fetched successfully. The copy of task running on another peer is cancelled.
+func (bf *BlockFetcher) finishTask(task *FetchTask) {
+	peer := task.syncPeer
+	peer.addMeasure(task.count, time.Since(task.started))
+	bf.pushFreePeer(peer)
+
+	if twin := task.twin; twin != nil {
+		task.twin, twin.twin = nil, nil
+		bf.cancelTask(twin)
+		if task.stolen {
+			peer.stolen++
+		}
+	}
+
+	bf.updatePeerStats()
+}
+
+// cancelTask marks the running task cancelled. The task keeps its peer busy until the response of the peer arrives
+// or times out, so that the late response is never matched with another task of the peer.
+func (bf *BlockFetcher) cancelTask(task *FetchTask) {
+	task.cancelled = true
+
+	logger.Debug().Int("peerno", task.syncPeer.No).Uint64("StartNo", task.startNo).Msg("cancel fetchtask finished by other peer")
+}
+
+// dropCancelledTask consumes the response or the timeout of cancelled task, and frees its peer. The peer is not
+// blamed for an error, since the result is not needed anymore.
+func (bf *BlockFetcher) dropCancelledTask(task *FetchTask) {
+	bf.pushFreePeer(task.syncPeer)
+
+	logger.Debug().Int("peerno", task.syncPeer.No).Uint64("StartNo", task.startNo).Msg("dropped response of cancelled fetchtask")
+}
+
+// stealTask requests a copy of the most delayed running task to the free peer. It returns false if no task is
+// delayed enough.
+func (bf *BlockFetcher) stealTask(now time.Time) bool {
+	var straggler *FetchTask
+	var maxDelay time.Duration
+
+	for e := bf.runningQueue.Front(); e != nil; e = e.Next() {
+		task := e.Value.(*FetchTask)
+		if task.twin != nil || task.cancelled {
+			continue
+		}
+		delay := now.Sub(task.started) - task.syncPeer.expectedTime(task.count)
+		if delay > maxDelay {
+			straggler, maxDelay = task, delay
+		}
+	}
+	if straggler == nil {
+		return false
+	}
+
+	freePeer, err := bf.popFreePeer()
+	if err != nil || freePeer == nil {
+		return false
+	}
+
+	stolen := &FetchTask{count: straggler.count, hashes: straggler.hashes, startNo: straggler.startNo,
+		retry: straggler.retry, twin: straggler, stolen: true}
+	straggler.twin = stolen
+
+	logger.Info().Int("peerno", freePeer.No).Int("straggler", straggler.syncPeer.No).Uint64("StartNo", straggler.startNo).
+		Str("start", enc.ToString(straggler.hashes[0])).Dur("delay", maxDelay).Msg("steal delayed fetchtask")
+
+	bf.runTask(stolen, freePeer)
+	return true
+}
+
+func (bf *BlockFetcher) updatePeerStats() {
+	stats := make([]PeerFetchStat, 0, bf.peers.total)
+	for _, peer := range bf.peers.all {
+		stats = append(stats, peer.fetchStat())
+	}
+	bf.stat.peers.Store(stats)
+}
+
+// PeerStats returns the fetch performance of sync peers
+func (stat *BlockFetcherStat) PeerStats() []PeerFetchStat {
+	aopv := stat.peers.Load()
+	if aopv != nil {
+		return aopv.([]PeerFetchStat)
+	}
+
+	return nil
+}
@@ -0,0 +1,276 @@
+package syncer
+
+import (
+	"bytes"
+	"sync"
+	"time"
+
+	"github.com/aergoio/aergo/internal/enc"
+	"github.com/aergoio/aergo/message"
+	"github.com/aergoio/aergo/pkg/component"
+	"github.com/aergoio/aergo/types"
+	"github.com/pkg/errors"
+)
+
+// HeaderFetcher downloads headers of hash sets from HashFetcher and verifies them before BlockFetcher fetches their
+// blocks, so that a bad chain is rejected before its bodies are downloaded. A hash set is split into batches which
+// are requested at once and verified in parallel: each batch is checked to link to the hash set, and the timestamp
+// and signature of each header are verified by consensus of chain. Hash sets are passed to BlockFetcher in order
+// after all their batches are verified.
+type HeaderFetcher struct {
+	compRequester component.IComponentRequester
+
+	ctx      *types.SyncContext
+	verifier headerVerifier
+
+	inCh       chan *HashSet // from HashFetcher
+	outCh      chan *HashSet // to BlockFetcher
+	responseCh chan *message.GetSyncHeadersRsp
+	quitCh     chan interface{}
+
+	// prevHash is the hash of the block before the current hash set
+	prevHash  []byte
+	batchSize int
+	timeout   time.Duration
+
+	stat StageStat
+
+	isRunning bool
+	waitGroup *sync.WaitGroup
+}
+
+// headerVerifier is implemented by chain service which verifies block headers by consensus
+type headerVerifier interface {
+	PreVerifyBlockHeader(header *types.BlockHeader) error
+}
+
+type headerBatch struct {
+	startNo types.BlockNo
+	hashes  []message.BlockHash
+	// prevHash is the hash of the block before the first one of batch
+	prevHash []byte
+	retry    int
+	started  time.Time
+}
+
+var (
+	DfltHeaderBatchSize = 100
+	MaxHeaderRetry      = 3
+
+	ErrInvalidHeaders   = errors.New("invalid block headers from peer")
+	ErrHeaderFetchRetry = errors.New("failed to fetch block headers from peer")
+)
+
+func newHeaderFetcher(ctx *types.SyncContext, compRequester component.IComponentRequester, verifier headerVerifier,
+	outCh chan *HashSet, cfg *SyncerConfig) *HeaderFetcher {
+	hf := &HeaderFetcher{ctx: ctx, compRequester: compRequester, verifier: verifier}
+
+	hf.inCh = make(chan *HashSet)
+	hf.outCh = outCh
+	hf.responseCh = make(chan *message.GetSyncHeadersRsp, cfg.maxHashReqSize/uint64(DfltHeaderBatchSize)+1)
+	hf.quitCh = make(chan interface{})
+
+	hf.prevHash = ctx.CommonAncestor.GetHash()
+	hf.batchSize = DfltHeaderBatchSize
+	hf.timeout = cfg.fetchTimeOut
+
+	return hf
+}
+
+func (hf *HeaderFetcher) GetSeq() uint64 {
+	return hf.ctx.Seq
+}
+
+func (hf *HeaderFetcher) Start() {
+	hf.waitGroup = &sync.WaitGroup{}
+	hf.waitGroup.Add(1)
+
+	hf.isRunning = true
+
+	run := func() {
+		defer RecoverSyncer(NameHeaderFetcher, hf.GetSeq(), hf.compRequester, func() { hf.waitGroup.Done() })
+
+		logger.Debug().Msg("start header fetcher")
+
+		for {
+			var hashSet *HashSet
+			select {
+			case hashSet = <-hf.inCh:
+			case <-hf.quitCh:
+				logger.Info().Msg("HeaderFetcher exited")
+				return
+			}
+
+			if err := hf.verifyHashSet(hashSet); err != nil {
+				if err != ErrQuitHeaderFetcher {
+					logger.Error().Err(err).Msg("failed to verify headers, HeaderFetcher exited")
+					stopSyncer(hf.compRequester, hf.GetSeq(), NameHeaderFetcher, err)
+				}
+				return
+			}
+
+			select {
+			case hf.outCh <- hashSet:
+			case <-hf.quitCh:
+				return
+			}
+
+			if hashSet.StartNo+types.BlockNo(hashSet.Count)-1 >= hf.ctx.TargetNo {
+				closeFetcher(hf.compRequester, hf.GetSeq(), NameHeaderFetcher)
+				logger.Info().Msg("HeaderFetcher finished")
+				return
+			}
+		}
+	}
+
+	go run()
+}
+
+var ErrQuitHeaderFetcher = errors.New("HeaderFetcher quit")
+
+// verifyHashSet fetches and verifies all headers of hashSet
+func (hf *HeaderFetcher) verifyHashSet(hashSet *HashSet) error {
+	start := time.Now()
+
+	// batches are keyed by the hash of their last block, which is requested to peer
+	batches := make(map[string]*headerBatch)
+	prevHash := hf.prevHash
+	for i := 0; i < hashSet.Count; i += hf.batchSize {
+		end := i + hf.batchSize
+		if end > hashSet.Count {
+			end = hashSet.Count
+		}
+		batch := &headerBatch{startNo: hashSet.StartNo + types.BlockNo(i), hashes: hashSet.Hashes[i:end], prevHash: prevHash}
+		batches[string(batch.hashes[len(batch.hashes)-1])] = batch
+		prevHash = batch.hashes[len(batch.hashes)-1]
+		hf.requestBatch(batch)
+	}
+
+	ticker := time.NewTicker(time.Second)
+	defer ticker.Stop()
+
+	verifyCh := make(chan error, len(batches))
+	verifying := 0
+	for len(batches) > 0 || verifying > 0 {
+		select {
+		case rsp := <-hf.responseCh:
+			batch, ok := batches[string(rsp.Hash)]
+			if !ok || rsp.Seq != hf.GetSeq() {
+				continue
+			}
+			if rsp.Err != nil {
+				if err := hf.retryBatch(batch, rsp.Err); err != nil {
+					return err
+				}
+				continue
+			}
+			delete(batches, string(rsp.Hash))
+			verifying++
+			go func(batch *headerBatch, headers []*types.BlockHeader) {
+				verifyCh <- hf.verifyBatch(batch, headers)
+			}(batch, rsp.Headers)
+
+		case err := <-verifyCh:
+			verifying--
+			if err != nil {
+				return err
+			}
+
+		case now := <-ticker.C:
+			for _, batch := range batches {
+				if now.Sub(batch.started) > hf.timeout {
+					if err := hf.retryBatch(batch, ErrHeaderFetchRetry); err != nil {
+						return err
+					}
+				}
+			}
+
+		case <-hf.quitCh:
+			return ErrQuitHeaderFetcher
+		}
+	}
+
+	hf.prevHash = prevHash
+	hf.stat.add(hashSet.Count, 0, time.Since(start))
+	logger.Debug().Uint64("start", hashSet.StartNo).Int("count", hashSet.Count).Msg("headers of hashset verified")
+	return nil
+}
+
+func (hf *HeaderFetcher) requestBatch(batch *headerBatch) {
+	batch.started = time.Now()
+	hf.compRequester.TellTo(message.P2PSvc, &message.GetSyncHeaders{Seq: hf.GetSeq(), ToWhom: hf.ctx.PeerID,
+		Hash: batch.hashes[len(batch.hashes)-1], Count: uint32(len(batch.hashes))})
+}
+
+func (hf *HeaderFetcher) retryBatch(batch *headerBatch, cause error) error {
+	batch.retry++
+	if batch.retry > MaxHeaderRetry {
+		logger.Error().Err(cause).Uint64("start", batch.startNo).Msg("too many retries to fetch headers")
+		return ErrHeaderFetchRetry
+	}
+	logger.Debug().Err(cause).Uint64("start", batch.startNo).Int("retry", batch.retry).Msg("retry to fetch headers")
+	hf.requestBatch(batch)
+	return nil
+}
+
+// verifyBatch checks that headers are the ones of hashes in batch and they are valid by consensus. headers are in
+// descending order of block number.
+func (hf *HeaderFetcher) verifyBatch(batch *headerBatch, headers []*types.BlockHeader) error {
+	if len(headers) != len(batch.hashes) {
+		logger.Error().Uint64("start", batch.startNo).Int("expected", len(batch.hashes)).Int("got", len(headers)).
+			Msg("invalid number of headers")
+		return ErrInvalidHeaders
+	}
+
+	var parent *types.Block
+	for i := range batch.hashes {
+		block := &types.Block{Header: headers[len(headers)-1-i]}
+		prevHash := batch.prevHash
+		if i > 0 {
+			prevHash = batch.hashes[i-1]
+		}
+		if block.BlockNo() != batch.startNo+types.BlockNo(i) ||
+			!bytes.Equal(block.BlockHash(), batch.hashes[i]) ||
+			!bytes.Equal(block.GetHeader().GetPrevBlockHash(), prevHash) ||
+			(parent != nil && !block.ValidChildOf(parent)) {
+			logger.Error().Uint64("no", batch.startNo+types.BlockNo(i)).Str("hash", enc.ToString(batch.hashes[i])).
+				Msg("header doesn't match hash chain")
+			return ErrInvalidHeaders
+		}
+		if err := hf.verifier.PreVerifyBlockHeader(block.GetHeader()); err != nil {
+			logger.Error().Err(err).Uint64("no", block.BlockNo()).Str("hash", enc.ToString(batch.hashes[i])).
+				Msg("invalid header by consensus")
+			return err
+		}
+		parent = block
+	}
+	return nil
+}
+
+// pushRsp passes the response from p2p to the fetcher goroutine. It doesn't block syncer while the fetcher waits
+// for BlockFetcher, and a dropped response is requested again after timeout.
+func (hf *HeaderFetcher) pushRsp(msg *message.GetSyncHeadersRsp) {
+	if hf == nil {
+		return
+	}
+	select {
+	case hf.responseCh <- msg:
+	default:
+		logger.Debug().Str("hash", enc.ToString(msg.Hash)).Msg("dropped headers response")
+	}
+}
+
+func (hf *HeaderFetcher) stop() {
+	if hf == nil {
+		return
+	}
+
+	if hf.isRunning {
+		logger.Info().Msg("HeaderFetcher stop#1")
+
+		close(hf.quitCh)
+		hf.waitGroup.Wait()
+		hf.isRunning = false
+	}
+	logger.Info().Msg("HeaderFetcher stopped")
+}
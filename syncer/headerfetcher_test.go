@@ -0,0 +1,53 @@
+package syncer
+
+import (
+	"testing"
+
+	"github.com/aergoio/aergo/chain"
+	"github.com/aergoio/aergo/message"
+	"github.com/aergoio/aergo/types"
+	"github.com/stretchr/testify/assert"
+)
+
+type stubHeaderVerifier struct {
+	verified int
+}
+
+func (v *stubHeaderVerifier) PreVerifyBlockHeader(header *types.BlockHeader) error {
+	v.verified++
+	return nil
+}
+
+func TestHeaderFetcher_verifyBatch(t *testing.T) {
+	remoteChain := chain.InitStubBlockChain(nil, 10)
+
+	var hashes []message.BlockHash
+	var headers []*types.BlockHeader
+	for no := 1; no <= 10; no++ {
+		block := remoteChain.Blocks[no]
+		hashes = append(hashes, block.BlockHash())
+		// headers are responded in descending order
+		headers = append([]*types.BlockHeader{block.GetHeader()}, headers...)
+	}
+
+	ctx := types.NewSyncCtx(1, "peer-0", 10, 0, nil)
+	ctx.SetAncestor(remoteChain.Blocks[0])
+	verifier := &stubHeaderVerifier{}
+	hf := newHeaderFetcher(ctx, NewStubRequester(), verifier, make(chan *HashSet), SyncerCfg)
+
+	batch := &headerBatch{startNo: 1, hashes: hashes, prevHash: remoteChain.Blocks[0].BlockHash()}
+	assert.NoError(t, hf.verifyBatch(batch, headers))
+	assert.Equal(t, 10, verifier.verified)
+
+	// missing header
+	assert.Equal(t, ErrInvalidHeaders, hf.verifyBatch(batch, headers[1:]))
+
+	// headers not linked to the previous batch
+	unlinked := &headerBatch{startNo: 1, hashes: hashes, prevHash: remoteChain.Blocks[1].BlockHash()}
+	assert.Equal(t, ErrInvalidHeaders, hf.verifyBatch(unlinked, headers))
+
+	// header of other block in place of the requested one
+	swapped := append([]*types.BlockHeader{}, headers...)
+	swapped[3], swapped[4] = swapped[4], swapped[3]
+	assert.Equal(t, ErrInvalidHeaders, hf.verifyBatch(batch, swapped))
+}
@@ -0,0 +1,171 @@
+package syncer
+
+import (
+	"sort"
+	"sync"
+	"sync/atomic"
+	"time"
+
+	"github.com/aergoio/aergo/chain"
+	"github.com/aergoio/aergo/internal/enc"
+	"github.com/aergoio/aergo/types"
+)
+
+// TxPreVerifier verifies signatures of txs in fetched blocks while chain service executes the block being
+// connected. Verification runs at most maxAhead blocks ahead of the last connected block, so the memory used by
+// verified txs is bounded even if fetching is much faster than execution. Chain service skips verification of
+// txs which are pre-verified, and verifies the others like txs of name accounts as usual.
+type TxPreVerifier struct {
+	lock      sync.Mutex
+	cond      *sync.Cond
+	queue     []*types.Block // ordered by block no
+	connected types.BlockNo
+	maxAhead  types.BlockNo
+	stopped   bool
+
+	workCh chan preVerifyWork
+	stat   *StageStat
+}
+
+type preVerifyWork struct {
+	tx *types.Tx
+	wg *sync.WaitGroup
+}
+
+func newTxPreVerifier(connected types.BlockNo, maxAhead int, workers int, stat *StageStat) *TxPreVerifier {
+	pv := &TxPreVerifier{
+		connected: connected,
+		maxAhead:  types.BlockNo(maxAhead),
+		workCh:    make(chan preVerifyWork, workers),
+		stat:      stat,
+	}
+	pv.cond = sync.NewCond(&pv.lock)
+
+	for i := 0; i < workers; i++ {
+		go pv.verifyLoop()
+	}
+	go pv.run()
+
+	return pv
+}
+
+// push adds fetched blocks to be verified
+func (pv *TxPreVerifier) push(blocks []*types.Block) {
+	if pv == nil || len(blocks) == 0 {
+		return
+	}
+	pv.lock.Lock()
+	defer pv.lock.Unlock()
+
+	firstNo := blocks[0].BlockNo()
+	index := sort.Search(len(pv.queue), func(i int) bool { return pv.queue[i].BlockNo() > firstNo })
+	queue := make([]*types.Block, 0, len(pv.queue)+len(blocks))
+	queue = append(queue, pv.queue[:index]...)
+	queue = append(queue, blocks...)
+	pv.queue = append(queue, pv.queue[index:]...)
+
+	pv.cond.Signal()
+}
+
+// setConnected moves the verification window after block no is connected
+func (pv *TxPreVerifier) setConnected(no types.BlockNo) {
+	if pv == nil {
+		return
+	}
+	pv.lock.Lock()
+	defer pv.lock.Unlock()
+
+	pv.connected = no
+	pv.cond.Signal()
+}
+
+func (pv *TxPreVerifier) stop() {
+	if pv == nil {
+		return
+	}
+	pv.lock.Lock()
+	defer pv.lock.Unlock()
+
+	pv.stopped = true
+	pv.queue = nil
+	pv.cond.Signal()
+}
+
+// next returns the next block to verify, or nil if verifier is stopped
+func (pv *TxPreVerifier) next() *types.Block {
+	pv.lock.Lock()
+	defer pv.lock.Unlock()
+
+	for {
+		if pv.stopped {
+			return nil
+		}
+		// blocks which are already connected don't need to be verified
+		for len(pv.queue) > 0 && pv.queue[0].BlockNo() <= pv.connected {
+			pv.queue = pv.queue[1:]
+		}
+		if len(pv.queue) > 0 && pv.queue[0].BlockNo() <= pv.connected+pv.maxAhead {
+			block := pv.queue[0]
+			pv.queue = pv.queue[1:]
+			return block
+		}
+		pv.cond.Wait()
+	}
+}
+
+func (pv *TxPreVerifier) run() {
+	defer close(pv.workCh)
+
+	for block := pv.next(); block != nil; block = pv.next() {
+		start := time.Now()
+		txs := block.GetBody().GetTxs()
+
+		var wg sync.WaitGroup
+		wg.Add(len(txs))
+		for _, tx := range txs {
+			pv.workCh <- preVerifyWork{tx: tx, wg: &wg}
+		}
+		wg.Wait()
+
+		pv.stat.add(1, len(txs), time.Since(start))
+	}
+}
+
+func (pv *TxPreVerifier) verifyLoop() {
+	for work := range pv.workCh {
+		if err := chain.PreVerifyTx(work.tx); err != nil {
+			// chain service rejects the block when it verifies the tx again
+			logger.Debug().Err(err).Str("hash", enc.ToString(work.tx.GetHash())).Msg("failed to pre-verify tx")
+		}
+		work.wg.Done()
+	}
+}
+
+// StageStat is the throughput of a stage of sync pipeline.
+type StageStat struct {
+	blocks int64
+	txs    int64
+	busy   int64 // nanoseconds
+}
+
+func (stat *StageStat) add(blocks int, txs int, elapsed time.Duration) {
+	atomic.AddInt64(&stat.blocks, int64(blocks))
+	atomic.AddInt64(&stat.txs, int64(txs))
+	atomic.AddInt64(&stat.busy, int64(elapsed))
+}
+
+// Map returns the counters and blocks per second while the stage was busy
+func (stat *StageStat) Map() map[string]interface{} {
+	blocks := atomic.LoadInt64(&stat.blocks)
+	busy := time.Duration(atomic.LoadInt64(&stat.busy))
+	var bps float64
+	if busy > 0 {
+		bps = float64(blocks) / busy.Seconds()
+	}
+	return map[string]interface{}{
+		"blocks":    blocks,
+		"txs":       atomic.LoadInt64(&stat.txs),
+		"busy_ms":   int64(busy / time.Millisecond),
+		"blocks_ps": bps,
+	}
+}
@@ -0,0 +1,50 @@
+package syncer
+
+import (
+	"testing"
+	"time"
+
+	"github.com/aergoio/aergo/types"
+	"github.com/stretchr/testify/assert"
+)
+
+func makePreVerifyBlocks(from, to types.BlockNo) []*types.Block {
+	var blocks []*types.Block
+	for no := from; no <= to; no++ {
+		// txs with invalid signature are left to be verified by chain service
+		tx := &types.Tx{Body: &types.TxBody{Nonce: uint64(no), Account: []byte("account")}}
+		blocks = append(blocks, &types.Block{Header: &types.BlockHeader{BlockNo: no}, Body: &types.BlockBody{Txs: []*types.Tx{tx}}})
+	}
+	return blocks
+}
+
+func waitVerified(stat *StageStat, blocks int64) bool {
+	for i := 0; i < 100; i++ {
+		if stat.Map()["blocks"].(int64) == blocks {
+			return true
+		}
+		time.Sleep(10 * time.Millisecond)
+	}
+	return false
+}
+
+func TestTxPreVerifier(t *testing.T) {
+	stat := &StageStat{}
+	pv := newTxPreVerifier(0, 3, 2, stat)
+	defer pv.stop()
+
+	// blocks out of window are verified after blocks before them are connected
+	pv.push(makePreVerifyBlocks(6, 10))
+	pv.push(makePreVerifyBlocks(1, 5))
+	assert.True(t, waitVerified(stat, 3))
+	time.Sleep(50 * time.Millisecond)
+	assert.Equal(t, int64(3), stat.Map()["blocks"])
+
+	pv.setConnected(5)
+	assert.True(t, waitVerified(stat, 6))
+
+	// connected blocks are skipped
+	pv.setConnected(9)
+	assert.True(t, waitVerified(stat, 7))
+	assert.Equal(t, int64(7), stat.Map()["txs"])
+}
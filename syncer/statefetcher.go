@@ -0,0 +1,489 @@
+package syncer
+
+import (
+	"os"
+	"runtime/debug"
+	"sync"
+	"sync/atomic"
+	"time"
+
+	"github.com/aergoio/aergo/contract"
+	"github.com/aergoio/aergo/internal/enc"
+	"github.com/aergoio/aergo/message"
+	"github.com/aergoio/aergo/p2p/p2putil"
+	"github.com/aergoio/aergo/pkg/component"
+	"github.com/aergoio/aergo/state"
+	"github.com/aergoio/aergo/types"
+	"github.com/pkg/errors"
+)
+
+// StateFetcher downloads the state of a trusted root from peers by chunks of trie leaves, instead of executing
+// all blocks to the root. The key space of accounts is split into DfltStateSyncRanges ranges which are fetched
+// from different peers in parallel, and a range is continued from the next key of the last chunk. Storage tries
+// of contracts are fetched as they are found in account chunks. Each chunk is verified by its range proof against
+// the requested root, and the range of an invalid chunk is requeued for other peers while the sender is dropped.
+// Sql databases of contracts found in account chunks are downloaded as files from snapshots of peers, and the
+// state is finalized after they are imported.
+// If the block of the root is given, the fetcher hands off to block sync at last, which connects blocks up to it
+// without execution.
+var (
+	DfltStateSyncRanges = 16
+	DfltStateChunkSize  = 1024
+	MaxStatePeerFails   = 3
+
+	NameStateFetcher = "StateFetcher"
+
+	ErrStateSyncNotSupported = errors.New("chain doesn't support state sync")
+	ErrStateSyncNoPeer       = errors.New("no peer left to sync state")
+	ErrStateSyncStopped      = errors.New("state sync stopped")
+	ErrStateSyncRunning      = errors.New("other state sync is running")
+)
+
+// stateRequestSeq identifies requests of state chunks, to drop responses of requests timed out
+var stateRequestSeq uint64
+
+// stateDBAccessor is implemented by chain service which can import state synced from peers
+type stateDBAccessor interface {
+	SDB() *state.ChainStateDB
+}
+
+type StateFetcher struct {
+	compRequester component.IComponentRequester
+
+	root []byte
+	// no and hash are the block of root to sync blocks to after the state is imported. hash is nil if the caller
+	// syncs blocks by itself.
+	no       types.BlockNo
+	hash     []byte
+	accounts *stateTrie
+	storages map[string]*stateTrie
+	// storageCursor is the number of storage roots of accounts already queued
+	storageCursor int
+	// sqlCursor is the number of sql databases of accounts already queued, and sqlPending is the number of them
+	// not imported yet
+	sqlCursor  int
+	sqlPending int
+	sdb        *state.ChainStateDB
+
+	peers []*statePeer
+	tasks []*stateTask
+
+	chunkSize int
+	timeout   time.Duration
+
+	responseCh chan *message.GetStateChunkRsp
+	quitCh     chan interface{}
+	stopOnce   sync.Once
+	doneCh     chan interface{}
+	notifyC    chan error
+
+	chunks int64
+	leaves int64
+}
+
+type stateTrie struct {
+	importer *state.StateImporter
+	root     []byte
+	accounts bool
+	// account is the key of the contract having the storage trie
+	account []byte
+	// pending is the number of ranges not fetched yet
+	pending int
+}
+
+type stateTask struct {
+	trie       *stateTrie
+	start, end []byte
+	started    time.Time
+	// sql is set if the task fetches a sql database instead of trie leaves
+	sql *sqlTransfer
+}
+
+// sqlTransfer is the download of the sql database of a contract. The database is read by chunks from a snapshot
+// made by a peer, so it is continued only from the same peer, or restarted otherwise.
+type sqlTransfer struct {
+	state.ContractSQL
+	peer     types.PeerID
+	snapshot uint64
+	size     uint64
+	offset   uint64
+}
+
+func (t *sqlTransfer) reset() {
+	t.peer, t.snapshot, t.size, t.offset = "", 0, 0, 0
+}
+
+type statePeer struct {
+	id    types.PeerID
+	fails int
+	task  *stateTask
+	seq   uint64
+}
+
+func newStateFetcher(compRequester component.IComponentRequester, sdb *state.ChainStateDB, msg *message.StateSyncStart,
+	cfg *SyncerConfig) *StateFetcher {
+	root, peers := msg.Root, msg.PeerIDs
+	sf := &StateFetcher{
+		compRequester: compRequester,
+		root:          root,
+		no:            msg.No,
+		hash:          msg.Hash,
+		storages:      make(map[string]*stateTrie),
+		sdb:           sdb,
+		chunkSize:     DfltStateChunkSize,
+		timeout:       cfg.fetchTimeOut,
+		responseCh:    make(chan *message.GetStateChunkRsp, len(peers)),
+		quitCh:        make(chan interface{}),
+		doneCh:        make(chan interface{}),
+		notifyC:       msg.NotifyC,
+	}
+	for _, id := range peers {
+		sf.peers = append(sf.peers, &statePeer{id: id})
+	}
+
+	sf.accounts = &stateTrie{importer: sdb.NewStateImporter(root, true), root: root, accounts: true}
+	step := 256 / DfltStateSyncRanges
+	for i := 0; i < DfltStateSyncRanges; i++ {
+		var start, end []byte
+		if i > 0 {
+			start = []byte{byte(i * step)}
+		}
+		if i < DfltStateSyncRanges-1 {
+			end = []byte{byte((i + 1) * step)}
+		}
+		sf.pushTask(&stateTask{trie: sf.accounts, start: start, end: end})
+	}
+	return sf
+}
+
+func (sf *StateFetcher) pushTask(task *stateTask) {
+	task.trie.pending++
+	sf.tasks = append(sf.tasks, task)
+}
+
+func (sf *StateFetcher) Start() {
+	logger.Info().Str("root", enc.ToString(sf.root)).Int("peers", len(sf.peers)).Msg("start state fetcher")
+	go sf.run()
+}
+
+func (sf *StateFetcher) run() {
+	var err error
+	defer func() {
+		if r := recover(); r != nil {
+			logger.Error().Str("callstack", string(debug.Stack())).Msg("state fetcher recovered panic")
+			err = ErrSyncerPanic
+		}
+		sf.finish(err)
+	}()
+
+	if sf.sdb.IsStateImported(sf.root) {
+		// imported by a previous state sync which was interrupted after that
+		logger.Info().Str("root", enc.ToString(sf.root)).Msg("state is already imported")
+		return
+	}
+
+	ticker := time.NewTicker(time.Second)
+	defer ticker.Stop()
+
+	for {
+		if err = sf.schedule(); err != nil {
+			return
+		}
+		if sf.accounts.pending == 0 && sf.storageCursor == len(sf.accounts.importer.Storages()) &&
+			sf.storagesDone() && sf.sqlPending == 0 {
+			err = sf.accounts.importer.Finish()
+			return
+		}
+
+		select {
+		case rsp := <-sf.responseCh:
+			if err = sf.handleRsp(rsp); err != nil {
+				return
+			}
+		case now := <-ticker.C:
+			sf.checkTimeout(now)
+		case <-sf.quitCh:
+			err = ErrStateSyncStopped
+			return
+		}
+	}
+}
+
+func (sf *StateFetcher) storagesDone() bool {
+	for _, storage := range sf.storages {
+		if storage.pending > 0 {
+			return false
+		}
+	}
+	return true
+}
+
+// schedule requests queued tasks to free peers
+func (sf *StateFetcher) schedule() error {
+	alive := 0
+	for _, peer := range sf.peers {
+		if peer.fails >= MaxStatePeerFails {
+			continue
+		}
+		alive++
+		if peer.task != nil {
+			continue
+		}
+		task := sf.popTask(peer.id)
+		if task == nil {
+			continue
+		}
+		task.started = time.Now()
+		peer.task = task
+		peer.seq = atomic.AddUint64(&stateRequestSeq, 1)
+
+		if task.sql != nil {
+			task.sql.peer = peer.id
+			sf.compRequester.TellTo(message.P2PSvc, &message.GetStateChunk{Seq: peer.seq, ToWhom: peer.id,
+				StateRoot: sf.root, Account: task.sql.Account, Sql: true, Offset: task.sql.offset, Snapshot: task.sql.snapshot})
+			continue
+		}
+		sf.compRequester.TellTo(message.P2PSvc, &message.GetStateChunk{Seq: peer.seq, ToWhom: peer.id,
+			Root: task.trie.root, Start: task.start, End: task.end, Limit: uint32(sf.chunkSize), Accounts: task.trie.accounts,
+			StateRoot: sf.root, Account: task.trie.account})
+	}
+	if alive == 0 {
+		return ErrStateSyncNoPeer
+	}
+	return nil
+}
+
+// popTask takes the first task which the peer can do. A sql database is continued only by the peer which started
+// it, unless the peer is dropped.
+func (sf *StateFetcher) popTask(id types.PeerID) *stateTask {
+	for i, task := range sf.tasks {
+		if t := task.sql; t != nil && t.snapshot != 0 && t.peer != id {
+			if owner := sf.findPeer(t.peer); owner != nil && owner.fails < MaxStatePeerFails {
+				continue
+			}
+			t.reset()
+		}
+		sf.tasks = append(sf.tasks[:i], sf.tasks[i+1:]...)
+		return task
+	}
+	return nil
+}
+
+func (sf *StateFetcher) findPeer(id types.PeerID) *statePeer {
+	for _, peer := range sf.peers {
+		if peer.id == id {
+			return peer
+		}
+	}
+	return nil
+}
+
+// failTask requeues the task of peer. A sql database is downloaded again from the beginning.
+func (sf *StateFetcher) failTask(peer *statePeer, fails int) {
+	if peer.task.sql != nil {
+		peer.task.sql.reset()
+	}
+	sf.tasks = append(sf.tasks, peer.task)
+	peer.task = nil
+	peer.fails += fails
+}
+
+func (sf *StateFetcher) handleRsp(rsp *message.GetStateChunkRsp) error {
+	peer := sf.findPeer(rsp.ToWhom)
+	if peer == nil || peer.task == nil || peer.seq != rsp.Seq {
+		// response of timed out request
+		return nil
+	}
+	task := peer.task
+
+	if rsp.Err != nil || rsp.Chunk == nil {
+		logger.Debug().Err(rsp.Err).Str("peer", p2putil.ShortForm(peer.id)).Msg("failed to get state chunk")
+		sf.failTask(peer, 1)
+		return nil
+	}
+
+	if task.sql != nil {
+		return sf.handleSQLRsp(peer, task, rsp.Chunk)
+	}
+
+	chunk := &state.StateChunk{Keys: rsp.Chunk.Keys, Values: rsp.Chunk.Values, Codes: rsp.Chunk.Codes, Next: rsp.Chunk.Next,
+		Proof: rsp.Chunk.Proof}
+	if err := task.trie.importer.Add(task.start, task.end, chunk); err != nil {
+		logger.Warn().Err(err).Str("peer", p2putil.ShortForm(peer.id)).Msg("invalid state chunk")
+		sf.failTask(peer, MaxStatePeerFails)
+		return nil
+	}
+	peer.task = nil
+	atomic.AddInt64(&sf.chunks, 1)
+	atomic.AddInt64(&sf.leaves, int64(len(chunk.Keys)))
+
+	if task.trie.accounts {
+		// storage tries are fetched together with the rest of accounts
+		storages := task.trie.importer.Storages()
+		for _, s := range storages[sf.storageCursor:] {
+			if _, exist := sf.storages[string(s.Root)]; exist {
+				continue
+			}
+			storage := &stateTrie{importer: sf.sdb.NewStateImporter(s.Root, false), root: s.Root, account: s.Account}
+			sf.storages[string(s.Root)] = storage
+			sf.pushTask(&stateTask{trie: storage})
+		}
+		sf.storageCursor = len(storages)
+
+		sqls := task.trie.importer.SQLs()
+		for _, sql := range sqls[sf.sqlCursor:] {
+			sf.tasks = append(sf.tasks, &stateTask{sql: &sqlTransfer{ContractSQL: sql}})
+			sf.sqlPending++
+		}
+		sf.sqlCursor = len(sqls)
+	}
+
+	if len(chunk.Next) != 0 {
+		// continue the range by the same task
+		task.start = chunk.Next
+		sf.tasks = append(sf.tasks, task)
+		return nil
+	}
+	task.trie.pending--
+	if !task.trie.accounts && task.trie.pending == 0 {
+		return task.trie.importer.Finish()
+	}
+	return nil
+}
+
+// handleSQLRsp writes the part of a sql database to the file to import. The database is imported when the whole
+// file is downloaded, and it is downloaded again from other peers if it doesn't have the recovery point of the state.
+func (sf *StateFetcher) handleSQLRsp(peer *statePeer, task *stateTask, rsp *types.GetStateChunkResponse) error {
+	t := task.sql
+	if rsp.Snapshot == 0 || t.snapshot != 0 && (rsp.Snapshot != t.snapshot || rsp.SqlSize != t.size) ||
+		t.offset+uint64(len(rsp.SqlData)) > rsp.SqlSize || len(rsp.SqlData) == 0 && t.offset < rsp.SqlSize {
+		logger.Warn().Str("peer", p2putil.ShortForm(peer.id)).Msg("invalid chunk of sql database")
+		sf.failTask(peer, MaxStatePeerFails)
+		return nil
+	}
+
+	id := types.AccountID(types.ToHashID(t.Account))
+	path, err := contract.SQLImportPath(id)
+	if err != nil {
+		return err
+	}
+	flag := os.O_WRONLY | os.O_CREATE
+	if t.offset == 0 {
+		flag |= os.O_TRUNC
+	}
+	f, err := os.OpenFile(path, flag, 0644)
+	if err != nil {
+		return err
+	}
+	_, err = f.WriteAt(rsp.SqlData, int64(t.offset))
+	if closeErr := f.Close(); err == nil {
+		err = closeErr
+	}
+	if err != nil {
+		return err
+	}
+	t.snapshot, t.size = rsp.Snapshot, rsp.SqlSize
+	t.offset += uint64(len(rsp.SqlData))
+	atomic.AddInt64(&sf.chunks, 1)
+
+	if t.offset < t.size {
+		peer.task = nil
+		sf.tasks = append(sf.tasks, task)
+		return nil
+	}
+	if err = contract.ImportSQLDatabase(id, t.RecoveryPoint); err != nil {
+		logger.Warn().Err(err).Str("peer", p2putil.ShortForm(peer.id)).Str("account", id.String()).
+			Msg("invalid sql database")
+		sf.failTask(peer, MaxStatePeerFails)
+		return nil
+	}
+	peer.task = nil
+	sf.sqlPending--
+	return nil
+}
+
+func (sf *StateFetcher) checkTimeout(now time.Time) {
+	for _, peer := range sf.peers {
+		if peer.task != nil && now.Sub(peer.task.started) > sf.timeout {
+			logger.Debug().Str("peer", p2putil.ShortForm(peer.id)).Msg("state chunk request timed out")
+			sf.failTask(peer, 1)
+		}
+	}
+}
+
+func (sf *StateFetcher) finish(err error) {
+	close(sf.doneCh)
+	if err != nil {
+		logger.Error().Err(err).Str("root", enc.ToString(sf.root)).Msg("state sync failed")
+	} else {
+		logger.Info().Str("root", enc.ToString(sf.root)).Int64("leaves", atomic.LoadInt64(&sf.leaves)).
+			Int("storages", len(sf.storages)).Msg("state sync done")
+	}
+	if sf.hash != nil && err != ErrStateSyncStopped {
+		sf.handOff(err)
+	}
+	if sf.notifyC != nil {
+		sf.notifyC <- err
+	}
+}
+
+// handOff starts block sync to the block of the root. Blocks up to it are connected without execution if the
+// state is imported, or executed from the best block otherwise.
+func (sf *StateFetcher) handOff(err error) {
+	if err == nil {
+		result, reqErr := sf.compRequester.RequestToFutureResult(message.ChainSvc,
+			&message.SetStateSyncPoint{No: sf.no, Hash: sf.hash, Root: sf.root}, sf.timeout, "syncer/StateFetcher.handOff")
+		if rsp, ok := result.(*message.SetStateSyncPointRsp); reqErr == nil && ok {
+			reqErr = rsp.Err
+		}
+		if reqErr != nil {
+			logger.Warn().Err(reqErr).Uint64("no", sf.no).Msg("failed to set state sync point. blocks are executed instead")
+		}
+	}
+
+	var target *statePeer
+	for _, peer := range sf.peers {
+		if target == nil || peer.fails < target.fails {
+			target = peer
+		}
+	}
+	if target == nil || target.fails >= MaxStatePeerFails {
+		logger.Warn().Uint64("no", sf.no).Msg("no peer to sync blocks after state sync")
+		return
+	}
+	sf.compRequester.TellTo(message.SyncerSvc, &message.SyncStart{PeerID: target.id, TargetNo: sf.no})
+}
+
+// pushRsp passes the response from p2p to the fetcher goroutine
+func (sf *StateFetcher) pushRsp(rsp *message.GetStateChunkRsp) {
+	select {
+	case sf.responseCh <- rsp:
+	case <-sf.doneCh:
+	}
+}
+
+func (sf *StateFetcher) isFinished() bool {
+	select {
+	case <-sf.doneCh:
+		return true
+	default:
+		return false
+	}
+}
+
+func (sf *StateFetcher) stop() {
+	if sf == nil {
+		return
+	}
+	sf.stopOnce.Do(func() { close(sf.quitCh) })
+}
+
+// Statistics returns the progress of state sync
+func (sf *StateFetcher) Statistics() map[string]interface{} {
+	return map[string]interface{}{
+		"root":     enc.ToString(sf.root),
+		"chunks":   atomic.LoadInt64(&sf.chunks),
+		"leaves":   atomic.LoadInt64(&sf.leaves),
+		"finished": sf.isFinished(),
+	}
+}
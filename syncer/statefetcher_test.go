@@ -0,0 +1,105 @@
+package syncer
+
+import (
+	"fmt"
+	"io/ioutil"
+	"os"
+	"testing"
+	"time"
+
+	"github.com/aergoio/aergo-lib/db"
+	"github.com/aergoio/aergo/message"
+	"github.com/aergoio/aergo/state"
+	"github.com/aergoio/aergo/types"
+	"github.com/stretchr/testify/assert"
+)
+
+func newTestStateDB(t *testing.T, dir string) *state.ChainStateDB {
+	sdb := state.NewChainStateDB()
+	assert.NoError(t, sdb.Init(string(db.BadgerImpl), dir, nil, false))
+	return sdb
+}
+
+func TestStateFetcher(t *testing.T) {
+	tmpdir, _ := ioutil.TempDir("", "statefetcher")
+	defer os.RemoveAll(tmpdir)
+
+	src := newTestStateDB(t, tmpdir+"/src")
+	defer src.Close()
+	states := src.GetStateDB()
+	for i := 0; i < 300; i++ {
+		id := types.ToAccountID([]byte(fmt.Sprintf("account%d", i)))
+		assert.NoError(t, states.PutState(id, &types.State{Nonce: uint64(i)}))
+	}
+	contract, err := states.OpenContractStateAccount(types.ToAccountID([]byte("contract")))
+	assert.NoError(t, err)
+	assert.NoError(t, contract.SetCode([]byte("code")))
+	assert.NoError(t, contract.SetData([]byte("key"), []byte("value")))
+	assert.NoError(t, states.StageContractState(contract))
+	assert.NoError(t, states.Update())
+	assert.NoError(t, states.Commit())
+	root := states.GetRoot()
+
+	dst := newTestStateDB(t, tmpdir+"/dst")
+	defer dst.Close()
+
+	goodPeer, badPeer := types.PeerID("good"), types.PeerID("bad")
+	requester := NewStubRequester()
+	notifyC := make(chan error, 1)
+	msg := &message.StateSyncStart{Root: root, No: 10, Hash: []byte("hash"), PeerIDs: []types.PeerID{badPeer, goodPeer},
+		NotifyC: notifyC}
+	sf := newStateFetcher(requester, dst, msg, SyncerCfg)
+	sf.chunkSize = 20
+	sf.Start()
+
+	// act like p2p of peers and chain. bad peer leaves out a leaf of chunks
+	stopC := make(chan interface{})
+	defer close(stopC)
+	pointC := make(chan *message.SetStateSyncPoint, 1)
+	syncC := make(chan *message.SyncStart, 1)
+	go func() {
+		for {
+			select {
+			case msg := <-requester.sendCh:
+				switch req := msg.(type) {
+				case *message.GetStateChunk:
+					rsp := &message.GetStateChunkRsp{Seq: req.Seq, ToWhom: req.ToWhom}
+					assert.True(t, req.Accounts || src.IsStorageImported(req.StateRoot, req.Account, req.Root))
+					chunk, err := src.GetStateChunk(req.Root, req.Start, req.End, int(req.Limit), req.Accounts)
+					assert.NoError(t, err)
+					if req.ToWhom == badPeer && len(chunk.Keys) > 0 {
+						chunk.Keys, chunk.Values = chunk.Keys[1:], chunk.Values[1:]
+					}
+					rsp.Chunk = &types.GetStateChunkResponse{Keys: chunk.Keys, Values: chunk.Values, Codes: chunk.Codes, Next: chunk.Next,
+						Proof: chunk.Proof}
+					sf.pushRsp(rsp)
+				case *message.SetStateSyncPoint:
+					pointC <- req
+					requester.sendReply(StubRequestResult{result: &message.SetStateSyncPointRsp{}})
+				case *message.SyncStart:
+					syncC <- req
+				}
+			case <-stopC:
+				return
+			}
+		}
+	}()
+
+	select {
+	case err := <-notifyC:
+		assert.NoError(t, err)
+	case <-time.After(time.Second * 10):
+		t.Fatal("state sync timed out")
+	}
+	assert.True(t, dst.IsStateImported(root))
+	assert.Equal(t, MaxStatePeerFails, sf.findPeer(badPeer).fails)
+	assert.Equal(t, 1, len(sf.storages))
+
+	// blocks are synced to the block of root from the good peer, and connected without execution
+	point := <-pointC
+	assert.Equal(t, uint64(10), point.No)
+	assert.Equal(t, root, point.Root)
+	syncStart := <-syncC
+	assert.Equal(t, goodPeer, syncStart.PeerID)
+	assert.Equal(t, uint64(10), syncStart.TargetNo)
+}
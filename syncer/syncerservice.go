@@ -3,6 +3,7 @@ package syncer
 import (
 	"github.com/aergoio/aergo/chain"
 	"github.com/aergoio/aergo/p2p/p2putil"
+	"runtime"
 	"runtime/debug"
 
 	"github.com/aergoio/aergo-lib/log"
@@ -31,9 +32,11 @@ type Syncer struct {
 	isRunning bool
 	ctx       *types.SyncContext
 
-	finder       *Finder
-	hashFetcher  *HashFetcher
-	blockFetcher *BlockFetcher
+	finder        *Finder
+	hashFetcher   *HashFetcher
+	headerFetcher *HeaderFetcher
+	blockFetcher  *BlockFetcher
+	stateFetcher  *StateFetcher
 
 	compRequester component.IComponentRequester //for test
 }
@@ -43,10 +46,15 @@ type SyncerConfig struct {
 	maxBlockReqSize  int
 	maxPendingConn   int
 	maxBlockReqTasks int
+	// maxPreVerifyBlocks is how many blocks ahead of the last connected one txs are verified. 0 disables it
+	maxPreVerifyBlocks int
+	numPreVerifiers    int
 
 	fetchTimeOut time.Duration
 
 	useFullScanOnly bool
+	// useHeaderFirst verifies headers of hash sets before their blocks are fetched
+	useHeaderFirst bool
 
 	debugContext *SyncerDebug
 }
@@ -69,6 +77,7 @@ var (
 	logger             = log.NewLogger("syncer")
 	NameFinder         = "Finder"
 	NameHashFetcher    = "HashFetcher"
+	NameHeaderFetcher  = "HeaderFetcher"
 	NameBlockFetcher   = "BlockFetcher"
 	NameBlockProcessor = "BlockProcessor"
 	SyncerCfg          = &SyncerConfig{
@@ -77,7 +86,11 @@ var (
 		maxPendingConn:   MaxBlockPendingTasks,
 		maxBlockReqTasks: DfltBlockFetchTasks,
 		fetchTimeOut:     DfltFetchTimeOut,
-		useFullScanOnly:  false}
+		useFullScanOnly:  false,
+		useHeaderFirst:   true,
+
+		maxPreVerifyBlocks: DfltPreVerifyBlocks,
+		numPreVerifiers:    runtime.NumCPU()}
 )
 
 var (
@@ -125,6 +138,7 @@ func (syncer *Syncer) BeforeStop() {
 		logger.Info().Msg("syncer BeforeStop")
 		syncer.Reset(nil)
 	}
+	syncer.stateFetcher.stop()
 }
 
 func (syncer *Syncer) Reset(err error) {
@@ -133,10 +147,13 @@ func (syncer *Syncer) Reset(err error) {
 
 		syncer.finder.stop()
 		syncer.hashFetcher.stop()
+		syncer.headerFetcher.stop()
 		syncer.blockFetcher.stop()
+		chain.ResetPreVerifiedHeaders()
 
 		syncer.finder = nil
 		syncer.hashFetcher = nil
+		syncer.headerFetcher = nil
 		syncer.blockFetcher = nil
 		syncer.isRunning = false
 
@@ -193,6 +210,7 @@ func (syncer *Syncer) Receive(context actor.Context) {
 			*message.FinderResult,
 			*message.GetHashesRsp,
 			*message.GetHashByNoRsp,
+			*message.GetSyncHeadersRsp,
 			*message.GetBlockChunks,
 			*message.GetBlockChunksRsp,
 			*message.AddBlockRsp,
@@ -229,6 +247,9 @@ func (syncer *Syncer) verifySeq(inmsg interface{}) bool {
 	case *message.GetHashByNoRsp:
 		seq = msg.Seq
 		match = isMatch(seq)
+	case *message.GetSyncHeadersRsp:
+		seq = msg.Seq
+		match = isMatch(seq)
 	case *message.GetBlockChunksRsp:
 		seq = msg.Seq
 		match = isMatch(seq)
@@ -274,7 +295,21 @@ func (syncer *Syncer) handleMessage(inmsg interface{}) {
 		}
 	case *message.GetHashesRsp:
 		syncer.hashFetcher.GetHahsesRsp(msg)
+	case *message.GetSyncHeadersRsp:
+		syncer.headerFetcher.pushRsp(msg)
 
+	case *message.StateSyncStart:
+		err := syncer.handleStateSyncStart(msg)
+		if err != nil {
+			logger.Error().Err(err).Msg("StateSyncStart failed")
+			if msg.NotifyC != nil {
+				msg.NotifyC <- err
+			}
+		}
+	case *message.GetStateChunkRsp:
+		if syncer.stateFetcher != nil {
+			syncer.stateFetcher.pushRsp(msg)
+		}
 	case *message.GetBlockChunksRsp:
 		err := syncer.blockFetcher.handleBlockRsp(msg)
 		if err != nil {
@@ -297,6 +332,8 @@ func (syncer *Syncer) handleMessage(inmsg interface{}) {
 	case *message.CloseFetcher:
 		if msg.FromWho == NameHashFetcher {
 			syncer.hashFetcher.stop()
+		} else if msg.FromWho == NameHeaderFetcher {
+			syncer.headerFetcher.stop()
 		} else if msg.FromWho == NameBlockFetcher {
 			syncer.blockFetcher.stop()
 		} else {
@@ -354,6 +391,21 @@ func (syncer *Syncer) handleSyncStart(msg *message.SyncStart) error {
 	return err
 }
 
+// handleStateSyncStart starts to download the state of a trusted root. It runs independently of block sync.
+func (syncer *Syncer) handleStateSyncStart(msg *message.StateSyncStart) error {
+	if syncer.stateFetcher != nil && !syncer.stateFetcher.isFinished() {
+		return ErrStateSyncRunning
+	}
+	accessor, ok := syncer.chain.(stateDBAccessor)
+	if !ok {
+		return ErrStateSyncNotSupported
+	}
+
+	syncer.stateFetcher = newStateFetcher(syncer.getCompRequester(), accessor.SDB(), msg, syncer.syncerCfg)
+	syncer.stateFetcher.Start()
+	return nil
+}
+
 func (syncer *Syncer) handleAncestorRsp(msg *message.GetSyncAncestorRsp) {
 	var ancestorNo uint64
 
@@ -414,9 +466,17 @@ func (syncer *Syncer) handleFinderResult(msg *message.FinderResult) error {
 	}
 
 	syncer.blockFetcher = newBlockFetcher(syncer.ctx, syncer.getCompRequester(), syncer.syncerCfg)
-	syncer.hashFetcher = newHashFetcher(syncer.ctx, syncer.getCompRequester(), syncer.blockFetcher.hfCh, syncer.syncerCfg)
+	hashSetCh := syncer.blockFetcher.hfCh
+	if verifier, ok := syncer.chain.(headerVerifier); ok && syncer.syncerCfg.useHeaderFirst {
+		syncer.headerFetcher = newHeaderFetcher(syncer.ctx, syncer.getCompRequester(), verifier, hashSetCh, syncer.syncerCfg)
+		hashSetCh = syncer.headerFetcher.inCh
+	}
+	syncer.hashFetcher = newHashFetcher(syncer.ctx, syncer.getCompRequester(), hashSetCh, syncer.syncerCfg)
 
 	syncer.blockFetcher.Start()
+	if syncer.headerFetcher != nil {
+		syncer.headerFetcher.Start()
+	}
 	syncer.hashFetcher.Start()
 
 	return nil
@@ -424,6 +484,10 @@ func (syncer *Syncer) handleFinderResult(msg *message.FinderResult) error {
 
 func (syncer *Syncer) Statistics() *map[string]interface{} {
 	var start, end, total, added, blockfetched uint64
+	var stateSync map[string]interface{}
+	if syncer.stateFetcher != nil {
+		stateSync = syncer.stateFetcher.Statistics()
+	}
 
 	if syncer.ctx != nil {
 		end = syncer.ctx.TargetNo
@@ -439,15 +503,23 @@ func (syncer *Syncer) Statistics() *map[string]interface{} {
 			"end":           end,
 			"block_added":   added,
 			"block_fetched": blockfetched,
+			"state_sync":    stateSync,
 		}
 	}
 
+	var stages map[string]interface{}
+	var peers []PeerFetchStat
 	if syncer.blockFetcher != nil {
 		lastblock := syncer.blockFetcher.stat.getLastAddBlock()
 		added = lastblock.BlockNo()
 		if syncer.blockFetcher.stat.getMaxChunkRsp() != nil {
 			blockfetched = syncer.blockFetcher.stat.getMaxChunkRsp().BlockNo()
 		}
+		stages = syncer.blockFetcher.stat.stages()
+		if syncer.headerFetcher != nil {
+			stages["header"] = syncer.headerFetcher.stat.Map()
+		}
+		peers = syncer.blockFetcher.stat.PeerStats()
 	}
 
 	return &map[string]interface{}{
@@ -457,6 +529,9 @@ func (syncer *Syncer) Statistics() *map[string]interface{} {
 		"end":           end,
 		"block_added":   added,
 		"block_fetched": blockfetched,
+		"stages":        stages,
+		"peers":         peers,
+		"state_sync":    stateSync,
 	}
 }
 
@@ -143,6 +143,12 @@ type ChainAccessor interface {
 	ChainID(bno BlockNo) *ChainID
 }
 
+// StateChunkReader is implemented by chain accessors which serve leaves of state tries and sql databases of
+// contracts to peers syncing state
+type StateChunkReader interface {
+	GetStateChunk(req *GetStateChunkRequest) *GetStateChunkResponse
+}
+
 type SyncContext struct {
 	Seq uint64
 
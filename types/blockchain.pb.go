@@ -820,11 +820,12 @@ func (m *ContractVarProof) GetKey() []byte {
 }
 
 type StateQueryProof struct {
-	ContractProof        *AccountProof       `protobuf:"bytes,1,opt,name=contractProof" json:"contractProof,omitempty"`
-	VarProofs            []*ContractVarProof `protobuf:"bytes,2,rep,name=varProofs" json:"varProofs,omitempty"`
-	XXX_NoUnkeyedLiteral struct{}            `json:"-"`
-	XXX_unrecognized     []byte              `json:"-"`
-	XXX_sizecache        int32               `json:"-"`
+	ContractProof        *AccountProof          `protobuf:"bytes,1,opt,name=contractProof" json:"contractProof,omitempty"`
+	VarProofs            []*ContractVarProof    `protobuf:"bytes,2,rep,name=varProofs" json:"varProofs,omitempty"`
+	VarMultiProof        *ContractVarMultiProof `protobuf:"bytes,3,opt,name=varMultiProof" json:"varMultiProof,omitempty"`
+	XXX_NoUnkeyedLiteral struct{}               `json:"-"`
+	XXX_unrecognized     []byte                 `json:"-"`
+	XXX_sizecache        int32                  `json:"-"`
 }
 
 func (m *StateQueryProof) Reset()         { *m = StateQueryProof{} }
@@ -865,6 +866,66 @@ func (m *StateQueryProof) GetVarProofs() []*ContractVarProof {
 	return nil
 }
 
+func (m *StateQueryProof) GetVarMultiProof() *ContractVarMultiProof {
+	if m != nil {
+		return m.VarMultiProof
+	}
+	return nil
+}
+
+// ContractVarMultiProof is a merkle proof of several contract variables which shares the audit path.
+// VarProofs are ordered by key, and have no bitmap and audit path of their own.
+type ContractVarMultiProof struct {
+	Bitmap               []byte              `protobuf:"bytes,1,opt,name=bitmap,proto3" json:"bitmap,omitempty"`
+	AuditPath            [][]byte            `protobuf:"bytes,2,rep,name=auditPath,proto3" json:"auditPath,omitempty"`
+	VarProofs            []*ContractVarProof `protobuf:"bytes,3,rep,name=varProofs" json:"varProofs,omitempty"`
+	XXX_NoUnkeyedLiteral struct{}            `json:"-"`
+	XXX_unrecognized     []byte              `json:"-"`
+	XXX_sizecache        int32               `json:"-"`
+}
+
+func (m *ContractVarMultiProof) Reset()         { *m = ContractVarMultiProof{} }
+func (m *ContractVarMultiProof) String() string { return proto.CompactTextString(m) }
+func (*ContractVarMultiProof) ProtoMessage()    {}
+func (m *ContractVarMultiProof) XXX_Unmarshal(b []byte) error {
+	return xxx_messageInfo_ContractVarMultiProof.Unmarshal(m, b)
+}
+func (m *ContractVarMultiProof) XXX_Marshal(b []byte, deterministic bool) ([]byte, error) {
+	return xxx_messageInfo_ContractVarMultiProof.Marshal(b, m, deterministic)
+}
+func (dst *ContractVarMultiProof) XXX_Merge(src proto.Message) {
+	xxx_messageInfo_ContractVarMultiProof.Merge(dst, src)
+}
+func (m *ContractVarMultiProof) XXX_Size() int {
+	return xxx_messageInfo_ContractVarMultiProof.Size(m)
+}
+func (m *ContractVarMultiProof) XXX_DiscardUnknown() {
+	xxx_messageInfo_ContractVarMultiProof.DiscardUnknown(m)
+}
+
+var xxx_messageInfo_ContractVarMultiProof proto.InternalMessageInfo
+
+func (m *ContractVarMultiProof) GetBitmap() []byte {
+	if m != nil {
+		return m.Bitmap
+	}
+	return nil
+}
+
+func (m *ContractVarMultiProof) GetAuditPath() [][]byte {
+	if m != nil {
+		return m.AuditPath
+	}
+	return nil
+}
+
+func (m *ContractVarMultiProof) GetVarProofs() []*ContractVarProof {
+	if m != nil {
+		return m.VarProofs
+	}
+	return nil
+}
+
 type Receipt struct {
 	ContractAddress      []byte   `protobuf:"bytes,1,opt,name=contractAddress,proto3" json:"contractAddress,omitempty"`
 	Status               string   `protobuf:"bytes,2,opt,name=status" json:"status,omitempty"`
@@ -1384,6 +1445,7 @@ type StateQuery struct {
 	Root                 []byte   `protobuf:"bytes,3,opt,name=root,proto3" json:"root,omitempty"`
 	Compressed           bool     `protobuf:"varint,4,opt,name=compressed" json:"compressed,omitempty"`
 	StorageKeys          [][]byte `protobuf:"bytes,5,rep,name=storageKeys,proto3" json:"storageKeys,omitempty"`
+	MultiProof           bool     `protobuf:"varint,6,opt,name=multiProof" json:"multiProof,omitempty"`
 	XXX_NoUnkeyedLiteral struct{} `json:"-"`
 	XXX_unrecognized     []byte   `json:"-"`
 	XXX_sizecache        int32    `json:"-"`
@@ -1441,6 +1503,13 @@ func (m *StateQuery) GetStorageKeys() [][]byte {
 	return nil
 }
 
+func (m *StateQuery) GetMultiProof() bool {
+	if m != nil {
+		return m.MultiProof
+	}
+	return false
+}
+
 type FilterInfo struct {
 	ContractAddress      []byte   `protobuf:"bytes,1,opt,name=contractAddress,proto3" json:"contractAddress,omitempty"`
 	EventName            string   `protobuf:"bytes,2,opt,name=eventName" json:"eventName,omitempty"`
@@ -1449,6 +1518,8 @@ type FilterInfo struct {
 	Desc                 bool     `protobuf:"varint,5,opt,name=desc" json:"desc,omitempty"`
 	ArgFilter            []byte   `protobuf:"bytes,6,opt,name=argFilter,proto3" json:"argFilter,omitempty"`
 	RecentBlockCnt       int32    `protobuf:"varint,7,opt,name=recentBlockCnt" json:"recentBlockCnt,omitempty"`
+	Offset               int32    `protobuf:"varint,8,opt,name=offset" json:"offset,omitempty"`
+	Limit                int32    `protobuf:"varint,9,opt,name=limit" json:"limit,omitempty"`
 	XXX_NoUnkeyedLiteral struct{} `json:"-"`
 	XXX_unrecognized     []byte   `json:"-"`
 	XXX_sizecache        int32    `json:"-"`
@@ -1527,6 +1598,20 @@ func (m *FilterInfo) GetRecentBlockCnt() int32 {
 	return 0
 }
 
+func (m *FilterInfo) GetOffset() int32 {
+	if m != nil {
+		return m.Offset
+	}
+	return 0
+}
+
+func (m *FilterInfo) GetLimit() int32 {
+	if m != nil {
+		return m.Limit
+	}
+	return 0
+}
+
 type Proposal struct {
 	Id                   string   `protobuf:"bytes,1,opt,name=id" json:"id,omitempty"`
 	Description          string   `protobuf:"bytes,3,opt,name=description" json:"description,omitempty"`
@@ -1594,6 +1679,7 @@ func init() {
 	proto.RegisterType((*AccountProof)(nil), "types.AccountProof")
 	proto.RegisterType((*ContractVarProof)(nil), "types.ContractVarProof")
 	proto.RegisterType((*StateQueryProof)(nil), "types.StateQueryProof")
+	proto.RegisterType((*ContractVarMultiProof)(nil), "types.ContractVarMultiProof")
 	proto.RegisterType((*Receipt)(nil), "types.Receipt")
 	proto.RegisterType((*Event)(nil), "types.Event")
 	proto.RegisterType((*FnArgument)(nil), "types.FnArgument")
@@ -382,7 +382,9 @@ type Status struct {
 	Genesis      []byte              `protobuf:"bytes,7,opt,name=genesis,proto3" json:"genesis,omitempty"`
 	Certificates []*AgentCertificate `protobuf:"bytes,8,rep,name=certificates" json:"certificates,omitempty"`
 	// request to issue agent certificates
-	IssueCertificate     bool     `protobuf:"varint,9,opt,name=issueCertificate" json:"issueCertificate,omitempty"`
+	IssueCertificate bool `protobuf:"varint,9,opt,name=issueCertificate" json:"issueCertificate,omitempty"`
+	// bit flags of optional p2p features which sender supports.
+	Capabilities         uint64   `protobuf:"varint,10,opt,name=capabilities" json:"capabilities,omitempty"`
 	XXX_NoUnkeyedLiteral struct{} `json:"-"`
 	XXX_unrecognized     []byte   `json:"-"`
 	XXX_sizecache        int32    `json:"-"`
@@ -475,6 +477,13 @@ func (m *Status) GetIssueCertificate() bool {
 	return false
 }
 
+func (m *Status) GetCapabilities() uint64 {
+	if m != nil {
+		return m.Capabilities
+	}
+	return 0
+}
+
 // GoAwayNotice is sent before host peer is closing connection to remote peer. it contains why the host closing connection.
 type GoAwayNotice struct {
 	Message              string   `protobuf:"bytes,1,opt,name=message" json:"message,omitempty"`
@@ -1536,6 +1545,523 @@ func (m *CertificateRenewedNotice) GetCertificate() *AgentCertificate {
 	return nil
 }
 
+// NewTxShortNotice is compact form of NewTransactionsNotice. tx hashes are sent as salted short ids.
+type NewTxShortNotice struct {
+	// salt is per-connection key to make short ids, and is not changed during connection
+	Salt []byte `protobuf:"bytes,1,opt,name=salt,proto3" json:"salt,omitempty"`
+	// shortIDs is list of 64bit SipHash-2-4 of tx hashes, keyed by salt
+	ShortIDs             []uint64 `protobuf:"fixed64,2,rep,packed,name=shortIDs" json:"shortIDs,omitempty"`
+	XXX_NoUnkeyedLiteral struct{} `json:"-"`
+	XXX_unrecognized     []byte   `json:"-"`
+	XXX_sizecache        int32    `json:"-"`
+}
+
+func (m *NewTxShortNotice) Reset()         { *m = NewTxShortNotice{} }
+func (m *NewTxShortNotice) String() string { return proto.CompactTextString(m) }
+func (*NewTxShortNotice) ProtoMessage()    {}
+func (m *NewTxShortNotice) XXX_Unmarshal(b []byte) error {
+	return xxx_messageInfo_NewTxShortNotice.Unmarshal(m, b)
+}
+func (m *NewTxShortNotice) XXX_Marshal(b []byte, deterministic bool) ([]byte, error) {
+	return xxx_messageInfo_NewTxShortNotice.Marshal(b, m, deterministic)
+}
+func (dst *NewTxShortNotice) XXX_Merge(src proto.Message) {
+	xxx_messageInfo_NewTxShortNotice.Merge(dst, src)
+}
+func (m *NewTxShortNotice) XXX_Size() int {
+	return xxx_messageInfo_NewTxShortNotice.Size(m)
+}
+func (m *NewTxShortNotice) XXX_DiscardUnknown() {
+	xxx_messageInfo_NewTxShortNotice.DiscardUnknown(m)
+}
+
+var xxx_messageInfo_NewTxShortNotice proto.InternalMessageInfo
+
+func (m *NewTxShortNotice) GetSalt() []byte {
+	if m != nil {
+		return m.Salt
+	}
+	return nil
+}
+
+func (m *NewTxShortNotice) GetShortIDs() []uint64 {
+	if m != nil {
+		return m.ShortIDs
+	}
+	return nil
+}
+
+// GetTxHashesRequest is request to get full tx hashes of short ids which the requester can not resolve
+// by itself, because of unknown or collided short ids.
+type GetTxHashesRequest struct {
+	ShortIDs             []uint64 `protobuf:"fixed64,1,rep,packed,name=shortIDs" json:"shortIDs,omitempty"`
+	XXX_NoUnkeyedLiteral struct{} `json:"-"`
+	XXX_unrecognized     []byte   `json:"-"`
+	XXX_sizecache        int32    `json:"-"`
+}
+
+func (m *GetTxHashesRequest) Reset()         { *m = GetTxHashesRequest{} }
+func (m *GetTxHashesRequest) String() string { return proto.CompactTextString(m) }
+func (*GetTxHashesRequest) ProtoMessage()    {}
+func (m *GetTxHashesRequest) XXX_Unmarshal(b []byte) error {
+	return xxx_messageInfo_GetTxHashesRequest.Unmarshal(m, b)
+}
+func (m *GetTxHashesRequest) XXX_Marshal(b []byte, deterministic bool) ([]byte, error) {
+	return xxx_messageInfo_GetTxHashesRequest.Marshal(b, m, deterministic)
+}
+func (dst *GetTxHashesRequest) XXX_Merge(src proto.Message) {
+	xxx_messageInfo_GetTxHashesRequest.Merge(dst, src)
+}
+func (m *GetTxHashesRequest) XXX_Size() int {
+	return xxx_messageInfo_GetTxHashesRequest.Size(m)
+}
+func (m *GetTxHashesRequest) XXX_DiscardUnknown() {
+	xxx_messageInfo_GetTxHashesRequest.DiscardUnknown(m)
+}
+
+var xxx_messageInfo_GetTxHashesRequest proto.InternalMessageInfo
+
+func (m *GetTxHashesRequest) GetShortIDs() []uint64 {
+	if m != nil {
+		return m.ShortIDs
+	}
+	return nil
+}
+
+type GetTxHashesResponse struct {
+	Status               ResultStatus `protobuf:"varint,1,opt,name=status,enum=types.ResultStatus" json:"status,omitempty"`
+	Hashes               [][]byte     `protobuf:"bytes,2,rep,name=hashes,proto3" json:"hashes,omitempty"`
+	XXX_NoUnkeyedLiteral struct{}     `json:"-"`
+	XXX_unrecognized     []byte       `json:"-"`
+	XXX_sizecache        int32        `json:"-"`
+}
+
+func (m *GetTxHashesResponse) Reset()         { *m = GetTxHashesResponse{} }
+func (m *GetTxHashesResponse) String() string { return proto.CompactTextString(m) }
+func (*GetTxHashesResponse) ProtoMessage()    {}
+func (m *GetTxHashesResponse) XXX_Unmarshal(b []byte) error {
+	return xxx_messageInfo_GetTxHashesResponse.Unmarshal(m, b)
+}
+func (m *GetTxHashesResponse) XXX_Marshal(b []byte, deterministic bool) ([]byte, error) {
+	return xxx_messageInfo_GetTxHashesResponse.Marshal(b, m, deterministic)
+}
+func (dst *GetTxHashesResponse) XXX_Merge(src proto.Message) {
+	xxx_messageInfo_GetTxHashesResponse.Merge(dst, src)
+}
+func (m *GetTxHashesResponse) XXX_Size() int {
+	return xxx_messageInfo_GetTxHashesResponse.Size(m)
+}
+func (m *GetTxHashesResponse) XXX_DiscardUnknown() {
+	xxx_messageInfo_GetTxHashesResponse.DiscardUnknown(m)
+}
+
+var xxx_messageInfo_GetTxHashesResponse proto.InternalMessageInfo
+
+func (m *GetTxHashesResponse) GetStatus() ResultStatus {
+	if m != nil {
+		return m.Status
+	}
+	return ResultStatus_OK
+}
+
+func (m *GetTxHashesResponse) GetHashes() [][]byte {
+	if m != nil {
+		return m.Hashes
+	}
+	return nil
+}
+
+// CompactBlockNotice is compact form of BlockProducedNotice. Receiver reconstructs block
+// with txs in its own mempool and requests the missing txs to sender.
+type CompactBlockNotice struct {
+	ProducerID []byte `protobuf:"bytes,1,opt,name=producerID,proto3" json:"producerID,omitempty"`
+	BlockNo    uint64 `protobuf:"varint,2,opt,name=blockNo" json:"blockNo,omitempty"`
+	// block without body
+	Block *Block `protobuf:"bytes,3,opt,name=block" json:"block,omitempty"`
+	// hashes of all txs in block, in order
+	TxHashes [][]byte `protobuf:"bytes,4,rep,name=txHashes,proto3" json:"txHashes,omitempty"`
+	// txs which receiver is not expected to have
+	Prefilled            []*Tx    `protobuf:"bytes,5,rep,name=prefilled" json:"prefilled,omitempty"`
+	XXX_NoUnkeyedLiteral struct{} `json:"-"`
+	XXX_unrecognized     []byte   `json:"-"`
+	XXX_sizecache        int32    `json:"-"`
+}
+
+func (m *CompactBlockNotice) Reset()         { *m = CompactBlockNotice{} }
+func (m *CompactBlockNotice) String() string { return proto.CompactTextString(m) }
+func (*CompactBlockNotice) ProtoMessage()    {}
+func (m *CompactBlockNotice) XXX_Unmarshal(b []byte) error {
+	return xxx_messageInfo_CompactBlockNotice.Unmarshal(m, b)
+}
+func (m *CompactBlockNotice) XXX_Marshal(b []byte, deterministic bool) ([]byte, error) {
+	return xxx_messageInfo_CompactBlockNotice.Marshal(b, m, deterministic)
+}
+func (dst *CompactBlockNotice) XXX_Merge(src proto.Message) {
+	xxx_messageInfo_CompactBlockNotice.Merge(dst, src)
+}
+func (m *CompactBlockNotice) XXX_Size() int {
+	return xxx_messageInfo_CompactBlockNotice.Size(m)
+}
+func (m *CompactBlockNotice) XXX_DiscardUnknown() {
+	xxx_messageInfo_CompactBlockNotice.DiscardUnknown(m)
+}
+
+var xxx_messageInfo_CompactBlockNotice proto.InternalMessageInfo
+
+func (m *CompactBlockNotice) GetProducerID() []byte {
+	if m != nil {
+		return m.ProducerID
+	}
+	return nil
+}
+
+func (m *CompactBlockNotice) GetBlockNo() uint64 {
+	if m != nil {
+		return m.BlockNo
+	}
+	return 0
+}
+
+func (m *CompactBlockNotice) GetBlock() *Block {
+	if m != nil {
+		return m.Block
+	}
+	return nil
+}
+
+func (m *CompactBlockNotice) GetTxHashes() [][]byte {
+	if m != nil {
+		return m.TxHashes
+	}
+	return nil
+}
+
+func (m *CompactBlockNotice) GetPrefilled() []*Tx {
+	if m != nil {
+		return m.Prefilled
+	}
+	return nil
+}
+
+type GetBlockTxsRequest struct {
+	BlockHash            []byte   `protobuf:"bytes,1,opt,name=blockHash,proto3" json:"blockHash,omitempty"`
+	Indexes              []uint32 `protobuf:"varint,2,rep,packed,name=indexes" json:"indexes,omitempty"`
+	XXX_NoUnkeyedLiteral struct{} `json:"-"`
+	XXX_unrecognized     []byte   `json:"-"`
+	XXX_sizecache        int32    `json:"-"`
+}
+
+func (m *GetBlockTxsRequest) Reset()         { *m = GetBlockTxsRequest{} }
+func (m *GetBlockTxsRequest) String() string { return proto.CompactTextString(m) }
+func (*GetBlockTxsRequest) ProtoMessage()    {}
+func (m *GetBlockTxsRequest) XXX_Unmarshal(b []byte) error {
+	return xxx_messageInfo_GetBlockTxsRequest.Unmarshal(m, b)
+}
+func (m *GetBlockTxsRequest) XXX_Marshal(b []byte, deterministic bool) ([]byte, error) {
+	return xxx_messageInfo_GetBlockTxsRequest.Marshal(b, m, deterministic)
+}
+func (dst *GetBlockTxsRequest) XXX_Merge(src proto.Message) {
+	xxx_messageInfo_GetBlockTxsRequest.Merge(dst, src)
+}
+func (m *GetBlockTxsRequest) XXX_Size() int {
+	return xxx_messageInfo_GetBlockTxsRequest.Size(m)
+}
+func (m *GetBlockTxsRequest) XXX_DiscardUnknown() {
+	xxx_messageInfo_GetBlockTxsRequest.DiscardUnknown(m)
+}
+
+var xxx_messageInfo_GetBlockTxsRequest proto.InternalMessageInfo
+
+func (m *GetBlockTxsRequest) GetBlockHash() []byte {
+	if m != nil {
+		return m.BlockHash
+	}
+	return nil
+}
+
+func (m *GetBlockTxsRequest) GetIndexes() []uint32 {
+	if m != nil {
+		return m.Indexes
+	}
+	return nil
+}
+
+type GetBlockTxsResponse struct {
+	Status               ResultStatus `protobuf:"varint,1,opt,name=status,enum=types.ResultStatus" json:"status,omitempty"`
+	BlockHash            []byte       `protobuf:"bytes,2,opt,name=blockHash,proto3" json:"blockHash,omitempty"`
+	Txs                  []*Tx        `protobuf:"bytes,3,rep,name=txs" json:"txs,omitempty"`
+	XXX_NoUnkeyedLiteral struct{}     `json:"-"`
+	XXX_unrecognized     []byte       `json:"-"`
+	XXX_sizecache        int32        `json:"-"`
+}
+
+func (m *GetBlockTxsResponse) Reset()         { *m = GetBlockTxsResponse{} }
+func (m *GetBlockTxsResponse) String() string { return proto.CompactTextString(m) }
+func (*GetBlockTxsResponse) ProtoMessage()    {}
+func (m *GetBlockTxsResponse) XXX_Unmarshal(b []byte) error {
+	return xxx_messageInfo_GetBlockTxsResponse.Unmarshal(m, b)
+}
+func (m *GetBlockTxsResponse) XXX_Marshal(b []byte, deterministic bool) ([]byte, error) {
+	return xxx_messageInfo_GetBlockTxsResponse.Marshal(b, m, deterministic)
+}
+func (dst *GetBlockTxsResponse) XXX_Merge(src proto.Message) {
+	xxx_messageInfo_GetBlockTxsResponse.Merge(dst, src)
+}
+func (m *GetBlockTxsResponse) XXX_Size() int {
+	return xxx_messageInfo_GetBlockTxsResponse.Size(m)
+}
+func (m *GetBlockTxsResponse) XXX_DiscardUnknown() {
+	xxx_messageInfo_GetBlockTxsResponse.DiscardUnknown(m)
+}
+
+var xxx_messageInfo_GetBlockTxsResponse proto.InternalMessageInfo
+
+func (m *GetBlockTxsResponse) GetStatus() ResultStatus {
+	if m != nil {
+		return m.Status
+	}
+	return ResultStatus_OK
+}
+
+func (m *GetBlockTxsResponse) GetBlockHash() []byte {
+	if m != nil {
+		return m.BlockHash
+	}
+	return nil
+}
+
+func (m *GetBlockTxsResponse) GetTxs() []*Tx {
+	if m != nil {
+		return m.Txs
+	}
+	return nil
+}
+
+// GetStateChunkRequest is request to get leaves of a state trie in range [start, end), to sync state of a block
+// without executing blocks.
+type GetStateChunkRequest struct {
+	// root of account trie or contract storage trie
+	Root []byte `protobuf:"bytes,1,opt,name=root,proto3" json:"root,omitempty"`
+	// start is the first key of range. empty means the beginning of trie
+	Start []byte `protobuf:"bytes,2,opt,name=start,proto3" json:"start,omitempty"`
+	// end is the exclusive last key of range. empty means the end of trie
+	End []byte `protobuf:"bytes,3,opt,name=end,proto3" json:"end,omitempty"`
+	// maximum count of leaves that want to get
+	Limit uint32 `protobuf:"varint,4,opt,name=limit" json:"limit,omitempty"`
+	// accounts is true if root is the root of accounts, to get contract codes together
+	Accounts bool `protobuf:"varint,5,opt,name=accounts" json:"accounts,omitempty"`
+	// stateRoot is the finalized root of accounts which has the contract storage of root. required if accounts is false
+	StateRoot []byte `protobuf:"bytes,6,opt,name=stateRoot,proto3" json:"stateRoot,omitempty"`
+	// account is the key of the contract in the account trie. required if accounts is false
+	Account []byte `protobuf:"bytes,7,opt,name=account,proto3" json:"account,omitempty"`
+	// sql is true to get the sql database of the contract of account in stateRoot, instead of leaves
+	Sql bool `protobuf:"varint,8,opt,name=sql" json:"sql,omitempty"`
+	// offset is the position in the sql database to read from
+	Offset uint64 `protobuf:"varint,9,opt,name=offset" json:"offset,omitempty"`
+	// snapshot is the snapshot of the sql database given by the first response. 0 to start reading a new snapshot
+	Snapshot             uint64   `protobuf:"varint,10,opt,name=snapshot" json:"snapshot,omitempty"`
+	XXX_NoUnkeyedLiteral struct{} `json:"-"`
+	XXX_unrecognized     []byte   `json:"-"`
+	XXX_sizecache        int32    `json:"-"`
+}
+
+func (m *GetStateChunkRequest) Reset()         { *m = GetStateChunkRequest{} }
+func (m *GetStateChunkRequest) String() string { return proto.CompactTextString(m) }
+func (*GetStateChunkRequest) ProtoMessage()    {}
+func (m *GetStateChunkRequest) XXX_Unmarshal(b []byte) error {
+	return xxx_messageInfo_GetStateChunkRequest.Unmarshal(m, b)
+}
+func (m *GetStateChunkRequest) XXX_Marshal(b []byte, deterministic bool) ([]byte, error) {
+	return xxx_messageInfo_GetStateChunkRequest.Marshal(b, m, deterministic)
+}
+func (dst *GetStateChunkRequest) XXX_Merge(src proto.Message) {
+	xxx_messageInfo_GetStateChunkRequest.Merge(dst, src)
+}
+func (m *GetStateChunkRequest) XXX_Size() int {
+	return xxx_messageInfo_GetStateChunkRequest.Size(m)
+}
+func (m *GetStateChunkRequest) XXX_DiscardUnknown() {
+	xxx_messageInfo_GetStateChunkRequest.DiscardUnknown(m)
+}
+
+var xxx_messageInfo_GetStateChunkRequest proto.InternalMessageInfo
+
+func (m *GetStateChunkRequest) GetRoot() []byte {
+	if m != nil {
+		return m.Root
+	}
+	return nil
+}
+
+func (m *GetStateChunkRequest) GetStart() []byte {
+	if m != nil {
+		return m.Start
+	}
+	return nil
+}
+
+func (m *GetStateChunkRequest) GetEnd() []byte {
+	if m != nil {
+		return m.End
+	}
+	return nil
+}
+
+func (m *GetStateChunkRequest) GetLimit() uint32 {
+	if m != nil {
+		return m.Limit
+	}
+	return 0
+}
+
+func (m *GetStateChunkRequest) GetAccounts() bool {
+	if m != nil {
+		return m.Accounts
+	}
+	return false
+}
+
+func (m *GetStateChunkRequest) GetStateRoot() []byte {
+	if m != nil {
+		return m.StateRoot
+	}
+	return nil
+}
+
+func (m *GetStateChunkRequest) GetAccount() []byte {
+	if m != nil {
+		return m.Account
+	}
+	return nil
+}
+
+func (m *GetStateChunkRequest) GetSql() bool {
+	if m != nil {
+		return m.Sql
+	}
+	return false
+}
+
+func (m *GetStateChunkRequest) GetOffset() uint64 {
+	if m != nil {
+		return m.Offset
+	}
+	return 0
+}
+
+func (m *GetStateChunkRequest) GetSnapshot() uint64 {
+	if m != nil {
+		return m.Snapshot
+	}
+	return 0
+}
+
+type GetStateChunkResponse struct {
+	Status ResultStatus `protobuf:"varint,1,opt,name=status,enum=types.ResultStatus" json:"status,omitempty"`
+	Keys   [][]byte     `protobuf:"bytes,2,rep,name=keys,proto3" json:"keys,omitempty"`
+	// values are raw values of leaves, which are hashed to leaves
+	Values [][]byte `protobuf:"bytes,3,rep,name=values,proto3" json:"values,omitempty"`
+	// codes are contract codes of accounts in response
+	Codes [][]byte `protobuf:"bytes,4,rep,name=codes,proto3" json:"codes,omitempty"`
+	// next is the first key after keys in range. empty if there is no more leaf in range
+	Next []byte `protobuf:"bytes,5,opt,name=next,proto3" json:"next,omitempty"`
+	// proof is the range proof of keys from the start of range to next, or the end of range if next is empty
+	Proof *ContractVarMultiProof `protobuf:"bytes,6,opt,name=proof" json:"proof,omitempty"`
+	// sqlData is the part of the sql database from the requested offset
+	SqlData []byte `protobuf:"bytes,7,opt,name=sqlData,proto3" json:"sqlData,omitempty"`
+	// sqlSize is the whole size of the sql database
+	SqlSize uint64 `protobuf:"varint,8,opt,name=sqlSize" json:"sqlSize,omitempty"`
+	// snapshot is the snapshot of the sql database which sqlData is read from
+	Snapshot             uint64   `protobuf:"varint,9,opt,name=snapshot" json:"snapshot,omitempty"`
+	XXX_NoUnkeyedLiteral struct{} `json:"-"`
+	XXX_unrecognized     []byte   `json:"-"`
+	XXX_sizecache        int32    `json:"-"`
+}
+
+func (m *GetStateChunkResponse) Reset()         { *m = GetStateChunkResponse{} }
+func (m *GetStateChunkResponse) String() string { return proto.CompactTextString(m) }
+func (*GetStateChunkResponse) ProtoMessage()    {}
+func (m *GetStateChunkResponse) XXX_Unmarshal(b []byte) error {
+	return xxx_messageInfo_GetStateChunkResponse.Unmarshal(m, b)
+}
+func (m *GetStateChunkResponse) XXX_Marshal(b []byte, deterministic bool) ([]byte, error) {
+	return xxx_messageInfo_GetStateChunkResponse.Marshal(b, m, deterministic)
+}
+func (dst *GetStateChunkResponse) XXX_Merge(src proto.Message) {
+	xxx_messageInfo_GetStateChunkResponse.Merge(dst, src)
+}
+func (m *GetStateChunkResponse) XXX_Size() int {
+	return xxx_messageInfo_GetStateChunkResponse.Size(m)
+}
+func (m *GetStateChunkResponse) XXX_DiscardUnknown() {
+	xxx_messageInfo_GetStateChunkResponse.DiscardUnknown(m)
+}
+
+var xxx_messageInfo_GetStateChunkResponse proto.InternalMessageInfo
+
+func (m *GetStateChunkResponse) GetStatus() ResultStatus {
+	if m != nil {
+		return m.Status
+	}
+	return ResultStatus_OK
+}
+
+func (m *GetStateChunkResponse) GetKeys() [][]byte {
+	if m != nil {
+		return m.Keys
+	}
+	return nil
+}
+
+func (m *GetStateChunkResponse) GetValues() [][]byte {
+	if m != nil {
+		return m.Values
+	}
+	return nil
+}
+
+func (m *GetStateChunkResponse) GetCodes() [][]byte {
+	if m != nil {
+		return m.Codes
+	}
+	return nil
+}
+
+func (m *GetStateChunkResponse) GetNext() []byte {
+	if m != nil {
+		return m.Next
+	}
+	return nil
+}
+
+func (m *GetStateChunkResponse) GetProof() *ContractVarMultiProof {
+	if m != nil {
+		return m.Proof
+	}
+	return nil
+}
+
+func (m *GetStateChunkResponse) GetSqlData() []byte {
+	if m != nil {
+		return m.SqlData
+	}
+	return nil
+}
+
+func (m *GetStateChunkResponse) GetSqlSize() uint64 {
+	if m != nil {
+		return m.SqlSize
+	}
+	return 0
+}
+
+func (m *GetStateChunkResponse) GetSnapshot() uint64 {
+	if m != nil {
+		return m.Snapshot
+	}
+	return 0
+}
+
 func init() {
 	proto.RegisterType((*MsgHeader)(nil), "types.MsgHeader")
 	proto.RegisterType((*P2PMessage)(nil), "types.P2PMessage")
@@ -1564,6 +2090,14 @@ func init() {
 	proto.RegisterType((*IssueCertificateRequest)(nil), "types.IssueCertificateRequest")
 	proto.RegisterType((*IssueCertificateResponse)(nil), "types.IssueCertificateResponse")
 	proto.RegisterType((*CertificateRenewedNotice)(nil), "types.CertificateRenewedNotice")
+	proto.RegisterType((*NewTxShortNotice)(nil), "types.NewTxShortNotice")
+	proto.RegisterType((*GetTxHashesRequest)(nil), "types.GetTxHashesRequest")
+	proto.RegisterType((*GetTxHashesResponse)(nil), "types.GetTxHashesResponse")
+	proto.RegisterType((*CompactBlockNotice)(nil), "types.CompactBlockNotice")
+	proto.RegisterType((*GetBlockTxsRequest)(nil), "types.GetBlockTxsRequest")
+	proto.RegisterType((*GetBlockTxsResponse)(nil), "types.GetBlockTxsResponse")
+	proto.RegisterType((*GetStateChunkRequest)(nil), "types.GetStateChunkRequest")
+	proto.RegisterType((*GetStateChunkResponse)(nil), "types.GetStateChunkResponse")
 	proto.RegisterEnum("types.ResultStatus", ResultStatus_name, ResultStatus_value)
 }
 
@@ -132,10 +132,50 @@ func (m *NewTransactionsNotice) MarshalZerologObject(e *zerolog.Event) {
 	e.Int("count",len(m.TxHashes)).Array("hashes", NewLogB58EncMarshaller(m.TxHashes, 10))
 }
 
+func (m *NewTxShortNotice) MarshalZerologObject(e *zerolog.Event) {
+	e.Int("count", len(m.ShortIDs))
+}
+
+func (m *GetTxHashesRequest) MarshalZerologObject(e *zerolog.Event) {
+	e.Int("count", len(m.ShortIDs))
+}
+
+func (m *GetTxHashesResponse) MarshalZerologObject(e *zerolog.Event) {
+	e.Str(LogRespStatus, m.Status.String()).Int("count", len(m.Hashes)).Array("hashes", NewLogB58EncMarshaller(m.Hashes, 10))
+}
+
+func (m *GetStateChunkRequest) MarshalZerologObject(e *zerolog.Event) {
+	if m.Sql {
+		e.Str("account", enc.ToString(m.Account)).Uint64("offset", m.Offset).Uint64("snapshot", m.Snapshot)
+		return
+	}
+	e.Str("root", enc.ToString(m.Root)).Str("start", enc.ToString(m.Start)).Str("end", enc.ToString(m.End)).Uint32("limit", m.Limit)
+}
+
+func (m *GetStateChunkResponse) MarshalZerologObject(e *zerolog.Event) {
+	if m.Snapshot != 0 {
+		e.Str(LogRespStatus, m.Status.String()).Int("sql_data", len(m.SqlData)).Uint64("sql_size", m.SqlSize)
+		return
+	}
+	e.Str(LogRespStatus, m.Status.String()).Int("count", len(m.Keys)).Int("codes", len(m.Codes)).Str("next", enc.ToString(m.Next))
+}
+
 func (m *BlockProducedNotice) MarshalZerologObject(e *zerolog.Event) {
 	e.Str("bp", enc.ToString(m.ProducerID)).Uint64(LogBlkNo, m.BlockNo).Str(LogBlkHash, enc.ToString(m.Block.Hash))
 }
 
+func (m *CompactBlockNotice) MarshalZerologObject(e *zerolog.Event) {
+	e.Str("bp", enc.ToString(m.ProducerID)).Uint64(LogBlkNo, m.BlockNo).Str(LogBlkHash, enc.ToString(m.Block.Hash)).Int("tx_cnt", len(m.TxHashes)).Int("prefilled", len(m.Prefilled))
+}
+
+func (m *GetBlockTxsRequest) MarshalZerologObject(e *zerolog.Event) {
+	e.Str(LogBlkHash, enc.ToString(m.BlockHash)).Int("count", len(m.Indexes))
+}
+
+func (m *GetBlockTxsResponse) MarshalZerologObject(e *zerolog.Event) {
+	e.Str(LogRespStatus, m.Status.String()).Str(LogBlkHash, enc.ToString(m.BlockHash)).Int("count", len(m.Txs))
+}
+
 func (m *Ping) MarshalZerologObject(e *zerolog.Event) {
 	e.Str(LogBlkHash, enc.ToString(m.BestBlockHash)).Uint64(LogBlkNo, m.BestHeight)
 }
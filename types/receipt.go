@@ -460,15 +460,14 @@ type ReceiptMerkle struct {
 }
 
 func (rm *ReceiptMerkle) GetHash() []byte {
-	h := sha256.New()
 	var b []byte
 	if rm.hardForkConfig.IsV2Fork(rm.blockNo) {
 		b, _ = rm.receipt.MarshalMerkleBinaryV2()
 	} else {
 		b, _ = rm.receipt.MarshalMerkleBinary()
 	}
-	h.Write(b)
-	return h.Sum(nil)
+	h := sha256.Sum256(b)
+	return h[:]
 }
 
 type Receipts struct {
@@ -536,14 +535,21 @@ func (rs *Receipts) MerkleRoot() []byte {
 }
 
 func (rs *Receipts) MarshalBinary() ([]byte, error) {
+	data, _, err := rs.marshalBinary()
+	return data, err
+}
+
+// marshalBinary returns binary of receipts, and start offsets of each receipt in it followed by the end offset.
+func (rs *Receipts) marshalBinary() ([]byte, []uint32, error) {
 	var b bytes.Buffer
 	l := make([]byte, 4)
+	offsets := make([]uint32, 0, len(rs.receipts)+1)
 
 	if rs.bloom != nil {
 		b.WriteByte(1)
 		bloomB, err := (*bloom.BloomFilter)(rs.bloom).GobEncode()
 		if err != nil {
-			return nil, err
+			return nil, nil, err
 		}
 		b.Write(bloomB[24:])
 	} else {
@@ -560,12 +566,78 @@ func (rs *Receipts) MarshalBinary() ([]byte, error) {
 			rB, err = r.marshalStoreBinary()
 		}
 		if err != nil {
-			return nil, err
+			return nil, nil, err
 		}
+		offsets = append(offsets, uint32(b.Len()))
 		b.Write(rB)
 	}
+	offsets = append(offsets, uint32(b.Len()))
 
-	return b.Bytes(), nil
+	return b.Bytes(), offsets, nil
+}
+
+// MarshalIndexedBinary returns binary of receipts prefixed by an offset table, so that a receipt can be
+// read by ReadIndexedReceipt without decoding the others.
+// The layout is receipt count(4) | offsets of receipts and the end(4 * (count+1)) | MarshalBinary()
+func (rs *Receipts) MarshalIndexedBinary() ([]byte, error) {
+	data, offsets, err := rs.marshalBinary()
+	if err != nil {
+		return nil, err
+	}
+	table := make([]byte, 4+4*len(offsets), 4+4*len(offsets)+len(data))
+	binary.LittleEndian.PutUint32(table, uint32(len(rs.receipts)))
+	for i, offset := range offsets {
+		binary.LittleEndian.PutUint32(table[4+4*i:], offset)
+	}
+	return append(table, data...), nil
+}
+
+func indexedReceiptsTable(data []byte) (uint32, []byte, error) {
+	if len(data) < 4 {
+		return 0, nil, errors.New("invalid indexed receipts")
+	}
+	count := binary.LittleEndian.Uint32(data)
+	tableLen := 4 + 4*(uint64(count)+1)
+	if uint64(len(data)) < tableLen {
+		return 0, nil, errors.New("invalid indexed receipts")
+	}
+	return count, data[4:tableLen], nil
+}
+
+// UnmarshalIndexedBinary reads all receipts from binary written by MarshalIndexedBinary.
+func (rs *Receipts) UnmarshalIndexedBinary(data []byte) error {
+	_, table, err := indexedReceiptsTable(data)
+	if err != nil {
+		return err
+	}
+	return rs.UnmarshalBinary(data[4+len(table):])
+}
+
+// ReadIndexedReceipt decodes only the receipt at idx from binary written by MarshalIndexedBinary.
+func ReadIndexedReceipt(data []byte, idx int32, hardForkConfig BlockVersionner, blockNo BlockNo) (*Receipt, error) {
+	count, table, err := indexedReceiptsTable(data)
+	if err != nil {
+		return nil, err
+	}
+	if idx < 0 || uint32(idx) >= count {
+		return nil, fmt.Errorf("cannot find a receipt: invalid index (%d)", idx)
+	}
+	body := data[4+len(table):]
+	start := binary.LittleEndian.Uint32(table[4*idx:])
+	end := binary.LittleEndian.Uint32(table[4*(idx+1):])
+	if start > end || uint64(end) > uint64(len(body)) {
+		return nil, errors.New("invalid indexed receipts")
+	}
+	var r Receipt
+	if hardForkConfig.IsV2Fork(blockNo) {
+		_, err = r.unmarshalStoreBinaryV2(body[start:end])
+	} else {
+		_, err = r.unmarshalStoreBinary(body[start:end])
+	}
+	if err != nil {
+		return nil, err
+	}
+	return &r, nil
 }
 
 func (rs *Receipts) UnmarshalBinary(data []byte) error {
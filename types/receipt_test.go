@@ -0,0 +1,84 @@
+package types
+
+import (
+	"fmt"
+	"testing"
+
+	"github.com/stretchr/testify/assert"
+)
+
+type testBlockVersionner bool
+
+func (v testBlockVersionner) Version(BlockNo) int32 {
+	if v {
+		return 2
+	}
+	return 0
+}
+
+func (v testBlockVersionner) IsV2Fork(BlockNo) bool {
+	return bool(v)
+}
+
+func TestIndexedReceipts(t *testing.T) {
+	for _, v2 := range []bool{false, true} {
+		var receipts Receipts
+		receipts.SetHardFork(testBlockVersionner(v2), 1)
+		var list []*Receipt
+		for i := 0; i < 5; i++ {
+			r := NewReceipt(AddressPadding([]byte("contract")), "SUCCESS", fmt.Sprintf(`{"ret":%d}`, i))
+			r.TxHash = make([]byte, 32)
+			r.TxHash[0] = byte(i)
+			for j := 0; j < i; j++ {
+				r.Events = append(r.Events, &Event{ContractAddress: r.ContractAddress, EventName: "ev",
+					JsonArgs: fmt.Sprintf("[%d]", j), TxHash: r.TxHash, EventIdx: int32(j)})
+			}
+			list = append(list, r)
+		}
+		receipts.Set(list)
+
+		data, err := receipts.MarshalIndexedBinary()
+		assert.NoError(t, err)
+		plain, _ := receipts.MarshalBinary()
+		assert.Equal(t, plain, data[4+4*(len(list)+1):])
+
+		var decoded Receipts
+		decoded.SetHardFork(testBlockVersionner(v2), 1)
+		assert.NoError(t, decoded.UnmarshalIndexedBinary(data))
+		assert.Equal(t, receipts.MerkleRoot(), decoded.MerkleRoot())
+
+		for i, expected := range list {
+			r, err := ReadIndexedReceipt(data, int32(i), testBlockVersionner(v2), 1)
+			assert.NoError(t, err)
+			assert.Equal(t, expected.Ret, r.Ret)
+			assert.Equal(t, expected.TxHash, r.TxHash)
+			assert.Equal(t, len(expected.Events), len(r.Events))
+			assert.Equal(t, decoded.Get()[i].Ret, r.Ret)
+		}
+		_, err = ReadIndexedReceipt(data, int32(len(list)), testBlockVersionner(v2), 1)
+		assert.Error(t, err)
+		_, err = ReadIndexedReceipt(data[:8], 0, testBlockVersionner(v2), 1)
+		assert.Error(t, err)
+	}
+}
+
+func BenchmarkReceiptsMerkleRoot(b *testing.B) {
+	for _, count := range []int{1000, 10000} {
+		var receipts Receipts
+		receipts.SetHardFork(testBlockVersionner(true), 1)
+		list := make([]*Receipt, count)
+		for i := range list {
+			r := NewReceipt(AddressPadding([]byte("contract")), "SUCCESS", fmt.Sprintf(`{"ret":%d}`, i))
+			r.TxHash = make([]byte, 32)
+			r.Events = []*Event{{ContractAddress: r.ContractAddress, EventName: "transfer", JsonArgs: `["a","b",1]`}}
+			list[i] = r
+		}
+		receipts.Set(list)
+		b.Run(fmt.Sprint(count), func(b *testing.B) {
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				receipts.MerkleRoot()
+			}
+		})
+	}
+}
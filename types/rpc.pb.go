@@ -2338,6 +2338,8 @@ type AergoRPCServiceClient interface {
 	VerifyTX(ctx context.Context, in *Tx, opts ...grpc.CallOption) (*VerifyResult, error)
 	// Commit a signed transaction
 	CommitTX(ctx context.Context, in *TxList, opts ...grpc.CallOption) (*CommitResultList, error)
+	// Commit batches of signed transactions through a stream, and receive results of batches in order
+	CommitTXStream(ctx context.Context, opts ...grpc.CallOption) (AergoRPCService_CommitTXStreamClient, error)
 	// Return state of account
 	GetState(ctx context.Context, in *SingleBytes, opts ...grpc.CallOption) (*State, error)
 	// Return state of account, including merkle proof
@@ -2618,6 +2620,37 @@ func (c *aergoRPCServiceClient) CommitTX(ctx context.Context, in *TxList, opts .
 	return out, nil
 }
 
+func (c *aergoRPCServiceClient) CommitTXStream(ctx context.Context, opts ...grpc.CallOption) (AergoRPCService_CommitTXStreamClient, error) {
+	stream, err := grpc.NewClientStream(ctx, &_AergoRPCService_serviceDesc.Streams[2], c.cc, "/types.AergoRPCService/CommitTXStream", opts...)
+	if err != nil {
+		return nil, err
+	}
+	x := &aergoRPCServiceCommitTXStreamClient{stream}
+	return x, nil
+}
+
+type AergoRPCService_CommitTXStreamClient interface {
+	Send(*TxList) error
+	Recv() (*CommitResultList, error)
+	grpc.ClientStream
+}
+
+type aergoRPCServiceCommitTXStreamClient struct {
+	grpc.ClientStream
+}
+
+func (x *aergoRPCServiceCommitTXStreamClient) Send(m *TxList) error {
+	return x.ClientStream.SendMsg(m)
+}
+
+func (x *aergoRPCServiceCommitTXStreamClient) Recv() (*CommitResultList, error) {
+	m := new(CommitResultList)
+	if err := x.ClientStream.RecvMsg(m); err != nil {
+		return nil, err
+	}
+	return m, nil
+}
+
 func (c *aergoRPCServiceClient) GetState(ctx context.Context, in *SingleBytes, opts ...grpc.CallOption) (*State, error) {
 	out := new(State)
 	err := grpc.Invoke(ctx, "/types.AergoRPCService/GetState", in, out, c.cc, opts...)
@@ -2763,7 +2796,7 @@ func (c *aergoRPCServiceClient) GetNameInfo(ctx context.Context, in *Name, opts
 }
 
 func (c *aergoRPCServiceClient) ListEventStream(ctx context.Context, in *FilterInfo, opts ...grpc.CallOption) (AergoRPCService_ListEventStreamClient, error) {
-	stream, err := grpc.NewClientStream(ctx, &_AergoRPCService_serviceDesc.Streams[2], c.cc, "/types.AergoRPCService/ListEventStream", opts...)
+	stream, err := grpc.NewClientStream(ctx, &_AergoRPCService_serviceDesc.Streams[3], c.cc, "/types.AergoRPCService/ListEventStream", opts...)
 	if err != nil {
 		return nil, err
 	}
@@ -2882,6 +2915,8 @@ type AergoRPCServiceServer interface {
 	VerifyTX(context.Context, *Tx) (*VerifyResult, error)
 	// Commit a signed transaction
 	CommitTX(context.Context, *TxList) (*CommitResultList, error)
+	// Commit batches of signed transactions through a stream, and receive results of batches in order
+	CommitTXStream(AergoRPCService_CommitTXStreamServer) error
 	// Return state of account
 	GetState(context.Context, *SingleBytes) (*State, error)
 	// Return state of account, including merkle proof
@@ -3298,6 +3333,32 @@ func _AergoRPCService_CommitTX_Handler(srv interface{}, ctx context.Context, dec
 	return interceptor(ctx, in, info, handler)
 }
 
+func _AergoRPCService_CommitTXStream_Handler(srv interface{}, stream grpc.ServerStream) error {
+	return srv.(AergoRPCServiceServer).CommitTXStream(&aergoRPCServiceCommitTXStreamServer{stream})
+}
+
+type AergoRPCService_CommitTXStreamServer interface {
+	Send(*CommitResultList) error
+	Recv() (*TxList, error)
+	grpc.ServerStream
+}
+
+type aergoRPCServiceCommitTXStreamServer struct {
+	grpc.ServerStream
+}
+
+func (x *aergoRPCServiceCommitTXStreamServer) Send(m *CommitResultList) error {
+	return x.ServerStream.SendMsg(m)
+}
+
+func (x *aergoRPCServiceCommitTXStreamServer) Recv() (*TxList, error) {
+	m := new(TxList)
+	if err := x.ServerStream.RecvMsg(m); err != nil {
+		return nil, err
+	}
+	return m, nil
+}
+
 func _AergoRPCService_GetState_Handler(srv interface{}, ctx context.Context, dec func(interface{}) error, interceptor grpc.UnaryServerInterceptor) (interface{}, error) {
 	in := new(SingleBytes)
 	if err := dec(in); err != nil {
@@ -3869,6 +3930,12 @@ var _AergoRPCService_serviceDesc = grpc.ServiceDesc{
 			Handler:       _AergoRPCService_ListBlockMetadataStream_Handler,
 			ServerStreams: true,
 		},
+		{
+			StreamName:    "CommitTXStream",
+			Handler:       _AergoRPCService_CommitTXStream_Handler,
+			ServerStreams: true,
+			ClientStreams: true,
+		},
 		{
 			StreamName:    "ListEventStream",
 			Handler:       _AergoRPCService_ListEventStream_Handler,
@@ -3881,169 +3948,169 @@ var _AergoRPCService_serviceDesc = grpc.ServiceDesc{
 func init() { proto.RegisterFile("rpc.proto", fileDescriptor_rpc_8d86ee9ecec344df) }
 
 var fileDescriptor_rpc_8d86ee9ecec344df = []byte{
-	// 2612 bytes of a gzipped FileDescriptorProto
-	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x9c, 0x59, 0xdd, 0x73, 0x1b, 0xb7,
-	0x11, 0x27, 0x29, 0x51, 0x22, 0x97, 0xa4, 0x44, 0xc1, 0xb2, 0xad, 0xb0, 0x89, 0xa3, 0xa2, 0x6e,
-	0xa2, 0xb8, 0x89, 0x1a, 0xd3, 0x49, 0x9a, 0x7e, 0x25, 0xa5, 0x18, 0xda, 0xe2, 0x58, 0xa6, 0x54,
-	0x90, 0x71, 0x95, 0x97, 0xb2, 0xa7, 0x3b, 0x90, 0xbc, 0x11, 0x79, 0x77, 0xb9, 0x03, 0xf5, 0x91,
-	0x99, 0x3e, 0xf5, 0xa9, 0xff, 0x41, 0x67, 0xfa, 0x5f, 0xf5, 0xbd, 0xd3, 0xfe, 0x29, 0x1d, 0x2c,
-	0x80, 0xfb, 0xa0, 0xce, 0x9d, 0xba, 0x6f, 0xb7, 0x8b, 0xdf, 0x7e, 0x01, 0x8b, 0xc5, 0x02, 0x07,
-	0xd5, 0x30, 0xb0, 0x0f, 0x83, 0xd0, 0x17, 0x3e, 0x29, 0x8b, 0xdb, 0x80, 0x47, 0xad, 0xe6, 0xc5,
-	0xdc, 0xb7, 0x2f, 0xed, 0x99, 0xe5, 0x7a, 0x6a, 0xa0, 0xd5, 0xb0, 0x6c, 0xdb, 0x5f, 0x7a, 0x42,
-	0x93, 0xe0, 0xf9, 0x0e, 0xd7, 0xdf, 0xd5, 0xa0, 0x1d, 0xe8, 0xcf, 0xfa, 0x82, 0x8b, 0xd0, 0xb5,
-	0x0d, 0x28, 0xb4, 0x26, 0x5a, 0x80, 0xfe, 0xbb, 0x08, 0xcd, 0xa3, 0x58, 0xe9, 0x50, 0x58, 0x62,
-	0x19, 0x91, 0x0f, 0x60, 0xfb, 0x82, 0x47, 0x62, 0x8c, 0xd6, 0xc6, 0x33, 0x2b, 0x9a, 0xed, 0x15,
-	0xf7, 0x8b, 0x07, 0x75, 0xd6, 0x90, 0x6c, 0x84, 0x1f, 0x5b, 0xd1, 0x8c, 0xbc, 0x0f, 0x35, 0xc4,
-	0xcd, 0xb8, 0x3b, 0x9d, 0x89, 0xbd, 0xd2, 0x7e, 0xf1, 0x60, 0x9d, 0x81, 0x64, 0x1d, 0x23, 0x87,
-	0xfc, 0x14, 0xb6, 0x6c, 0xdf, 0x8b, 0xb8, 0x17, 0x2d, 0xa3, 0xb1, 0xeb, 0x4d, 0xfc, 0xbd, 0xb5,
-	0xfd, 0xe2, 0x41, 0x95, 0x35, 0x62, 0x6e, 0xdf, 0x9b, 0xf8, 0xe4, 0x67, 0x40, 0x50, 0x0f, 0xfa,
-	0x30, 0x76, 0x1d, 0x65, 0x72, 0x1d, 0x4d, 0xa2, 0x27, 0x5d, 0x39, 0xd0, 0x77, 0xd0, 0xe8, 0xcf,
-	0x01, 0x34, 0x4e, 0xea, 0x2b, 0xef, 0x17, 0x0f, 0x6a, 0xed, 0xe6, 0x21, 0xce, 0xcf, 0xa1, 0xc2,
-	0x79, 0x13, 0x9f, 0x55, 0x6d, 0xf3, 0x49, 0xff, 0x5a, 0x84, 0x4d, 0xad, 0x80, 0xec, 0x42, 0x79,
-	0x61, 0x4d, 0x5d, 0x1b, 0xe3, 0xa9, 0x32, 0x45, 0x90, 0x07, 0xb0, 0x11, 0x2c, 0x2f, 0xe6, 0xae,
-	0x8d, 0x21, 0x54, 0x98, 0xa6, 0xc8, 0x1e, 0x6c, 0x2e, 0x2c, 0xd7, 0xf3, 0xb8, 0x40, 0xbf, 0x2b,
-	0xcc, 0x90, 0xe4, 0x5d, 0xa8, 0xc6, 0x21, 0xa0, 0xa3, 0x55, 0x96, 0x30, 0xa4, 0xdc, 0x15, 0x0f,
-	0x23, 0xd7, 0xf7, 0xd0, 0xbf, 0x32, 0x33, 0x24, 0xfd, 0x57, 0x09, 0xaa, 0xb1, 0x93, 0xe4, 0x11,
-	0x94, 0x5c, 0x07, 0x5d, 0xa9, 0xb5, 0xb7, 0x32, 0x21, 0x38, 0xac, 0xe4, 0x3a, 0xa4, 0x05, 0x95,
-	0x8b, 0x60, 0xb0, 0x5c, 0x5c, 0xf0, 0x10, 0x3d, 0x6b, 0xb0, 0x98, 0x26, 0x14, 0xea, 0x0b, 0xeb,
-	0x06, 0x57, 0x28, 0x72, 0x7f, 0xe0, 0xe8, 0xe0, 0x3a, 0xcb, 0xf0, 0xa4, 0x97, 0x0b, 0xeb, 0x46,
-	0xf8, 0x97, 0xdc, 0x8b, 0xf4, 0x74, 0x26, 0x0c, 0xf2, 0x01, 0x6c, 0x45, 0xc2, 0xba, 0x74, 0xbd,
-	0xe9, 0xc2, 0xf5, 0xdc, 0xc5, 0x72, 0x81, 0xce, 0xd6, 0xd9, 0x0a, 0x57, 0x5a, 0x12, 0xbe, 0xb0,
-	0xe6, 0x9a, 0xbd, 0xb7, 0x81, 0xa8, 0x0c, 0x4f, 0x7a, 0x3a, 0xb5, 0xa2, 0x20, 0x74, 0x6d, 0xbe,
-	0xb7, 0x89, 0xe3, 0x31, 0x2d, 0xbd, 0xf0, 0xac, 0x05, 0x57, 0x83, 0x15, 0xe5, 0x45, 0xcc, 0x20,
-	0x4f, 0xa0, 0x89, 0x9a, 0xae, 0x7c, 0xe1, 0x7a, 0xd3, 0xc0, 0xbf, 0xe6, 0xe1, 0x5e, 0x15, 0x41,
-	0x77, 0xf8, 0xd2, 0x13, 0x45, 0x86, 0xfc, 0xda, 0x0a, 0x9d, 0x3d, 0x50, 0x9e, 0xa4, 0x79, 0xf4,
-	0x31, 0x40, 0xd7, 0xa4, 0x72, 0x24, 0x57, 0x36, 0xe4, 0x81, 0x1f, 0x0a, 0xbd, 0xe0, 0x9a, 0xa2,
-	0x36, 0x94, 0xfb, 0x5e, 0xb0, 0x14, 0x84, 0xc0, 0x7a, 0x2a, 0xbf, 0xf1, 0x5b, 0x2e, 0x9f, 0xe5,
-	0x38, 0x21, 0x8f, 0xa2, 0xbd, 0xd2, 0xfe, 0xda, 0x41, 0x9d, 0x19, 0x52, 0xa6, 0xcf, 0x95, 0x35,
-	0x5f, 0xaa, 0xd9, 0xae, 0x33, 0x45, 0x48, 0x23, 0x91, 0x1d, 0xba, 0x81, 0xd0, 0x73, 0xac, 0x29,
-	0x3a, 0x81, 0x8d, 0xd3, 0xa5, 0x90, 0x56, 0x76, 0xa1, 0xec, 0x7a, 0x0e, 0xbf, 0x41, 0x33, 0x0d,
-	0xa6, 0x88, 0xac, 0x9d, 0xe2, 0xff, 0x6f, 0x67, 0x13, 0xca, 0xbd, 0x45, 0x20, 0x6e, 0xe9, 0x4f,
-	0xa0, 0x36, 0x74, 0xbd, 0xe9, 0x9c, 0x1f, 0xdd, 0x0a, 0x9e, 0xd2, 0x52, 0x4c, 0x69, 0xa1, 0x8f,
-	0xa1, 0xae, 0x40, 0x43, 0x11, 0xca, 0xa5, 0xcb, 0xa0, 0xaa, 0x06, 0xf5, 0x01, 0x6c, 0x75, 0x54,
-	0x65, 0xe9, 0xac, 0xfa, 0x94, 0xd1, 0xf6, 0xc7, 0x04, 0xe7, 0x39, 0xcc, 0xf7, 0x85, 0x8c, 0x4a,
-	0x73, 0x34, 0xd2, 0x90, 0x72, 0xae, 0x25, 0x42, 0x07, 0x8b, 0xdf, 0xe4, 0x11, 0x40, 0xd7, 0x5f,
-	0x04, 0xd2, 0x02, 0x77, 0xf4, 0x2e, 0x4b, 0x71, 0xe8, 0x3f, 0x4b, 0xb0, 0x7e, 0xc6, 0x79, 0x48,
-	0x3e, 0x4e, 0x26, 0x4b, 0x6d, 0x18, 0xa2, 0x37, 0x8c, 0x1c, 0xd5, 0x3e, 0x26, 0x13, 0xf8, 0x0c,
-	0xaa, 0xb2, 0x6e, 0xe0, 0x56, 0x40, 0x7b, 0xb5, 0xf6, 0x7d, 0x8d, 0x1f, 0xf0, 0x6b, 0xac, 0x60,
-	0x03, 0x5f, 0xb8, 0x36, 0x67, 0x09, 0x4e, 0x46, 0x18, 0x09, 0x4b, 0xa8, 0x59, 0x2f, 0x33, 0x45,
-	0xc8, 0x59, 0x9f, 0xb9, 0x8e, 0xc3, 0x3d, 0x9c, 0xf5, 0x0a, 0xd3, 0x94, 0x4c, 0xeb, 0xb9, 0x15,
-	0xcd, 0xba, 0x33, 0x6e, 0x5f, 0xe2, 0xce, 0x59, 0x63, 0x09, 0x43, 0x6e, 0x88, 0x88, 0xcf, 0x27,
-	0x01, 0xe7, 0x21, 0x6e, 0x98, 0x0a, 0x8b, 0xe9, 0x74, 0x79, 0xd8, 0xc4, 0x39, 0x37, 0x24, 0xf9,
-	0x35, 0xd4, 0x6d, 0x1e, 0x0a, 0x77, 0xe2, 0xda, 0x96, 0xe0, 0xd1, 0x5e, 0x65, 0x7f, 0xed, 0xa0,
-	0xd6, 0x7e, 0xa8, 0x3d, 0xef, 0x4c, 0xb9, 0x27, 0xba, 0xc9, 0x38, 0xcb, 0x80, 0xc9, 0x33, 0xa8,
-	0x5b, 0xb6, 0xcd, 0x03, 0xc1, 0x1d, 0xe6, 0xcf, 0x39, 0xee, 0xa2, 0xad, 0xf6, 0x76, 0x6a, 0x9a,
-	0x24, 0x9b, 0x65, 0x40, 0xf4, 0x13, 0xa8, 0xc8, 0x91, 0x13, 0x37, 0x12, 0xe4, 0xc7, 0x50, 0x96,
-	0xfe, 0xc9, 0x09, 0x96, 0x66, 0x6b, 0x69, 0x49, 0x35, 0x42, 0xaf, 0x00, 0x24, 0xf4, 0xcc, 0x0a,
-	0xad, 0x45, 0x94, 0xbb, 0x79, 0xe4, 0x74, 0xa5, 0x8f, 0x03, 0x4d, 0x49, 0x6c, 0x5c, 0xa7, 0x1a,
-	0x0c, 0xbf, 0x25, 0xd6, 0x9f, 0x4c, 0x22, 0xae, 0x12, 0xba, 0xc1, 0x34, 0x45, 0x9a, 0xb0, 0x66,
-	0x45, 0x36, 0x4e, 0x6a, 0x85, 0xc9, 0x4f, 0xfa, 0x25, 0xc0, 0x99, 0x35, 0xe5, 0xda, 0x6e, 0x22,
-	0x57, 0xcc, 0xc8, 0x19, 0x1b, 0xa5, 0xc4, 0x06, 0xbd, 0x81, 0x2d, 0x5c, 0xee, 0x23, 0xdf, 0xb9,
-	0x95, 0x2a, 0xf0, 0x0c, 0xc0, 0xca, 0x62, 0x36, 0x23, 0x12, 0x29, 0x9d, 0xa5, 0x5c, 0x9d, 0x69,
-	0xbf, 0x1f, 0xc3, 0xfa, 0x85, 0xef, 0xdc, 0xa2, 0xd7, 0xc9, 0xe1, 0x13, 0x9b, 0x61, 0x38, 0x4a,
-	0xff, 0x04, 0xdb, 0x29, 0xcb, 0xe8, 0x38, 0x85, 0xba, 0x9c, 0x24, 0x3f, 0xf4, 0x54, 0x51, 0x57,
-	0x13, 0x97, 0xe1, 0x91, 0x8f, 0x60, 0x23, 0xb0, 0xa6, 0xb2, 0xd0, 0xaa, 0xbc, 0xdd, 0x31, 0xcb,
-	0x10, 0xc7, 0xcf, 0x34, 0x80, 0xfe, 0x42, 0x5b, 0x38, 0xe6, 0x96, 0xa3, 0xd7, 0xf0, 0x31, 0x6c,
-	0xa8, 0xfa, 0xaf, 0x17, 0xb1, 0x9e, 0x76, 0x8e, 0xe9, 0x31, 0xfa, 0x67, 0x68, 0x20, 0xe3, 0x15,
-	0x17, 0x96, 0x63, 0x09, 0x2b, 0x77, 0x25, 0x9f, 0xc8, 0x95, 0x94, 0x8a, 0xb5, 0x23, 0x24, 0xad,
-	0x4a, 0x99, 0x64, 0x1a, 0x21, 0x53, 0x5a, 0xdc, 0xa8, 0x4d, 0xaf, 0x36, 0x8f, 0x21, 0xe3, 0xf9,
-	0x5b, 0xc7, 0x1d, 0xa2, 0xd6, 0xa4, 0x03, 0x3b, 0x19, 0xf3, 0xe8, 0xf9, 0xc7, 0x2b, 0x9e, 0xef,
-	0xa6, 0xcd, 0x19, 0x64, 0x1c, 0x01, 0x87, 0x7a, 0xd7, 0x5f, 0x2c, 0x5c, 0xc1, 0x78, 0xb4, 0x9c,
-	0xe7, 0xd7, 0xf1, 0x8f, 0xa0, 0xcc, 0xc3, 0xd0, 0x57, 0xfe, 0x6f, 0xb5, 0xef, 0x99, 0x13, 0x16,
-	0xe5, 0x54, 0xab, 0xc3, 0x14, 0x42, 0xae, 0xbe, 0xc3, 0x85, 0xe5, 0xce, 0x75, 0x83, 0xa2, 0x29,
-	0xda, 0x81, 0x66, 0xda, 0x0c, 0x3a, 0xfa, 0x09, 0x6c, 0x86, 0x48, 0x19, 0x4f, 0xb3, 0x8a, 0x15,
-	0x92, 0x19, 0x0c, 0x1d, 0x41, 0xfd, 0x35, 0x0f, 0xdd, 0xc9, 0xad, 0xf6, 0xf4, 0x1d, 0x28, 0x89,
-	0x1b, 0x5d, 0xc3, 0xaa, 0x5a, 0x72, 0x74, 0xc3, 0x4a, 0xe2, 0xe6, 0x4d, 0x0e, 0x2b, 0xf1, 0x8c,
-	0xc3, 0x74, 0x24, 0xf7, 0x6d, 0x18, 0xf9, 0x9e, 0x35, 0x97, 0x35, 0x34, 0xb0, 0xa2, 0x28, 0x98,
-	0x85, 0x56, 0x64, 0xca, 0x78, 0x8a, 0x43, 0x0e, 0x60, 0x53, 0x77, 0x89, 0x7a, 0x25, 0x4d, 0xaf,
-	0xa1, 0x0b, 0x33, 0x33, 0xc3, 0xf4, 0x6f, 0x45, 0xa8, 0xf7, 0x17, 0xf2, 0x84, 0x7c, 0xee, 0x87,
-	0x0b, 0x4b, 0xa6, 0xd3, 0xda, 0xb5, 0x3b, 0x59, 0xa9, 0xb8, 0xa9, 0x33, 0x86, 0xc9, 0x61, 0xb9,
-	0xfa, 0xfe, 0xdc, 0x91, 0x16, 0xd1, 0x40, 0x95, 0x19, 0x52, 0x8e, 0x78, 0xfc, 0x1a, 0x47, 0xd4,
-	0xc4, 0x1a, 0x92, 0x1c, 0x42, 0xe5, 0x92, 0xdf, 0x46, 0xc2, 0x0f, 0xb9, 0xde, 0x47, 0x79, 0xea,
-	0x63, 0x0c, 0xfd, 0x1c, 0x36, 0x87, 0xba, 0xd9, 0x78, 0x00, 0x1b, 0xd6, 0x22, 0x75, 0xc0, 0x68,
-	0x4a, 0xe6, 0xc0, 0xf5, 0x8c, 0x7b, 0xba, 0xf0, 0xe0, 0x37, 0xfd, 0x0d, 0xac, 0xbf, 0xf6, 0x05,
-	0x36, 0x21, 0xb6, 0xe5, 0x39, 0xae, 0x23, 0xeb, 0xbb, 0x12, 0x4b, 0x18, 0x29, 0x8d, 0xa5, 0xb4,
-	0x46, 0xda, 0x06, 0x90, 0xd2, 0x7a, 0xf7, 0x6e, 0xc5, 0xed, 0x5a, 0x15, 0xdb, 0xb3, 0x5d, 0x28,
-	0x27, 0xb3, 0xda, 0x60, 0x8a, 0xa0, 0x0e, 0x6c, 0xeb, 0x79, 0x95, 0xa2, 0xd8, 0xe7, 0x1d, 0xc0,
-	0xa6, 0x69, 0x9e, 0xb2, 0xcd, 0x9e, 0x8e, 0x88, 0x99, 0x61, 0xf2, 0x21, 0x6c, 0xa8, 0x6e, 0x06,
-	0x3b, 0x8f, 0x5a, 0x5c, 0xbd, 0x8d, 0x2a, 0xa6, 0x87, 0x29, 0x83, 0x4a, 0xac, 0x7e, 0xd5, 0xaf,
-	0x47, 0x00, 0x71, 0x68, 0xaa, 0x85, 0xa9, 0xb2, 0x14, 0x27, 0x15, 0xad, 0x4e, 0x76, 0x1d, 0xed,
-	0x6f, 0x95, 0x4e, 0x73, 0x16, 0x5c, 0xf9, 0x52, 0x3c, 0x7b, 0x16, 0xc8, 0x71, 0xa6, 0x46, 0xb4,
-	0xd9, 0x92, 0x31, 0x4b, 0x3b, 0xb0, 0x39, 0xf0, 0x1d, 0xce, 0xf8, 0xf7, 0x58, 0x0e, 0xdc, 0x05,
-	0xf7, 0x97, 0x71, 0x0f, 0xa0, 0x49, 0xd5, 0x38, 0x2f, 0x02, 0xdf, 0xe3, 0xf1, 0x64, 0x27, 0x0c,
-	0xfa, 0x19, 0xac, 0x0f, 0xac, 0x05, 0x97, 0x2b, 0x29, 0x3b, 0x44, 0x1d, 0x13, 0x7e, 0x4b, 0x9d,
-	0x17, 0xea, 0xdc, 0xd6, 0x0b, 0x6c, 0x48, 0x6a, 0x43, 0x45, 0x4a, 0xe1, 0x5c, 0xbc, 0x9f, 0x92,
-	0x4c, 0xdc, 0x96, 0xc3, 0x5a, 0xcd, 0x2e, 0x94, 0xfd, 0x6b, 0x4f, 0x17, 0xb5, 0x3a, 0x53, 0x04,
-	0xd9, 0x87, 0x9a, 0xc3, 0x23, 0xe1, 0x7a, 0x96, 0x90, 0xc7, 0xb2, 0x6a, 0xbb, 0xd2, 0x2c, 0xda,
-	0x83, 0x9a, 0x3c, 0x08, 0x23, 0x9d, 0x0b, 0x2d, 0xa8, 0x78, 0xfe, 0xb1, 0xea, 0x0b, 0x8a, 0xea,
-	0x7c, 0x37, 0x34, 0x9e, 0xfd, 0x33, 0xff, 0x7a, 0xc8, 0xe7, 0x13, 0x7d, 0xa1, 0x88, 0x69, 0xfa,
-	0x1e, 0x54, 0x5f, 0x72, 0x73, 0x1c, 0x34, 0x61, 0xed, 0x92, 0xdf, 0xe2, 0x14, 0x57, 0x99, 0xfc,
-	0xa4, 0x7f, 0x29, 0x01, 0x0c, 0x79, 0x78, 0xc5, 0x43, 0x8c, 0xe6, 0x73, 0xd8, 0x88, 0x70, 0xdb,
-	0xeb, 0x65, 0x78, 0xcf, 0xe4, 0x4d, 0x0c, 0x39, 0x54, 0x65, 0xa1, 0xe7, 0x89, 0xf0, 0x96, 0x69,
-	0xb0, 0x14, 0xb3, 0x7d, 0x6f, 0xe2, 0x9a, 0x2c, 0xca, 0x11, 0xeb, 0xe2, 0xb8, 0x16, 0x53, 0xe0,
-	0xd6, 0x2f, 0xa1, 0x96, 0xd2, 0x96, 0x78, 0x57, 0xd4, 0xde, 0x25, 0x2d, 0x60, 0x29, 0xd5, 0x2a,
-	0xfe, 0xaa, 0xf4, 0x65, 0xb1, 0x75, 0x02, 0xb5, 0x94, 0xc6, 0x1c, 0xd1, 0x0f, 0xd3, 0xa2, 0xc9,
-	0xa1, 0xa6, 0x84, 0xfa, 0x82, 0x2f, 0x52, 0xda, 0xe8, 0x0f, 0xb2, 0x29, 0x34, 0x03, 0xa4, 0x0d,
-	0xe5, 0x20, 0xf4, 0x83, 0x48, 0x07, 0xf3, 0xee, 0x1d, 0xd1, 0xc3, 0x33, 0x39, 0xac, 0x62, 0x51,
-	0xd0, 0x96, 0xec, 0x17, 0x62, 0xe6, 0xdb, 0x44, 0x42, 0x9f, 0x42, 0xb5, 0x77, 0xc5, 0x3d, 0x61,
-	0x4e, 0x53, 0x2e, 0x89, 0xd5, 0xd3, 0x14, 0x11, 0x4c, 0x8f, 0xd1, 0x3e, 0x34, 0xba, 0x99, 0xfb,
-	0x2c, 0x81, 0x75, 0x89, 0x33, 0xe9, 0x2b, 0xbf, 0x25, 0x0f, 0x2f, 0xac, 0xca, 0x20, 0x7e, 0x4b,
-	0xbf, 0x2e, 0x02, 0x59, 0x19, 0x71, 0xfd, 0x2f, 0x82, 0x88, 0x7e, 0x08, 0xf7, 0x7a, 0x9e, 0xe0,
-	0x61, 0x10, 0xba, 0x11, 0x57, 0x11, 0xbe, 0xe4, 0x39, 0x01, 0xd0, 0x13, 0x68, 0xae, 0x02, 0x73,
-	0xc2, 0xdc, 0x82, 0x92, 0xef, 0xe9, 0x1c, 0x2c, 0xf9, 0x9e, 0xdc, 0xf9, 0x18, 0xa9, 0xb1, 0xa9,
-	0xa9, 0x27, 0xff, 0x28, 0x9a, 0xe3, 0x54, 0xbf, 0x00, 0x54, 0xa1, 0x3c, 0x3a, 0x1f, 0x9f, 0xbe,
-	0x6c, 0x16, 0xc8, 0x2e, 0x34, 0x47, 0xe7, 0xe3, 0xc1, 0xe9, 0xa0, 0xdb, 0x1b, 0x8f, 0x4e, 0x4f,
-	0xc7, 0x27, 0xa7, 0x7f, 0x68, 0x16, 0xc9, 0x7d, 0xd8, 0x19, 0x9d, 0x8f, 0x3b, 0x27, 0xac, 0xd7,
-	0xf9, 0xe6, 0xbb, 0x71, 0xef, 0xbc, 0x3f, 0x1c, 0x0d, 0x9b, 0x25, 0x72, 0x0f, 0xb6, 0x47, 0xe7,
-	0xe3, 0xfe, 0xe0, 0x75, 0xe7, 0xa4, 0xff, 0xcd, 0xf8, 0xb8, 0x33, 0x3c, 0x6e, 0xae, 0xad, 0x30,
-	0x87, 0xfd, 0x17, 0x83, 0xe6, 0xba, 0x56, 0x60, 0x98, 0xcf, 0x4f, 0xd9, 0xab, 0xce, 0xa8, 0x59,
-	0x26, 0x3f, 0x82, 0x87, 0xc8, 0x1e, 0x7e, 0xfb, 0xfc, 0x79, 0xbf, 0xdb, 0xef, 0x0d, 0x46, 0xe3,
-	0xa3, 0xce, 0x49, 0x67, 0xd0, 0xed, 0x35, 0x37, 0xb4, 0xcc, 0x71, 0x67, 0x38, 0x1e, 0x76, 0x5e,
-	0xf5, 0x94, 0x4f, 0xcd, 0xcd, 0x58, 0xd5, 0xa8, 0xc7, 0x06, 0x9d, 0x93, 0x71, 0x8f, 0xb1, 0x53,
-	0xd6, 0xac, 0x3e, 0x99, 0x98, 0x83, 0x57, 0xc7, 0xb4, 0x0b, 0xcd, 0xd7, 0x3d, 0xd6, 0x7f, 0xfe,
-	0xdd, 0x78, 0x38, 0xea, 0x8c, 0xbe, 0x1d, 0xaa, 0xf0, 0xf6, 0xe1, 0xdd, 0x2c, 0x57, 0xfa, 0x37,
-	0x1e, 0x9c, 0x8e, 0xc6, 0xaf, 0x3a, 0xa3, 0xee, 0x71, 0xb3, 0x48, 0x1e, 0x41, 0x2b, 0x8b, 0xc8,
-	0x84, 0x57, 0x6a, 0xff, 0x9d, 0xc0, 0x76, 0x87, 0x87, 0x53, 0x9f, 0x9d, 0x75, 0xe5, 0x0e, 0x93,
-	0xb7, 0xda, 0xa7, 0x50, 0x95, 0xb5, 0x70, 0x88, 0x37, 0x08, 0x53, 0xed, 0x75, 0x75, 0x6c, 0xe5,
-	0x1c, 0x74, 0xb4, 0x40, 0x9e, 0xc2, 0xc6, 0x2b, 0x7c, 0xa5, 0x21, 0xe6, 0xa6, 0xa2, 0xc8, 0x88,
-	0xf1, 0xef, 0x97, 0x3c, 0x12, 0xad, 0xad, 0x2c, 0x9b, 0x16, 0xc8, 0xe7, 0x00, 0xc9, 0xdb, 0x0d,
-	0x89, 0x93, 0x53, 0xde, 0x05, 0x5b, 0x0f, 0xd3, 0xed, 0x53, 0xea, 0x71, 0x87, 0x16, 0xc8, 0xa7,
-	0x50, 0x7f, 0xc1, 0x45, 0xf2, 0x0c, 0x91, 0x15, 0xbc, 0xf3, 0x96, 0x42, 0x0b, 0xe4, 0x50, 0xbf,
-	0x5a, 0x48, 0x15, 0x2b, 0xf0, 0x9d, 0x34, 0x1c, 0x2f, 0xdd, 0xb4, 0x40, 0xbe, 0x86, 0xa6, 0xdc,
-	0x3f, 0xa9, 0x4e, 0x31, 0x22, 0x06, 0x98, 0xdc, 0x1f, 0x5a, 0x0f, 0xee, 0x76, 0x94, 0x72, 0x94,
-	0x16, 0xc8, 0x11, 0xec, 0xc4, 0x0a, 0xe2, 0x26, 0x35, 0x47, 0xc3, 0x5e, 0x5e, 0x93, 0xa8, 0x75,
-	0x3c, 0x85, 0xed, 0x58, 0xc7, 0x50, 0x84, 0xdc, 0x5a, 0xac, 0xb8, 0x9e, 0xe9, 0x8d, 0x69, 0xe1,
-	0xd3, 0x22, 0xe9, 0xc0, 0xc3, 0x3b, 0x66, 0x73, 0x45, 0x73, 0x9b, 0x53, 0x54, 0x71, 0x08, 0x95,
-	0x17, 0x5c, 0x69, 0x20, 0x39, 0x0b, 0xbd, 0x6a, 0x94, 0x7c, 0x05, 0x4d, 0x83, 0x4f, 0xba, 0xf1,
-	0x1c, 0xb9, 0x37, 0x58, 0x24, 0x5f, 0xe3, 0x62, 0xc6, 0x17, 0x0d, 0xf2, 0x60, 0xf5, 0x36, 0xa2,
-	0x67, 0xea, 0xfe, 0x5d, 0xfe, 0x94, 0x3b, 0xb4, 0x40, 0x0e, 0xa0, 0xfc, 0x82, 0x8b, 0xd1, 0x79,
-	0xae, 0xd5, 0xa4, 0x41, 0xa5, 0x05, 0xf2, 0x19, 0x80, 0x31, 0xf5, 0x06, 0x78, 0x33, 0x86, 0xf7,
-	0x3d, 0x13, 0x60, 0x1b, 0xa5, 0x18, 0xb7, 0xb9, 0x1b, 0x88, 0x5c, 0x29, 0x93, 0xd8, 0x1a, 0x43,
-	0x0b, 0xf2, 0xea, 0xf1, 0x82, 0x8b, 0xce, 0x51, 0x3f, 0x17, 0x0f, 0xa6, 0x7d, 0x3d, 0xea, 0x2b,
-	0xec, 0x90, 0x7b, 0xce, 0xe8, 0x9c, 0x24, 0xce, 0xb6, 0xf2, 0x5a, 0x72, 0x2a, 0x37, 0xfb, 0xc6,
-	0xd0, 0x9d, 0x7a, 0x59, 0x6c, 0x26, 0xc6, 0x8f, 0xa1, 0xa2, 0x8a, 0x46, 0xbe, 0xbe, 0x74, 0x27,
-	0x8f, 0x33, 0x52, 0x51, 0x16, 0x46, 0xe7, 0xa4, 0x11, 0xa3, 0x65, 0x0a, 0xc5, 0xfb, 0x6f, 0xf5,
-	0xfa, 0x80, 0xbb, 0x49, 0xa6, 0x88, 0xaa, 0x0d, 0xff, 0x2d, 0x45, 0x10, 0x41, 0x0b, 0xe4, 0x77,
-	0x98, 0x22, 0x48, 0x75, 0x3c, 0xe7, 0x2c, 0xf4, 0xfd, 0x49, 0x5c, 0x23, 0xb2, 0x8f, 0x2f, 0xb1,
-	0x9f, 0x9a, 0x8d, 0x58, 0x5c, 0x83, 0x46, 0x37, 0xe4, 0x52, 0x5e, 0x3f, 0xc5, 0x24, 0xaf, 0x02,
-	0xea, 0x0e, 0xd1, 0x5a, 0xb9, 0x12, 0xe0, 0xf6, 0xa9, 0xc9, 0x35, 0x50, 0x74, 0xb4, 0x92, 0xff,
-	0x24, 0x0b, 0xd7, 0x81, 0x7d, 0x0a, 0xb5, 0x13, 0xdf, 0xbe, 0x7c, 0x0b, 0x23, 0x6d, 0x68, 0x7c,
-	0xeb, 0xcd, 0xdf, 0x4e, 0xe6, 0x0b, 0x68, 0xa8, 0x3b, 0x8a, 0x91, 0x31, 0x41, 0xa7, 0x6f, 0x2e,
-	0xf9, 0x72, 0xbd, 0x9b, 0xb4, 0xdc, 0x1d, 0x5b, 0xf9, 0x85, 0xf9, 0x2b, 0xb8, 0x9f, 0x91, 0x7b,
-	0xa9, 0xaf, 0x24, 0xff, 0xab, 0xfc, 0x33, 0x68, 0xfc, 0x7e, 0xc9, 0xc3, 0xdb, 0xae, 0xef, 0x89,
-	0xd0, 0xb2, 0x93, 0x02, 0x8a, 0xdc, 0x37, 0x08, 0x75, 0x80, 0x64, 0x84, 0x54, 0xb6, 0xec, 0xa4,
-	0x33, 0x43, 0x89, 0x3f, 0xb8, 0xc3, 0x32, 0x8b, 0xfe, 0x14, 0xd3, 0x0c, 0x9b, 0x56, 0x92, 0x7e,
-	0x2c, 0xd3, 0x2d, 0x6c, 0x2b, 0xfd, 0x32, 0x14, 0x2f, 0xa0, 0x14, 0x79, 0x8d, 0xed, 0xfd, 0x4e,
-	0xaa, 0xe5, 0x5f, 0x91, 0x30, 0xb7, 0x04, 0x2c, 0xd4, 0xdb, 0x49, 0x96, 0x28, 0xc1, 0xd5, 0xd4,
-	0x54, 0x4f, 0x72, 0xb1, 0xa3, 0x2b, 0x97, 0x23, 0x75, 0x8c, 0xa9, 0xfc, 0xc6, 0x2b, 0xd0, 0x1b,
-	0xc4, 0x57, 0xae, 0x4c, 0xb4, 0x40, 0x3e, 0xc1, 0x04, 0x8d, 0x3b, 0xff, 0x74, 0xaf, 0x1f, 0x7b,
-	0x6a, 0x46, 0x71, 0xf9, 0xf1, 0x38, 0xc0, 0xd6, 0x4d, 0xd7, 0x74, 0x13, 0xe2, 0x73, 0x77, 0x2e,
-	0x54, 0x5f, 0xdc, 0xca, 0x74, 0x78, 0x58, 0xd0, 0x9f, 0xa9, 0x27, 0x2f, 0x64, 0x44, 0x79, 0x22,
-	0xcd, 0xb4, 0x88, 0x9e, 0x96, 0x2f, 0xa0, 0x21, 0x43, 0x4a, 0x3a, 0x79, 0x03, 0x8a, 0x9b, 0xff,
-	0xf8, 0xe0, 0x4c, 0x40, 0xb4, 0x40, 0xbe, 0xc4, 0xad, 0x9e, 0xed, 0x26, 0xf3, 0x4f, 0x9e, 0x0c,
-	0x86, 0x16, 0xc8, 0x09, 0xdc, 0x7b, 0xc1, 0xc5, 0x9d, 0x9e, 0xb0, 0x65, 0x84, 0xef, 0x76, 0x95,
-	0x71, 0x89, 0x5a, 0x1d, 0xa3, 0x05, 0x72, 0x0c, 0xf7, 0x95, 0x1f, 0x93, 0xee, 0xcc, 0xf2, 0xa6,
-	0xfc, 0x2c, 0xf4, 0xa7, 0xf8, 0xb0, 0x9a, 0x57, 0xaf, 0xde, 0x49, 0x75, 0xe4, 0x59, 0x38, 0x2d,
-	0x5c, 0x6c, 0xe0, 0x7f, 0xa6, 0x67, 0xff, 0x09, 0x00, 0x00, 0xff, 0xff, 0xc7, 0x7d, 0x4d, 0x37,
-	0xcd, 0x1a, 0x00, 0x00,
+	// 2621 bytes of a gzipped FileDescriptorProto
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x9c, 0x39, 0x5b, 0x77, 0x1b, 0xb7,
+	0xd1, 0x24, 0x25, 0x4a, 0xe4, 0x90, 0x94, 0x28, 0x58, 0xb6, 0x15, 0x7e, 0x89, 0xa3, 0x0f, 0x75,
+	0x13, 0xc5, 0x4d, 0xd4, 0x98, 0x4e, 0xd2, 0xf4, 0x96, 0x94, 0x62, 0x68, 0x8b, 0xc7, 0x32, 0xa5,
+	0x82, 0x8c, 0xab, 0xbc, 0x94, 0x5d, 0xed, 0x82, 0xe4, 0x1e, 0x91, 0xbb, 0x9b, 0x5d, 0x50, 0x97,
+	0x9c, 0xd3, 0xa7, 0x3e, 0xf5, 0x1f, 0xf4, 0x77, 0xf5, 0xb5, 0xa7, 0xa7, 0xfd, 0x29, 0x3d, 0x18,
+	0x00, 0x7b, 0xa1, 0xd6, 0x3d, 0x71, 0xdf, 0x76, 0x06, 0x73, 0xc7, 0x60, 0x30, 0x83, 0x85, 0x6a,
+	0x18, 0xd8, 0x87, 0x41, 0xe8, 0x0b, 0x9f, 0x94, 0xc5, 0x6d, 0xc0, 0xa3, 0x56, 0xf3, 0x62, 0xee,
+	0xdb, 0x97, 0xf6, 0xcc, 0x72, 0x3d, 0xb5, 0xd0, 0x6a, 0x58, 0xb6, 0xed, 0x2f, 0x3d, 0xa1, 0x41,
+	0xf0, 0x7c, 0x87, 0xeb, 0xef, 0x6a, 0xd0, 0x0e, 0xf4, 0x67, 0x7d, 0xc1, 0x45, 0xe8, 0xda, 0x86,
+	0x28, 0xb4, 0x26, 0x9a, 0x81, 0xfe, 0xbb, 0x08, 0xcd, 0xa3, 0x58, 0xe8, 0x50, 0x58, 0x62, 0x19,
+	0x91, 0x0f, 0x60, 0xfb, 0x82, 0x47, 0x62, 0x8c, 0xda, 0xc6, 0x33, 0x2b, 0x9a, 0xed, 0x15, 0xf7,
+	0x8b, 0x07, 0x75, 0xd6, 0x90, 0x68, 0x24, 0x3f, 0xb6, 0xa2, 0x19, 0x79, 0x1f, 0x6a, 0x48, 0x37,
+	0xe3, 0xee, 0x74, 0x26, 0xf6, 0x4a, 0xfb, 0xc5, 0x83, 0x75, 0x06, 0x12, 0x75, 0x8c, 0x18, 0xf2,
+	0x53, 0xd8, 0xb2, 0x7d, 0x2f, 0xe2, 0x5e, 0xb4, 0x8c, 0xc6, 0xae, 0x37, 0xf1, 0xf7, 0xd6, 0xf6,
+	0x8b, 0x07, 0x55, 0xd6, 0x88, 0xb1, 0x7d, 0x6f, 0xe2, 0x93, 0x9f, 0x01, 0x41, 0x39, 0x68, 0xc3,
+	0xd8, 0x75, 0x94, 0xca, 0x75, 0x54, 0x89, 0x96, 0x74, 0xe5, 0x42, 0xdf, 0x41, 0xa5, 0x3f, 0x07,
+	0xd0, 0x74, 0x52, 0x5e, 0x79, 0xbf, 0x78, 0x50, 0x6b, 0x37, 0x0f, 0x31, 0x3e, 0x87, 0x8a, 0xce,
+	0x9b, 0xf8, 0xac, 0x6a, 0x9b, 0x4f, 0xfa, 0xd7, 0x22, 0x6c, 0x6a, 0x01, 0x64, 0x17, 0xca, 0x0b,
+	0x6b, 0xea, 0xda, 0xe8, 0x4f, 0x95, 0x29, 0x80, 0x3c, 0x80, 0x8d, 0x60, 0x79, 0x31, 0x77, 0x6d,
+	0x74, 0xa1, 0xc2, 0x34, 0x44, 0xf6, 0x60, 0x73, 0x61, 0xb9, 0x9e, 0xc7, 0x05, 0xda, 0x5d, 0x61,
+	0x06, 0x24, 0xef, 0x42, 0x35, 0x76, 0x01, 0x0d, 0xad, 0xb2, 0x04, 0x21, 0xf9, 0xae, 0x78, 0x18,
+	0xb9, 0xbe, 0x87, 0xf6, 0x95, 0x99, 0x01, 0xe9, 0xbf, 0x4a, 0x50, 0x8d, 0x8d, 0x24, 0x8f, 0xa0,
+	0xe4, 0x3a, 0x68, 0x4a, 0xad, 0xbd, 0x95, 0x71, 0xc1, 0x61, 0x25, 0xd7, 0x21, 0x2d, 0xa8, 0x5c,
+	0x04, 0x83, 0xe5, 0xe2, 0x82, 0x87, 0x68, 0x59, 0x83, 0xc5, 0x30, 0xa1, 0x50, 0x5f, 0x58, 0x37,
+	0xb8, 0x43, 0x91, 0xfb, 0x03, 0x47, 0x03, 0xd7, 0x59, 0x06, 0x27, 0xad, 0x5c, 0x58, 0x37, 0xc2,
+	0xbf, 0xe4, 0x5e, 0xa4, 0xc3, 0x99, 0x20, 0xc8, 0x07, 0xb0, 0x15, 0x09, 0xeb, 0xd2, 0xf5, 0xa6,
+	0x0b, 0xd7, 0x73, 0x17, 0xcb, 0x05, 0x1a, 0x5b, 0x67, 0x2b, 0x58, 0xa9, 0x49, 0xf8, 0xc2, 0x9a,
+	0x6b, 0xf4, 0xde, 0x06, 0x52, 0x65, 0x70, 0xd2, 0xd2, 0xa9, 0x15, 0x05, 0xa1, 0x6b, 0xf3, 0xbd,
+	0x4d, 0x5c, 0x8f, 0x61, 0x69, 0x85, 0x67, 0x2d, 0xb8, 0x5a, 0xac, 0x28, 0x2b, 0x62, 0x04, 0x79,
+	0x02, 0x4d, 0x94, 0x74, 0xe5, 0x0b, 0xd7, 0x9b, 0x06, 0xfe, 0x35, 0x0f, 0xf7, 0xaa, 0x48, 0x74,
+	0x07, 0x2f, 0x2d, 0x51, 0x60, 0xc8, 0xaf, 0xad, 0xd0, 0xd9, 0x03, 0x65, 0x49, 0x1a, 0x47, 0x1f,
+	0x03, 0x74, 0x4d, 0x2a, 0x47, 0x72, 0x67, 0x43, 0x1e, 0xf8, 0xa1, 0xd0, 0x1b, 0xae, 0x21, 0x6a,
+	0x43, 0xb9, 0xef, 0x05, 0x4b, 0x41, 0x08, 0xac, 0xa7, 0xf2, 0x1b, 0xbf, 0xe5, 0xf6, 0x59, 0x8e,
+	0x13, 0xf2, 0x28, 0xda, 0x2b, 0xed, 0xaf, 0x1d, 0xd4, 0x99, 0x01, 0x65, 0xfa, 0x5c, 0x59, 0xf3,
+	0xa5, 0x8a, 0x76, 0x9d, 0x29, 0x40, 0x2a, 0x89, 0xec, 0xd0, 0x0d, 0x84, 0x8e, 0xb1, 0x86, 0xe8,
+	0x04, 0x36, 0x4e, 0x97, 0x42, 0x6a, 0xd9, 0x85, 0xb2, 0xeb, 0x39, 0xfc, 0x06, 0xd5, 0x34, 0x98,
+	0x02, 0xb2, 0x7a, 0x8a, 0xff, 0xbb, 0x9e, 0x4d, 0x28, 0xf7, 0x16, 0x81, 0xb8, 0xa5, 0x3f, 0x81,
+	0xda, 0xd0, 0xf5, 0xa6, 0x73, 0x7e, 0x74, 0x2b, 0x78, 0x4a, 0x4a, 0x31, 0x25, 0x85, 0x3e, 0x86,
+	0xba, 0x22, 0x1a, 0x8a, 0x50, 0x6e, 0x5d, 0x86, 0xaa, 0x6a, 0xa8, 0x3e, 0x80, 0xad, 0x8e, 0xaa,
+	0x2c, 0x9d, 0x55, 0x9b, 0x32, 0xd2, 0xfe, 0x98, 0xd0, 0x79, 0x0e, 0xf3, 0x7d, 0x21, 0xbd, 0xd2,
+	0x18, 0x4d, 0x69, 0x40, 0x19, 0x6b, 0x49, 0xa1, 0x9d, 0xc5, 0x6f, 0xf2, 0x08, 0xa0, 0xeb, 0x2f,
+	0x02, 0xa9, 0x81, 0x3b, 0xfa, 0x94, 0xa5, 0x30, 0xf4, 0x9f, 0x25, 0x58, 0x3f, 0xe3, 0x3c, 0x24,
+	0x1f, 0x27, 0xc1, 0x52, 0x07, 0x86, 0xe8, 0x03, 0x23, 0x57, 0xb5, 0x8d, 0x49, 0x00, 0x9f, 0x41,
+	0x55, 0xd6, 0x0d, 0x3c, 0x0a, 0xa8, 0xaf, 0xd6, 0xbe, 0xaf, 0xe9, 0x07, 0xfc, 0x1a, 0x2b, 0xd8,
+	0xc0, 0x17, 0xae, 0xcd, 0x59, 0x42, 0x27, 0x3d, 0x8c, 0x84, 0x25, 0x54, 0xd4, 0xcb, 0x4c, 0x01,
+	0x32, 0xea, 0x33, 0xd7, 0x71, 0xb8, 0x87, 0x51, 0xaf, 0x30, 0x0d, 0xc9, 0xb4, 0x9e, 0x5b, 0xd1,
+	0xac, 0x3b, 0xe3, 0xf6, 0x25, 0x9e, 0x9c, 0x35, 0x96, 0x20, 0xe4, 0x81, 0x88, 0xf8, 0x7c, 0x12,
+	0x70, 0x1e, 0xe2, 0x81, 0xa9, 0xb0, 0x18, 0x4e, 0x97, 0x87, 0x4d, 0x8c, 0xb9, 0x01, 0xc9, 0xaf,
+	0xa1, 0x6e, 0xf3, 0x50, 0xb8, 0x13, 0xd7, 0xb6, 0x04, 0x8f, 0xf6, 0x2a, 0xfb, 0x6b, 0x07, 0xb5,
+	0xf6, 0x43, 0x6d, 0x79, 0x67, 0xca, 0x3d, 0xd1, 0x4d, 0xd6, 0x59, 0x86, 0x98, 0x3c, 0x83, 0xba,
+	0x65, 0xdb, 0x3c, 0x10, 0xdc, 0x61, 0xfe, 0x9c, 0xe3, 0x29, 0xda, 0x6a, 0x6f, 0xa7, 0xc2, 0x24,
+	0xd1, 0x2c, 0x43, 0x44, 0x3f, 0x81, 0x8a, 0x5c, 0x39, 0x71, 0x23, 0x41, 0xfe, 0x1f, 0xca, 0xd2,
+	0x3e, 0x19, 0x60, 0xa9, 0xb6, 0x96, 0xe6, 0x54, 0x2b, 0xf4, 0x0a, 0x40, 0x92, 0x9e, 0x59, 0xa1,
+	0xb5, 0x88, 0x72, 0x0f, 0x8f, 0x0c, 0x57, 0xfa, 0x3a, 0xd0, 0x90, 0xa4, 0x8d, 0xeb, 0x54, 0x83,
+	0xe1, 0xb7, 0xa4, 0xf5, 0x27, 0x93, 0x88, 0xab, 0x84, 0x6e, 0x30, 0x0d, 0x91, 0x26, 0xac, 0x59,
+	0x91, 0x8d, 0x41, 0xad, 0x30, 0xf9, 0x49, 0xbf, 0x04, 0x38, 0xb3, 0xa6, 0x5c, 0xeb, 0x4d, 0xf8,
+	0x8a, 0x19, 0x3e, 0xa3, 0xa3, 0x94, 0xe8, 0xa0, 0x37, 0xb0, 0x85, 0xdb, 0x7d, 0xe4, 0x3b, 0xb7,
+	0x52, 0x04, 0xde, 0x01, 0x58, 0x59, 0xcc, 0x61, 0x44, 0x20, 0x25, 0xb3, 0x94, 0x2b, 0x33, 0x6d,
+	0xf7, 0x63, 0x58, 0xbf, 0xf0, 0x9d, 0x5b, 0xb4, 0x3a, 0xb9, 0x7c, 0x62, 0x35, 0x0c, 0x57, 0xe9,
+	0x9f, 0x60, 0x3b, 0xa5, 0x19, 0x0d, 0xa7, 0x50, 0x97, 0x41, 0xf2, 0x43, 0x4f, 0x15, 0x75, 0x15,
+	0xb8, 0x0c, 0x8e, 0x7c, 0x04, 0x1b, 0x81, 0x35, 0x95, 0x85, 0x56, 0xe5, 0xed, 0x8e, 0xd9, 0x86,
+	0xd8, 0x7f, 0xa6, 0x09, 0xe8, 0x2f, 0xb4, 0x86, 0x63, 0x6e, 0x39, 0x7a, 0x0f, 0x1f, 0xc3, 0x86,
+	0xaa, 0xff, 0x7a, 0x13, 0xeb, 0x69, 0xe3, 0x98, 0x5e, 0xa3, 0x7f, 0x86, 0x06, 0x22, 0x5e, 0x71,
+	0x61, 0x39, 0x96, 0xb0, 0x72, 0x77, 0xf2, 0x89, 0xdc, 0x49, 0x29, 0x58, 0x1b, 0x42, 0xd2, 0xa2,
+	0x94, 0x4a, 0xa6, 0x29, 0x64, 0x4a, 0x8b, 0x1b, 0x75, 0xe8, 0xd5, 0xe1, 0x31, 0x60, 0x1c, 0xbf,
+	0x75, 0x3c, 0x21, 0x6a, 0x4f, 0x3a, 0xb0, 0x93, 0x51, 0x8f, 0x96, 0x7f, 0xbc, 0x62, 0xf9, 0x6e,
+	0x5a, 0x9d, 0xa1, 0x8c, 0x3d, 0xe0, 0x50, 0xef, 0xfa, 0x8b, 0x85, 0x2b, 0x18, 0x8f, 0x96, 0xf3,
+	0xfc, 0x3a, 0xfe, 0x11, 0x94, 0x79, 0x18, 0xfa, 0xca, 0xfe, 0xad, 0xf6, 0x3d, 0x73, 0xc3, 0x22,
+	0x9f, 0x6a, 0x75, 0x98, 0xa2, 0x90, 0xbb, 0xef, 0x70, 0x61, 0xb9, 0x73, 0xdd, 0xa0, 0x68, 0x88,
+	0x76, 0xa0, 0x99, 0x56, 0x83, 0x86, 0x7e, 0x02, 0x9b, 0x21, 0x42, 0xc6, 0xd2, 0xac, 0x60, 0x45,
+	0xc9, 0x0c, 0x0d, 0x1d, 0x41, 0xfd, 0x35, 0x0f, 0xdd, 0xc9, 0xad, 0xb6, 0xf4, 0x1d, 0x28, 0x89,
+	0x1b, 0x5d, 0xc3, 0xaa, 0x9a, 0x73, 0x74, 0xc3, 0x4a, 0xe2, 0xe6, 0x4d, 0x06, 0x2b, 0xf6, 0x8c,
+	0xc1, 0x74, 0x24, 0xcf, 0x6d, 0x18, 0xf9, 0x9e, 0x35, 0x97, 0x35, 0x34, 0xb0, 0xa2, 0x28, 0x98,
+	0x85, 0x56, 0x64, 0xca, 0x78, 0x0a, 0x43, 0x0e, 0x60, 0x53, 0x77, 0x89, 0x7a, 0x27, 0x4d, 0xaf,
+	0xa1, 0x0b, 0x33, 0x33, 0xcb, 0xf4, 0x6f, 0x45, 0xa8, 0xf7, 0x17, 0xf2, 0x86, 0x7c, 0xee, 0x87,
+	0x0b, 0x4b, 0xa6, 0xd3, 0xda, 0xb5, 0x3b, 0x59, 0xa9, 0xb8, 0xa9, 0x3b, 0x86, 0xc9, 0x65, 0xb9,
+	0xfb, 0xfe, 0xdc, 0x91, 0x1a, 0x51, 0x41, 0x95, 0x19, 0x50, 0xae, 0x78, 0xfc, 0x1a, 0x57, 0x54,
+	0x60, 0x0d, 0x48, 0x0e, 0xa1, 0x72, 0xc9, 0x6f, 0x23, 0xe1, 0x87, 0x5c, 0x9f, 0xa3, 0x3c, 0xf1,
+	0x31, 0x0d, 0xfd, 0x1c, 0x36, 0x87, 0xba, 0xd9, 0x78, 0x00, 0x1b, 0xd6, 0x22, 0x75, 0xc1, 0x68,
+	0x48, 0xe6, 0xc0, 0xf5, 0x8c, 0x7b, 0xba, 0xf0, 0xe0, 0x37, 0xfd, 0x0d, 0xac, 0xbf, 0xf6, 0x05,
+	0x36, 0x21, 0xb6, 0xe5, 0x39, 0xae, 0x23, 0xeb, 0xbb, 0x62, 0x4b, 0x10, 0x29, 0x89, 0xa5, 0xb4,
+	0x44, 0xda, 0x06, 0x90, 0xdc, 0xfa, 0xf4, 0x6e, 0xc5, 0xed, 0x5a, 0x15, 0xdb, 0xb3, 0x5d, 0x28,
+	0x27, 0x51, 0x6d, 0x30, 0x05, 0x50, 0x07, 0xb6, 0x75, 0x5c, 0x25, 0x2b, 0xf6, 0x79, 0x07, 0xb0,
+	0x69, 0x9a, 0xa7, 0x6c, 0xb3, 0xa7, 0x3d, 0x62, 0x66, 0x99, 0x7c, 0x08, 0x1b, 0xaa, 0x9b, 0xc1,
+	0xce, 0xa3, 0x16, 0x57, 0x6f, 0x23, 0x8a, 0xe9, 0x65, 0xca, 0xa0, 0x12, 0x8b, 0x5f, 0xb5, 0xeb,
+	0x11, 0x40, 0xec, 0x9a, 0x6a, 0x61, 0xaa, 0x2c, 0x85, 0x49, 0x79, 0xab, 0x93, 0x5d, 0x7b, 0xfb,
+	0x5b, 0x25, 0xd3, 0xdc, 0x05, 0x57, 0xbe, 0x64, 0xcf, 0xde, 0x05, 0x72, 0x9d, 0xa9, 0x15, 0xad,
+	0xb6, 0x64, 0xd4, 0xd2, 0x0e, 0x6c, 0x0e, 0x7c, 0x87, 0x33, 0xfe, 0x3d, 0x96, 0x03, 0x77, 0xc1,
+	0xfd, 0x65, 0xdc, 0x03, 0x68, 0x50, 0x35, 0xce, 0x8b, 0xc0, 0xf7, 0x78, 0x1c, 0xec, 0x04, 0x41,
+	0x3f, 0x83, 0xf5, 0x81, 0xb5, 0xe0, 0x72, 0x27, 0x65, 0x87, 0xa8, 0x7d, 0xc2, 0x6f, 0x29, 0xf3,
+	0x42, 0xdd, 0xdb, 0x7a, 0x83, 0x0d, 0x48, 0x6d, 0xa8, 0x48, 0x2e, 0x8c, 0xc5, 0xfb, 0x29, 0xce,
+	0xc4, 0x6c, 0xb9, 0xac, 0xc5, 0xec, 0x42, 0xd9, 0xbf, 0xf6, 0x74, 0x51, 0xab, 0x33, 0x05, 0x90,
+	0x7d, 0xa8, 0x39, 0x3c, 0x12, 0xae, 0x67, 0x09, 0x79, 0x2d, 0xab, 0xb6, 0x2b, 0x8d, 0xa2, 0x3d,
+	0xa8, 0xc9, 0x8b, 0x30, 0xd2, 0xb9, 0xd0, 0x82, 0x8a, 0xe7, 0x1f, 0xab, 0xbe, 0xa0, 0xa8, 0xee,
+	0x77, 0x03, 0xe3, 0xdd, 0x3f, 0xf3, 0xaf, 0x87, 0x7c, 0x3e, 0xd1, 0x03, 0x45, 0x0c, 0xd3, 0xf7,
+	0xa0, 0xfa, 0x92, 0x9b, 0xeb, 0xa0, 0x09, 0x6b, 0x97, 0xfc, 0x16, 0x43, 0x5c, 0x65, 0xf2, 0x93,
+	0xfe, 0xa5, 0x04, 0x30, 0xe4, 0xe1, 0x15, 0x0f, 0xd1, 0x9b, 0xcf, 0x61, 0x23, 0xc2, 0x63, 0xaf,
+	0xb7, 0xe1, 0x3d, 0x93, 0x37, 0x31, 0xc9, 0xa1, 0x2a, 0x0b, 0x3d, 0x4f, 0x84, 0xb7, 0x4c, 0x13,
+	0x4b, 0x36, 0xdb, 0xf7, 0x26, 0xae, 0xc9, 0xa2, 0x1c, 0xb6, 0x2e, 0xae, 0x6b, 0x36, 0x45, 0xdc,
+	0xfa, 0x25, 0xd4, 0x52, 0xd2, 0x12, 0xeb, 0x8a, 0xda, 0xba, 0xa4, 0x05, 0x2c, 0xa5, 0x5a, 0xc5,
+	0x5f, 0x95, 0xbe, 0x2c, 0xb6, 0x4e, 0xa0, 0x96, 0x92, 0x98, 0xc3, 0xfa, 0x61, 0x9a, 0x35, 0xb9,
+	0xd4, 0x14, 0x53, 0x5f, 0xf0, 0x45, 0x4a, 0x1a, 0xfd, 0x41, 0x36, 0x85, 0x66, 0x81, 0xb4, 0xa1,
+	0x1c, 0x84, 0x7e, 0x10, 0x69, 0x67, 0xde, 0xbd, 0xc3, 0x7a, 0x78, 0x26, 0x97, 0x95, 0x2f, 0x8a,
+	0xb4, 0x25, 0xfb, 0x85, 0x18, 0xf9, 0x36, 0x9e, 0xd0, 0xa7, 0x50, 0xed, 0x5d, 0x71, 0x4f, 0x98,
+	0xdb, 0x94, 0x4b, 0x60, 0xf5, 0x36, 0x45, 0x0a, 0xa6, 0xd7, 0x68, 0x1f, 0x1a, 0xdd, 0xcc, 0x3c,
+	0x4b, 0x60, 0x5d, 0xd2, 0x99, 0xf4, 0x95, 0xdf, 0x12, 0x87, 0x03, 0xab, 0x52, 0x88, 0xdf, 0xd2,
+	0xae, 0x8b, 0x40, 0x56, 0x46, 0xdc, 0xff, 0x8b, 0x20, 0xa2, 0x1f, 0xc2, 0xbd, 0x9e, 0x27, 0x78,
+	0x18, 0x84, 0x6e, 0xc4, 0x95, 0x87, 0x2f, 0x79, 0x8e, 0x03, 0xf4, 0x04, 0x9a, 0xab, 0x84, 0x39,
+	0x6e, 0x6e, 0x41, 0xc9, 0xf7, 0x74, 0x0e, 0x96, 0x7c, 0x4f, 0x9e, 0x7c, 0xf4, 0xd4, 0xe8, 0xd4,
+	0xd0, 0x93, 0xbf, 0x17, 0xcd, 0x75, 0xaa, 0x5f, 0x00, 0xaa, 0x50, 0x1e, 0x9d, 0x8f, 0x4f, 0x5f,
+	0x36, 0x0b, 0x64, 0x17, 0x9a, 0xa3, 0xf3, 0xf1, 0xe0, 0x74, 0xd0, 0xed, 0x8d, 0x47, 0xa7, 0xa7,
+	0xe3, 0x93, 0xd3, 0x3f, 0x34, 0x8b, 0xe4, 0x3e, 0xec, 0x8c, 0xce, 0xc7, 0x9d, 0x13, 0xd6, 0xeb,
+	0x7c, 0xf3, 0xdd, 0xb8, 0x77, 0xde, 0x1f, 0x8e, 0x86, 0xcd, 0x12, 0xb9, 0x07, 0xdb, 0xa3, 0xf3,
+	0x71, 0x7f, 0xf0, 0xba, 0x73, 0xd2, 0xff, 0x66, 0x7c, 0xdc, 0x19, 0x1e, 0x37, 0xd7, 0x56, 0x90,
+	0xc3, 0xfe, 0x8b, 0x41, 0x73, 0x5d, 0x0b, 0x30, 0xc8, 0xe7, 0xa7, 0xec, 0x55, 0x67, 0xd4, 0x2c,
+	0x93, 0xff, 0x83, 0x87, 0x88, 0x1e, 0x7e, 0xfb, 0xfc, 0x79, 0xbf, 0xdb, 0xef, 0x0d, 0x46, 0xe3,
+	0xa3, 0xce, 0x49, 0x67, 0xd0, 0xed, 0x35, 0x37, 0x34, 0xcf, 0x71, 0x67, 0x38, 0x1e, 0x76, 0x5e,
+	0xf5, 0x94, 0x4d, 0xcd, 0xcd, 0x58, 0xd4, 0xa8, 0xc7, 0x06, 0x9d, 0x93, 0x71, 0x8f, 0xb1, 0x53,
+	0xd6, 0xac, 0x3e, 0x99, 0x98, 0x8b, 0x57, 0xfb, 0xb4, 0x0b, 0xcd, 0xd7, 0x3d, 0xd6, 0x7f, 0xfe,
+	0xdd, 0x78, 0x38, 0xea, 0x8c, 0xbe, 0x1d, 0x2a, 0xf7, 0xf6, 0xe1, 0xdd, 0x2c, 0x56, 0xda, 0x37,
+	0x1e, 0x9c, 0x8e, 0xc6, 0xaf, 0x3a, 0xa3, 0xee, 0x71, 0xb3, 0x48, 0x1e, 0x41, 0x2b, 0x4b, 0x91,
+	0x71, 0xaf, 0xd4, 0xfe, 0x07, 0x81, 0xed, 0x0e, 0x0f, 0xa7, 0x3e, 0x3b, 0xeb, 0xca, 0x13, 0x26,
+	0xa7, 0xda, 0xa7, 0x50, 0x95, 0xb5, 0x70, 0x88, 0x13, 0x84, 0xa9, 0xf6, 0xba, 0x3a, 0xb6, 0x72,
+	0x2e, 0x3a, 0x5a, 0x20, 0x4f, 0x61, 0xe3, 0x15, 0xbe, 0xd2, 0x10, 0x33, 0xa9, 0x28, 0x30, 0x62,
+	0xfc, 0xfb, 0x25, 0x8f, 0x44, 0x6b, 0x2b, 0x8b, 0xa6, 0x05, 0xf2, 0x39, 0x40, 0xf2, 0x76, 0x43,
+	0xe2, 0xe4, 0x94, 0xb3, 0x60, 0xeb, 0x61, 0xba, 0x7d, 0x4a, 0x3d, 0xee, 0xd0, 0x02, 0xf9, 0x14,
+	0xea, 0x2f, 0xb8, 0x48, 0x9e, 0x21, 0xb2, 0x8c, 0x77, 0xde, 0x52, 0x68, 0x81, 0x1c, 0xea, 0x57,
+	0x0b, 0x29, 0x62, 0x85, 0x7c, 0x27, 0x4d, 0x8e, 0x43, 0x37, 0x2d, 0x90, 0xaf, 0xa1, 0x29, 0xcf,
+	0x4f, 0xaa, 0x53, 0x8c, 0x88, 0x21, 0x4c, 0xe6, 0x87, 0xd6, 0x83, 0xbb, 0x1d, 0xa5, 0x5c, 0xa5,
+	0x05, 0x72, 0x04, 0x3b, 0xb1, 0x80, 0xb8, 0x49, 0xcd, 0x91, 0xb0, 0x97, 0xd7, 0x24, 0x6a, 0x19,
+	0x4f, 0x61, 0x3b, 0x96, 0x31, 0x14, 0x21, 0xb7, 0x16, 0x2b, 0xa6, 0x67, 0x7a, 0x63, 0x5a, 0xf8,
+	0xb4, 0x48, 0x3a, 0xf0, 0xf0, 0x8e, 0xda, 0x5c, 0xd6, 0xdc, 0xe6, 0x14, 0x45, 0x1c, 0x42, 0xe5,
+	0x05, 0x57, 0x12, 0x48, 0xce, 0x46, 0xaf, 0x2a, 0x25, 0x5f, 0x41, 0xd3, 0xd0, 0x27, 0xdd, 0x78,
+	0x0e, 0xdf, 0x1b, 0x34, 0x92, 0xaf, 0x71, 0x33, 0xe3, 0x41, 0x83, 0x3c, 0x58, 0x9d, 0x46, 0x74,
+	0xa4, 0xee, 0xdf, 0xc5, 0x4f, 0xb9, 0x43, 0x0b, 0xe4, 0x00, 0xca, 0x2f, 0xb8, 0x18, 0x9d, 0xe7,
+	0x6a, 0x4d, 0x1a, 0x54, 0x5a, 0x20, 0x9f, 0x01, 0x18, 0x55, 0x6f, 0x20, 0x6f, 0xc6, 0xe4, 0x7d,
+	0xcf, 0x38, 0xd8, 0x46, 0x2e, 0xc6, 0x6d, 0xee, 0x06, 0x22, 0x97, 0xcb, 0x24, 0xb6, 0xa6, 0xa1,
+	0x05, 0x39, 0x7a, 0xbc, 0xe0, 0xa2, 0x73, 0xd4, 0xcf, 0xa5, 0x07, 0xd3, 0xbe, 0x1e, 0xf5, 0x15,
+	0xed, 0x90, 0x7b, 0xce, 0xe8, 0x9c, 0x24, 0xc6, 0xb6, 0xf2, 0x5a, 0x72, 0x2a, 0x0f, 0xfb, 0xc6,
+	0xd0, 0x9d, 0x7a, 0x59, 0xda, 0x8c, 0x8f, 0x1f, 0x43, 0x45, 0x15, 0x8d, 0x7c, 0x79, 0xe9, 0x4e,
+	0x1e, 0x23, 0x52, 0x51, 0x1a, 0x46, 0xe7, 0xa4, 0x11, 0x53, 0xcb, 0x14, 0x8a, 0xcf, 0xdf, 0xea,
+	0xf8, 0x80, 0x5b, 0xbe, 0x65, 0xb8, 0x74, 0x72, 0xfd, 0x68, 0xde, 0x83, 0x62, 0x9c, 0x62, 0xaa,
+	0xb6, 0xfc, 0xb7, 0x14, 0x43, 0x0a, 0x5a, 0x20, 0xbf, 0xc3, 0x14, 0x43, 0xa8, 0xe3, 0x39, 0x67,
+	0xa1, 0xef, 0x4f, 0xe2, 0x1a, 0x93, 0x7d, 0xbc, 0x89, 0xfd, 0xd4, 0x68, 0xa4, 0xc5, 0x3d, 0x6c,
+	0x74, 0x43, 0x2e, 0xf9, 0xf5, 0x53, 0x4e, 0xf2, 0xaa, 0xa0, 0x66, 0x90, 0xd6, 0xca, 0x48, 0x81,
+	0xc7, 0xaf, 0x26, 0xf7, 0x50, 0xc1, 0xd1, 0xca, 0xf9, 0x21, 0x59, 0x72, 0x1d, 0x98, 0x4f, 0xa1,
+	0x76, 0xe2, 0xdb, 0x97, 0x6f, 0xa1, 0xa4, 0x0d, 0x8d, 0x6f, 0xbd, 0xf9, 0xdb, 0xf1, 0x7c, 0x01,
+	0x0d, 0x35, 0xe3, 0x18, 0x1e, 0xe3, 0x74, 0x7a, 0xf2, 0xc9, 0xe7, 0xeb, 0xdd, 0xa4, 0xf9, 0xee,
+	0xe8, 0xca, 0x2f, 0xec, 0x5f, 0xc1, 0xfd, 0x0c, 0xdf, 0x4b, 0x3d, 0xd2, 0xfc, 0x58, 0xfe, 0x67,
+	0xd0, 0xf8, 0xfd, 0x92, 0x87, 0xb7, 0x5d, 0xdf, 0x13, 0xa1, 0x65, 0x27, 0x05, 0x18, 0xb1, 0x6f,
+	0x60, 0xea, 0x00, 0xc9, 0x30, 0xa9, 0x6c, 0xd9, 0x49, 0x67, 0x86, 0x62, 0x7f, 0x70, 0x07, 0x65,
+	0x36, 0xfd, 0x29, 0xa6, 0x19, 0x36, 0xbd, 0x24, 0xfd, 0xd8, 0xa6, 0x5b, 0xe0, 0x56, 0xfa, 0x65,
+	0x29, 0xde, 0x40, 0xc9, 0xf2, 0x1a, 0xc7, 0x83, 0x9d, 0xd4, 0xc8, 0xb0, 0xc2, 0x61, 0xa6, 0x0c,
+	0x2c, 0xf4, 0xdb, 0x49, 0x96, 0x28, 0xc6, 0xd5, 0xd4, 0x54, 0x4f, 0x7a, 0xb1, 0xa1, 0x2b, 0xc3,
+	0x95, 0xba, 0x06, 0x55, 0x7e, 0xe3, 0x08, 0xf5, 0x06, 0xf6, 0x95, 0x91, 0x8b, 0x16, 0xc8, 0x27,
+	0x98, 0xa0, 0xf1, 0xe4, 0x90, 0x9e, 0x15, 0x62, 0x4b, 0xcd, 0x2a, 0x6e, 0x3f, 0x5e, 0x27, 0xd8,
+	0xfa, 0xe9, 0x63, 0x6b, 0x5c, 0x7c, 0xee, 0xce, 0x85, 0xea, 0xab, 0x5b, 0x99, 0x0e, 0x11, 0x2f,
+	0x84, 0x67, 0xea, 0xc9, 0x0c, 0x11, 0x51, 0x1e, 0x4b, 0x33, 0xcd, 0xa2, 0xc3, 0xf2, 0x05, 0x34,
+	0xa4, 0x4b, 0xc9, 0x24, 0x60, 0x88, 0xe2, 0xe1, 0x21, 0xbe, 0x78, 0x13, 0x22, 0x5a, 0x20, 0x5f,
+	0xe2, 0x51, 0xcf, 0x76, 0xa3, 0xf9, 0x37, 0x57, 0x86, 0x86, 0x16, 0xc8, 0x09, 0xdc, 0x7b, 0xc1,
+	0xc5, 0x9d, 0x9e, 0xb2, 0x65, 0x98, 0xef, 0x76, 0xa5, 0x71, 0x99, 0x5a, 0x5d, 0xa3, 0x05, 0x72,
+	0x0c, 0xf7, 0x95, 0x1d, 0x93, 0xee, 0xcc, 0xf2, 0xa6, 0xfc, 0x2c, 0xf4, 0xa7, 0xf8, 0x30, 0x9b,
+	0x57, 0xaf, 0xde, 0x49, 0x75, 0xf4, 0x59, 0x72, 0x5a, 0xb8, 0xd8, 0xc0, 0xff, 0x54, 0xcf, 0xfe,
+	0x13, 0x00, 0x00, 0xff, 0xff, 0xfa, 0xed, 0x4e, 0xa9, 0x0d, 0x1b, 0x00, 0x00,
 }